@@ -2095,7 +2095,7 @@ CORBA::Object_ptr Components::Navigation_stub::provide_facet( const char* _par_n
   CORBA::Object_ptr _res = CORBA::Object::_nil();
   CORBA::StaticAny __res( CORBA::_stc_Object, &_res );
 
-  CORBA::StaticRequest __req( this, "provide_facet" );
+  CORBA::StaticRequest __req( this, "provide_facet", TRUE );
   __req.add_in_arg( &_sa_name );
   __req.set_result( &__res );
 
@@ -2148,7 +2148,7 @@ Components::FacetDescriptions* Components::Navigation_stub::get_all_facets()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_FacetDescription );
 
-  CORBA::StaticRequest __req( this, "get_all_facets" );
+  CORBA::StaticRequest __req( this, "get_all_facets", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -2164,6 +2164,26 @@ Components::FacetDescriptions* Components::Navigation_stub::get_all_facets()
 Components::FacetDescriptions*
 Components::Navigation_stub_clp::get_all_facets()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Navigation * _myserv = POA_Components::Navigation::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_FacetDescription );
+
+      CORBA::StaticRequest __req( this, "get_all_facets", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::FacetDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Navigation_stub::get_all_facets();
 }
 
@@ -2174,7 +2194,7 @@ Components::FacetDescriptions* Components::Navigation_stub::get_named_facets( co
   CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
   CORBA::StaticAny __res( _marshaller__seq_Components_FacetDescription );
 
-  CORBA::StaticRequest __req( this, "get_named_facets" );
+  CORBA::StaticRequest __req( this, "get_named_facets", TRUE );
   __req.add_in_arg( &_sa_names );
   __req.set_result( &__res );
 
@@ -2192,6 +2212,29 @@ Components::FacetDescriptions* Components::Navigation_stub::get_named_facets( co
 Components::FacetDescriptions*
 Components::Navigation_stub_clp::get_named_facets( const Components::NameList& _par_names )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Navigation * _myserv = POA_Components::Navigation::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
+      CORBA::StaticAny __res( _marshaller__seq_Components_FacetDescription );
+
+      CORBA::StaticRequest __req( this, "get_named_facets", TRUE );
+      __req.add_in_arg( &_sa_names );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_InvalidName, "IDL:omg.org/Components/InvalidName:1.0",
+        0);
+      return (Components::FacetDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Navigation_stub::get_named_facets(_par_names);
 }
 
@@ -2203,7 +2246,7 @@ CORBA::Boolean Components::Navigation_stub::same_component( CORBA::Object_ptr _p
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "same_component" );
+  CORBA::StaticRequest __req( this, "same_component", TRUE );
   __req.add_in_arg( &_sa_ref );
   __req.set_result( &__res );
 
@@ -2923,7 +2966,7 @@ Components::Cookie* Components::Receptacles_stub::connect( const char* _par_name
   Components::Cookie* _res = NULL;
   CORBA::StaticAny __res( _marshaller_Components_Cookie, &_res );
 
-  CORBA::StaticRequest __req( this, "connect" );
+  CORBA::StaticRequest __req( this, "connect", TRUE );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_connection );
   __req.set_result( &__res );
@@ -2982,7 +3025,7 @@ void Components::Receptacles_stub::disconnect( const char* _par_name, Components
 {
   CORBA::StaticAny _sa_name( CORBA::_stc_string, &_par_name );
   CORBA::StaticAny _sa_ck( _marshaller_Components_Cookie, &_par_ck );
-  CORBA::StaticRequest __req( this, "disconnect" );
+  CORBA::StaticRequest __req( this, "disconnect", TRUE );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_ck );
 
@@ -3039,7 +3082,7 @@ Components::ConnectionDescriptions* Components::Receptacles_stub::get_connection
   CORBA::StaticAny _sa_name( CORBA::_stc_string, &_par_name );
   CORBA::StaticAny __res( _marshaller__seq_Components_ConnectionDescription );
 
-  CORBA::StaticRequest __req( this, "get_connections" );
+  CORBA::StaticRequest __req( this, "get_connections", TRUE );
   __req.add_in_arg( &_sa_name );
   __req.set_result( &__res );
 
@@ -3057,6 +3100,29 @@ Components::ConnectionDescriptions* Components::Receptacles_stub::get_connection
 Components::ConnectionDescriptions*
 Components::Receptacles_stub_clp::get_connections( const char* _par_name )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Receptacles * _myserv = POA_Components::Receptacles::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_name( CORBA::_stc_string, &_par_name );
+      CORBA::StaticAny __res( _marshaller__seq_Components_ConnectionDescription );
+
+      CORBA::StaticRequest __req( this, "get_connections", TRUE );
+      __req.add_in_arg( &_sa_name );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_InvalidName, "IDL:omg.org/Components/InvalidName:1.0",
+        0);
+      return (Components::ConnectionDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Receptacles_stub::get_connections(_par_name);
 }
 
@@ -3066,7 +3132,7 @@ Components::ReceptacleDescriptions* Components::Receptacles_stub::get_all_recept
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_ReceptacleDescription );
 
-  CORBA::StaticRequest __req( this, "get_all_receptacles" );
+  CORBA::StaticRequest __req( this, "get_all_receptacles", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3082,6 +3148,26 @@ Components::ReceptacleDescriptions* Components::Receptacles_stub::get_all_recept
 Components::ReceptacleDescriptions*
 Components::Receptacles_stub_clp::get_all_receptacles()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Receptacles * _myserv = POA_Components::Receptacles::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_ReceptacleDescription );
+
+      CORBA::StaticRequest __req( this, "get_all_receptacles", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::ReceptacleDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Receptacles_stub::get_all_receptacles();
 }
 
@@ -3092,7 +3178,7 @@ Components::ReceptacleDescriptions* Components::Receptacles_stub::get_named_rece
   CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
   CORBA::StaticAny __res( _marshaller__seq_Components_ReceptacleDescription );
 
-  CORBA::StaticRequest __req( this, "get_named_receptacles" );
+  CORBA::StaticRequest __req( this, "get_named_receptacles", TRUE );
   __req.add_in_arg( &_sa_names );
   __req.set_result( &__res );
 
@@ -3110,6 +3196,29 @@ Components::ReceptacleDescriptions* Components::Receptacles_stub::get_named_rece
 Components::ReceptacleDescriptions*
 Components::Receptacles_stub_clp::get_named_receptacles( const Components::NameList& _par_names )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Receptacles * _myserv = POA_Components::Receptacles::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
+      CORBA::StaticAny __res( _marshaller__seq_Components_ReceptacleDescription );
+
+      CORBA::StaticRequest __req( this, "get_named_receptacles", TRUE );
+      __req.add_in_arg( &_sa_names );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_InvalidName, "IDL:omg.org/Components/InvalidName:1.0",
+        0);
+      return (Components::ReceptacleDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Receptacles_stub::get_named_receptacles(_par_names);
 }
 
@@ -3461,7 +3570,7 @@ Components::EventConsumerBase_stub_clp::~EventConsumerBase_stub_clp ()
 void Components::EventConsumerBase_stub::push_event( Components::EventBase* _par_evt )
 {
   CORBA::StaticAny _sa_evt( _marshaller_Components_EventBase, &_par_evt );
-  CORBA::StaticRequest __req( this, "push_event" );
+  CORBA::StaticRequest __req( this, "push_event", TRUE );
   __req.add_in_arg( &_sa_evt );
 
   __req.invoke();
@@ -4613,7 +4722,7 @@ Components::EventConsumerBase_ptr Components::Events_stub::get_consumer( const c
   Components::EventConsumerBase_ptr _res = Components::EventConsumerBase::_nil();
   CORBA::StaticAny __res( _marshaller_Components_EventConsumerBase, &_res );
 
-  CORBA::StaticRequest __req( this, "get_consumer" );
+  CORBA::StaticRequest __req( this, "get_consumer", TRUE );
   __req.add_in_arg( &_sa_sink_name );
   __req.set_result( &__res );
 
@@ -4666,7 +4775,7 @@ Components::ConsumerDescriptions* Components::Events_stub::get_all_consumers()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_ConsumerDescription );
 
-  CORBA::StaticRequest __req( this, "get_all_consumers" );
+  CORBA::StaticRequest __req( this, "get_all_consumers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4682,6 +4791,26 @@ Components::ConsumerDescriptions* Components::Events_stub::get_all_consumers()
 Components::ConsumerDescriptions*
 Components::Events_stub_clp::get_all_consumers()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_ConsumerDescription );
+
+      CORBA::StaticRequest __req( this, "get_all_consumers", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::ConsumerDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_all_consumers();
 }
 
@@ -4692,7 +4821,7 @@ Components::ConsumerDescriptions* Components::Events_stub::get_named_consumers(
   CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
   CORBA::StaticAny __res( _marshaller__seq_Components_ConsumerDescription );
 
-  CORBA::StaticRequest __req( this, "get_named_consumers" );
+  CORBA::StaticRequest __req( this, "get_named_consumers", TRUE );
   __req.add_in_arg( &_sa_names );
   __req.set_result( &__res );
 
@@ -4709,6 +4838,28 @@ Components::ConsumerDescriptions* Components::Events_stub::get_named_consumers(
 Components::ConsumerDescriptions*
 Components::Events_stub_clp::get_named_consumers( const Components::NameList& _par_names )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
+      CORBA::StaticAny __res( _marshaller__seq_Components_ConsumerDescription );
+
+      CORBA::StaticRequest __req( this, "get_named_consumers", TRUE );
+      __req.add_in_arg( &_sa_names );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::ConsumerDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_named_consumers(_par_names);
 }
 
@@ -4721,7 +4872,7 @@ Components::Cookie* Components::Events_stub::subscribe( const char* _par_publish
   Components::Cookie* _res = NULL;
   CORBA::StaticAny __res( _marshaller_Components_Cookie, &_res );
 
-  CORBA::StaticRequest __req( this, "subscribe" );
+  CORBA::StaticRequest __req( this, "subscribe", TRUE );
   __req.add_in_arg( &_sa_publisher_name );
   __req.add_in_arg( &_sa_subscriber );
   __req.set_result( &__res );
@@ -4777,7 +4928,7 @@ void Components::Events_stub::unsubscribe( const char* _par_publisher_name, Comp
 {
   CORBA::StaticAny _sa_publisher_name( CORBA::_stc_string, &_par_publisher_name );
   CORBA::StaticAny _sa_ck( _marshaller_Components_Cookie, &_par_ck );
-  CORBA::StaticRequest __req( this, "unsubscribe" );
+  CORBA::StaticRequest __req( this, "unsubscribe", TRUE );
   __req.add_in_arg( &_sa_publisher_name );
   __req.add_in_arg( &_sa_ck );
 
@@ -4831,7 +4982,7 @@ Components::PublisherDescriptions* Components::Events_stub::get_all_publishers()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_PublisherDescription );
 
-  CORBA::StaticRequest __req( this, "get_all_publishers" );
+  CORBA::StaticRequest __req( this, "get_all_publishers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4847,6 +4998,26 @@ Components::PublisherDescriptions* Components::Events_stub::get_all_publishers()
 Components::PublisherDescriptions*
 Components::Events_stub_clp::get_all_publishers()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_PublisherDescription );
+
+      CORBA::StaticRequest __req( this, "get_all_publishers", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::PublisherDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_all_publishers();
 }
 
@@ -4857,7 +5028,7 @@ Components::PublisherDescriptions* Components::Events_stub::get_named_publishers
   CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
   CORBA::StaticAny __res( _marshaller__seq_Components_PublisherDescription );
 
-  CORBA::StaticRequest __req( this, "get_named_publishers" );
+  CORBA::StaticRequest __req( this, "get_named_publishers", TRUE );
   __req.add_in_arg( &_sa_names );
   __req.set_result( &__res );
 
@@ -4874,6 +5045,28 @@ Components::PublisherDescriptions* Components::Events_stub::get_named_publishers
 Components::PublisherDescriptions*
 Components::Events_stub_clp::get_named_publishers( const Components::NameList& _par_names )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
+      CORBA::StaticAny __res( _marshaller__seq_Components_PublisherDescription );
+
+      CORBA::StaticRequest __req( this, "get_named_publishers", TRUE );
+      __req.add_in_arg( &_sa_names );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::PublisherDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_named_publishers(_par_names);
 }
 
@@ -4883,7 +5076,7 @@ void Components::Events_stub::connect_consumer( const char* _par_emitter_name, C
 {
   CORBA::StaticAny _sa_emitter_name( CORBA::_stc_string, &_par_emitter_name );
   CORBA::StaticAny _sa_consumer( _marshaller_Components_EventConsumerBase, &_par_consumer );
-  CORBA::StaticRequest __req( this, "connect_consumer" );
+  CORBA::StaticRequest __req( this, "connect_consumer", TRUE );
   __req.add_in_arg( &_sa_emitter_name );
   __req.add_in_arg( &_sa_consumer );
 
@@ -4936,7 +5129,7 @@ Components::EventConsumerBase_ptr Components::Events_stub::disconnect_consumer(
   Components::EventConsumerBase_ptr _res = Components::EventConsumerBase::_nil();
   CORBA::StaticAny __res( _marshaller_Components_EventConsumerBase, &_res );
 
-  CORBA::StaticRequest __req( this, "disconnect_consumer" );
+  CORBA::StaticRequest __req( this, "disconnect_consumer", TRUE );
   __req.add_in_arg( &_sa_source_name );
   __req.set_result( &__res );
 
@@ -4990,7 +5183,7 @@ Components::EmitterDescriptions* Components::Events_stub::get_all_emitters()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_EmitterDescription );
 
-  CORBA::StaticRequest __req( this, "get_all_emitters" );
+  CORBA::StaticRequest __req( this, "get_all_emitters", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5006,6 +5199,26 @@ Components::EmitterDescriptions* Components::Events_stub::get_all_emitters()
 Components::EmitterDescriptions*
 Components::Events_stub_clp::get_all_emitters()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_EmitterDescription );
+
+      CORBA::StaticRequest __req( this, "get_all_emitters", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::EmitterDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_all_emitters();
 }
 
@@ -5016,7 +5229,7 @@ Components::EmitterDescriptions* Components::Events_stub::get_named_emitters( co
   CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
   CORBA::StaticAny __res( _marshaller__seq_Components_EmitterDescription );
 
-  CORBA::StaticRequest __req( this, "get_named_emitters" );
+  CORBA::StaticRequest __req( this, "get_named_emitters", TRUE );
   __req.add_in_arg( &_sa_names );
   __req.set_result( &__res );
 
@@ -5033,6 +5246,28 @@ Components::EmitterDescriptions* Components::Events_stub::get_named_emitters( co
 Components::EmitterDescriptions*
 Components::Events_stub_clp::get_named_emitters( const Components::NameList& _par_names )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Events * _myserv = POA_Components::Events::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_names( CORBA::_stcseq_string, &_par_names );
+      CORBA::StaticAny __res( _marshaller__seq_Components_EmitterDescription );
+
+      CORBA::StaticRequest __req( this, "get_named_emitters", TRUE );
+      __req.add_in_arg( &_sa_names );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::EmitterDescriptions*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Events_stub::get_named_emitters(_par_names);
 }
 
@@ -5222,7 +5457,7 @@ CORBA::Object_ptr Components::CCMHome_stub::get_component_def()
   CORBA::Object_ptr _res = CORBA::Object::_nil();
   CORBA::StaticAny __res( CORBA::_stc_Object, &_res );
 
-  CORBA::StaticRequest __req( this, "get_component_def" );
+  CORBA::StaticRequest __req( this, "get_component_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5274,7 +5509,7 @@ CORBA::Object_ptr Components::CCMHome_stub::get_home_def()
   CORBA::Object_ptr _res = CORBA::Object::_nil();
   CORBA::StaticAny __res( CORBA::_stc_Object, &_res );
 
-  CORBA::StaticRequest __req( this, "get_home_def" );
+  CORBA::StaticRequest __req( this, "get_home_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5324,7 +5559,7 @@ Components::CCMHome_stub_clp::get_home_def()
 void Components::CCMHome_stub::remove_component( Components::CCMObject_ptr _par_comp )
 {
   CORBA::StaticAny _sa_comp( _marshaller_Components_CCMObject, &_par_comp );
-  CORBA::StaticRequest __req( this, "remove_component" );
+  CORBA::StaticRequest __req( this, "remove_component", TRUE );
   __req.add_in_arg( &_sa_comp );
 
   __req.invoke();
@@ -5891,7 +6126,7 @@ CORBA::Object_ptr Components::CCMObject_stub::get_component_def()
   CORBA::Object_ptr _res = CORBA::Object::_nil();
   CORBA::StaticAny __res( CORBA::_stc_Object, &_res );
 
-  CORBA::StaticRequest __req( this, "get_component_def" );
+  CORBA::StaticRequest __req( this, "get_component_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5943,7 +6178,7 @@ Components::CCMHome_ptr Components::CCMObject_stub::get_ccm_home()
   Components::CCMHome_ptr _res = Components::CCMHome::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
 
-  CORBA::StaticRequest __req( this, "get_ccm_home" );
+  CORBA::StaticRequest __req( this, "get_ccm_home", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5992,7 +6227,7 @@ Components::CCMObject_stub_clp::get_ccm_home()
 
 void Components::CCMObject_stub::configuration_complete()
 {
-  CORBA::StaticRequest __req( this, "configuration_complete" );
+  CORBA::StaticRequest __req( this, "configuration_complete", TRUE );
 
   __req.invoke();
 
@@ -6037,7 +6272,7 @@ Components::CCMObject_stub_clp::configuration_complete()
 
 void Components::CCMObject_stub::remove()
 {
-  CORBA::StaticRequest __req( this, "remove" );
+  CORBA::StaticRequest __req( this, "remove", TRUE );
 
   __req.invoke();
 
@@ -6085,7 +6320,7 @@ Components::ComponentPortDescription* Components::CCMObject_stub::get_all_ports(
   Components::ComponentPortDescription* _res = NULL;
   CORBA::StaticAny __res( _marshaller_Components_ComponentPortDescription, &_res );
 
-  CORBA::StaticRequest __req( this, "get_all_ports" );
+  CORBA::StaticRequest __req( this, "get_all_ports", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -6767,7 +7002,7 @@ Components::CCMObject_ptr Components::KeylessCCMHome_stub::create_component()
   Components::CCMObject_ptr _res = Components::CCMObject::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMObject, &_res );
 
-  CORBA::StaticRequest __req( this, "create_component" );
+  CORBA::StaticRequest __req( this, "create_component", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7147,7 +7382,7 @@ Components::CCMHome_ptr Components::HomeFinder_stub::find_home_by_component_type
   Components::CCMHome_ptr _res = Components::CCMHome::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
 
-  CORBA::StaticRequest __req( this, "find_home_by_component_type" );
+  CORBA::StaticRequest __req( this, "find_home_by_component_type", TRUE );
   __req.add_in_arg( &_sa_comp_repid );
   __req.set_result( &__res );
 
@@ -7202,7 +7437,7 @@ Components::CCMHome_ptr Components::HomeFinder_stub::find_home_by_home_type( con
   Components::CCMHome_ptr _res = Components::CCMHome::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
 
-  CORBA::StaticRequest __req( this, "find_home_by_home_type" );
+  CORBA::StaticRequest __req( this, "find_home_by_home_type", TRUE );
   __req.add_in_arg( &_sa_home_repid );
   __req.set_result( &__res );
 
@@ -7257,7 +7492,7 @@ Components::CCMHome_ptr Components::HomeFinder_stub::find_home_by_name( const ch
   Components::CCMHome_ptr _res = Components::CCMHome::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
 
-  CORBA::StaticRequest __req( this, "find_home_by_name" );
+  CORBA::StaticRequest __req( this, "find_home_by_name", TRUE );
   __req.add_in_arg( &_sa_home_name );
   __req.set_result( &__res );
 
@@ -7635,7 +7870,7 @@ Components::Configurator_stub_clp::~Configurator_stub_clp ()
 void Components::Configurator_stub::configure( Components::CCMObject_ptr _par_comp )
 {
   CORBA::StaticAny _sa_comp( _marshaller_Components_CCMObject, &_par_comp );
-  CORBA::StaticRequest __req( this, "configure" );
+  CORBA::StaticRequest __req( this, "configure", TRUE );
   __req.add_in_arg( &_sa_comp );
 
   __req.invoke();
@@ -8121,7 +8356,7 @@ Components::StandardConfigurator_stub_clp::~StandardConfigurator_stub_clp ()
 void Components::StandardConfigurator_stub::set_configuration( const Components::ConfigValues& _par_descr )
 {
   CORBA::StaticAny _sa_descr( _marshaller__seq_Components_ConfigValue, &_par_descr );
-  CORBA::StaticRequest __req( this, "set_configuration" );
+  CORBA::StaticRequest __req( this, "set_configuration", TRUE );
   __req.add_in_arg( &_sa_descr );
 
   __req.invoke();
@@ -8136,6 +8371,25 @@ void Components::StandardConfigurator_stub::set_configuration( const Components:
 void
 Components::StandardConfigurator_stub_clp::set_configuration( const Components::ConfigValues& _par_descr )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::StandardConfigurator * _myserv = POA_Components::StandardConfigurator::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_descr( _marshaller__seq_Components_ConfigValue, &_par_descr );
+      CORBA::StaticRequest __req( this, "set_configuration", TRUE );
+      __req.add_in_arg( &_sa_descr );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return;
+    }
+    _postinvoke ();
+  }
+
   Components::StandardConfigurator_stub::set_configuration(_par_descr);
 }
 
@@ -9843,7 +10097,7 @@ Components::ConfigValues* Components::Container_stub::configuration()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_ConfigValue );
 
-  CORBA::StaticRequest __req( this, "_get_configuration" );
+  CORBA::StaticRequest __req( this, "_get_configuration", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -9859,6 +10113,26 @@ Components::ConfigValues* Components::Container_stub::configuration()
 Components::ConfigValues*
 Components::Container_stub_clp::configuration()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Container * _myserv = POA_Components::Container::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_ConfigValue );
+
+      CORBA::StaticRequest __req( this, "_get_configuration", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::ConfigValues*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::Container_stub::configuration();
 }
 
@@ -9869,7 +10143,7 @@ Components::ComponentServer_ptr Components::Container_stub::get_component_server
   Components::ComponentServer_ptr _res = Components::ComponentServer::_nil();
   CORBA::StaticAny __res( _marshaller_Components_ComponentServer, &_res );
 
-  CORBA::StaticRequest __req( this, "get_component_server" );
+  CORBA::StaticRequest __req( this, "get_component_server", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -9924,7 +10198,7 @@ Components::CCMHome_ptr Components::Container_stub::install_home( const char* _p
   Components::CCMHome_ptr _res = Components::CCMHome::_nil();
   CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
 
-  CORBA::StaticRequest __req( this, "install_home" );
+  CORBA::StaticRequest __req( this, "install_home", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_entrypt );
   __req.add_in_arg( &_sa_config );
@@ -9945,6 +10219,35 @@ Components::CCMHome_ptr Components::Container_stub::install_home( const char* _p
 Components::CCMHome_ptr
 Components::Container_stub_clp::install_home( const char* _par_id, const char* _par_entrypt, const Components::ConfigValues& _par_config )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::Container * _myserv = POA_Components::Container::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_id( CORBA::_stc_string, &_par_id );
+      CORBA::StaticAny _sa_entrypt( CORBA::_stc_string, &_par_entrypt );
+      CORBA::StaticAny _sa_config( _marshaller__seq_Components_ConfigValue, &_par_config );
+      Components::CCMHome_ptr _res = Components::CCMHome::_nil();
+      CORBA::StaticAny __res( _marshaller_Components_CCMHome, &_res );
+
+      CORBA::StaticRequest __req( this, "install_home", TRUE );
+      __req.add_in_arg( &_sa_id );
+      __req.add_in_arg( &_sa_entrypt );
+      __req.add_in_arg( &_sa_config );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_InvalidConfiguration, "IDL:omg.org/Components/InvalidConfiguration:1.0",
+        _marshaller_Components_InstallationFailure, "IDL:omg.org/Components/InstallationFailure:1.0",
+        0);
+      return _res;
+    }
+    _postinvoke ();
+  }
+
   return Components::Container_stub::install_home(_par_id, _par_entrypt, _par_config);
 }
 
@@ -9953,7 +10256,7 @@ Components::Container_stub_clp::install_home( const char* _par_id, const char* _
 void Components::Container_stub::remove_home( Components::CCMHome_ptr _par_href )
 {
   CORBA::StaticAny _sa_href( _marshaller_Components_CCMHome, &_par_href );
-  CORBA::StaticRequest __req( this, "remove_home" );
+  CORBA::StaticRequest __req( this, "remove_home", TRUE );
   __req.add_in_arg( &_sa_href );
 
   __req.invoke();
@@ -10002,7 +10305,7 @@ Components::CCMHomes* Components::Container_stub::get_homes()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_CCMHome );
 
-  CORBA::StaticRequest __req( this, "get_homes" );
+  CORBA::StaticRequest __req( this, "get_homes", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10051,7 +10354,7 @@ Components::Container_stub_clp::get_homes()
 
 void Components::Container_stub::remove()
 {
-  CORBA::StaticRequest __req( this, "remove" );
+  CORBA::StaticRequest __req( this, "remove", TRUE );
 
   __req.invoke();
 
@@ -10283,7 +10586,7 @@ Components::ConfigValues* Components::ComponentServer_stub::configuration()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_ConfigValue );
 
-  CORBA::StaticRequest __req( this, "_get_configuration" );
+  CORBA::StaticRequest __req( this, "_get_configuration", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10299,6 +10602,26 @@ Components::ConfigValues* Components::ComponentServer_stub::configuration()
 Components::ConfigValues*
 Components::ComponentServer_stub_clp::configuration()
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::ComponentServer * _myserv = POA_Components::ComponentServer::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny __res( _marshaller__seq_Components_ConfigValue );
+
+      CORBA::StaticRequest __req( this, "_get_configuration", TRUE );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return (Components::ConfigValues*) __res._retn();
+    }
+    _postinvoke ();
+  }
+
   return Components::ComponentServer_stub::configuration();
 }
 
@@ -10309,7 +10632,7 @@ Components::ServerActivator_ptr Components::ComponentServer_stub::get_server_act
   Components::ServerActivator_ptr _res = Components::ServerActivator::_nil();
   CORBA::StaticAny __res( _marshaller_Components_ServerActivator, &_res );
 
-  CORBA::StaticRequest __req( this, "get_server_activator" );
+  CORBA::StaticRequest __req( this, "get_server_activator", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10362,7 +10685,7 @@ Components::Container_ptr Components::ComponentServer_stub::create_container( co
   Components::Container_ptr _res = Components::Container::_nil();
   CORBA::StaticAny __res( _marshaller_Components_Container, &_res );
 
-  CORBA::StaticRequest __req( this, "create_container" );
+  CORBA::StaticRequest __req( this, "create_container", TRUE );
   __req.add_in_arg( &_sa_config );
   __req.set_result( &__res );
 
@@ -10381,6 +10704,31 @@ Components::Container_ptr Components::ComponentServer_stub::create_container( co
 Components::Container_ptr
 Components::ComponentServer_stub_clp::create_container( const Components::ConfigValues& _par_config )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::ComponentServer * _myserv = POA_Components::ComponentServer::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_config( _marshaller__seq_Components_ConfigValue, &_par_config );
+      Components::Container_ptr _res = Components::Container::_nil();
+      CORBA::StaticAny __res( _marshaller_Components_Container, &_res );
+
+      CORBA::StaticRequest __req( this, "create_container", TRUE );
+      __req.add_in_arg( &_sa_config );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_CreateFailure, "IDL:omg.org/Components/CreateFailure:1.0",
+        _marshaller_Components_InvalidConfiguration, "IDL:omg.org/Components/InvalidConfiguration:1.0",
+        0);
+      return _res;
+    }
+    _postinvoke ();
+  }
+
   return Components::ComponentServer_stub::create_container(_par_config);
 }
 
@@ -10389,7 +10737,7 @@ Components::ComponentServer_stub_clp::create_container( const Components::Config
 void Components::ComponentServer_stub::remove_container( Components::Container_ptr _par_cref )
 {
   CORBA::StaticAny _sa_cref( _marshaller_Components_Container, &_par_cref );
-  CORBA::StaticRequest __req( this, "remove_container" );
+  CORBA::StaticRequest __req( this, "remove_container", TRUE );
   __req.add_in_arg( &_sa_cref );
 
   __req.invoke();
@@ -10438,7 +10786,7 @@ Components::Containers* Components::ComponentServer_stub::get_containers()
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_Container );
 
-  CORBA::StaticRequest __req( this, "get_containers" );
+  CORBA::StaticRequest __req( this, "get_containers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10487,7 +10835,7 @@ Components::ComponentServer_stub_clp::get_containers()
 
 void Components::ComponentServer_stub::remove()
 {
-  CORBA::StaticRequest __req( this, "remove" );
+  CORBA::StaticRequest __req( this, "remove", TRUE );
 
   __req.invoke();
 
@@ -10729,7 +11077,7 @@ void Components::ComponentInstallation_stub::install( const char* _par_implUUID,
 {
   CORBA::StaticAny _sa_implUUID( CORBA::_stc_string, &_par_implUUID );
   CORBA::StaticAny _sa_component_loc( CORBA::_stc_string, &_par_component_loc );
-  CORBA::StaticRequest __req( this, "install" );
+  CORBA::StaticRequest __req( this, "install", TRUE );
   __req.add_in_arg( &_sa_implUUID );
   __req.add_in_arg( &_sa_component_loc );
 
@@ -10780,7 +11128,7 @@ void Components::ComponentInstallation_stub::replace( const char* _par_implUUID,
 {
   CORBA::StaticAny _sa_implUUID( CORBA::_stc_string, &_par_implUUID );
   CORBA::StaticAny _sa_component_loc( CORBA::_stc_string, &_par_component_loc );
-  CORBA::StaticRequest __req( this, "replace" );
+  CORBA::StaticRequest __req( this, "replace", TRUE );
   __req.add_in_arg( &_sa_implUUID );
   __req.add_in_arg( &_sa_component_loc );
 
@@ -10830,7 +11178,7 @@ Components::ComponentInstallation_stub_clp::replace( const char* _par_implUUID,
 void Components::ComponentInstallation_stub::remove( const char* _par_implUUID )
 {
   CORBA::StaticAny _sa_implUUID( CORBA::_stc_string, &_par_implUUID );
-  CORBA::StaticRequest __req( this, "remove" );
+  CORBA::StaticRequest __req( this, "remove", TRUE );
   __req.add_in_arg( &_sa_implUUID );
 
   __req.invoke();
@@ -10882,7 +11230,7 @@ char* Components::ComponentInstallation_stub::get_implementation( const char* _p
   Components::Location _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "get_implementation" );
+  CORBA::StaticRequest __req( this, "get_implementation", TRUE );
   __req.add_in_arg( &_sa_implUUID );
   __req.set_result( &__res );
 
@@ -11183,7 +11531,7 @@ Components::Assembly_stub_clp::~Assembly_stub_clp ()
 
 void Components::Assembly_stub::build()
 {
-  CORBA::StaticRequest __req( this, "build" );
+  CORBA::StaticRequest __req( this, "build", TRUE );
 
   __req.invoke();
 
@@ -11229,7 +11577,7 @@ Components::Assembly_stub_clp::build()
 
 void Components::Assembly_stub::tear_down()
 {
-  CORBA::StaticRequest __req( this, "tear_down" );
+  CORBA::StaticRequest __req( this, "tear_down", TRUE );
 
   __req.invoke();
 
@@ -11278,7 +11626,7 @@ Components::AssemblyState Components::Assembly_stub::get_state()
   Components::AssemblyState _res;
   CORBA::StaticAny __res( _marshaller_Components_AssemblyState, &_res );
 
-  CORBA::StaticRequest __req( this, "get_state" );
+  CORBA::StaticRequest __req( this, "get_state", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -11510,7 +11858,7 @@ Components::Cookie* Components::AssemblyFactory_stub::create( const char* _par_a
   Components::Cookie* _res = NULL;
   CORBA::StaticAny __res( _marshaller_Components_Cookie, &_res );
 
-  CORBA::StaticRequest __req( this, "create" );
+  CORBA::StaticRequest __req( this, "create", TRUE );
   __req.add_in_arg( &_sa_assembly_loc );
   __req.set_result( &__res );
 
@@ -11568,7 +11916,7 @@ Components::Assembly_ptr Components::AssemblyFactory_stub::lookup( Components::C
   Components::Assembly_ptr _res = Components::Assembly::_nil();
   CORBA::StaticAny __res( _marshaller_Components_Assembly, &_res );
 
-  CORBA::StaticRequest __req( this, "lookup" );
+  CORBA::StaticRequest __req( this, "lookup", TRUE );
   __req.add_in_arg( &_sa_c );
   __req.set_result( &__res );
 
@@ -11623,7 +11971,7 @@ Components::AssemblyFactory_stub_clp::lookup( Components::Cookie* _par_c )
 void Components::AssemblyFactory_stub::destroy( Components::Cookie* _par_c )
 {
   CORBA::StaticAny _sa_c( _marshaller_Components_Cookie, &_par_c );
-  CORBA::StaticRequest __req( this, "destroy" );
+  CORBA::StaticRequest __req( this, "destroy", TRUE );
   __req.add_in_arg( &_sa_c );
 
   __req.invoke();
@@ -11857,7 +12205,7 @@ Components::ComponentServer_ptr Components::ServerActivator_stub::create_compone
   Components::ComponentServer_ptr _res = Components::ComponentServer::_nil();
   CORBA::StaticAny __res( _marshaller_Components_ComponentServer, &_res );
 
-  CORBA::StaticRequest __req( this, "create_component_server" );
+  CORBA::StaticRequest __req( this, "create_component_server", TRUE );
   __req.add_in_arg( &_sa_config );
   __req.set_result( &__res );
 
@@ -11876,6 +12224,31 @@ Components::ComponentServer_ptr Components::ServerActivator_stub::create_compone
 Components::ComponentServer_ptr
 Components::ServerActivator_stub_clp::create_component_server( const Components::ConfigValues& _par_config )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_Components::ServerActivator * _myserv = POA_Components::ServerActivator::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_config( _marshaller__seq_Components_ConfigValue, &_par_config );
+      Components::ComponentServer_ptr _res = Components::ComponentServer::_nil();
+      CORBA::StaticAny __res( _marshaller_Components_ComponentServer, &_res );
+
+      CORBA::StaticRequest __req( this, "create_component_server", TRUE );
+      __req.add_in_arg( &_sa_config );
+      __req.set_result( &__res );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        _marshaller_Components_CreateFailure, "IDL:omg.org/Components/CreateFailure:1.0",
+        _marshaller_Components_InvalidConfiguration, "IDL:omg.org/Components/InvalidConfiguration:1.0",
+        0);
+      return _res;
+    }
+    _postinvoke ();
+  }
+
   return Components::ServerActivator_stub::create_component_server(_par_config);
 }
 
@@ -11884,7 +12257,7 @@ Components::ServerActivator_stub_clp::create_component_server( const Components:
 void Components::ServerActivator_stub::remove_component_server( Components::ComponentServer_ptr _par_server )
 {
   CORBA::StaticAny _sa_server( _marshaller_Components_ComponentServer, &_par_server );
-  CORBA::StaticRequest __req( this, "remove_component_server" );
+  CORBA::StaticRequest __req( this, "remove_component_server", TRUE );
   __req.add_in_arg( &_sa_server );
 
   __req.invoke();
@@ -11933,7 +12306,7 @@ Components::ComponentServers* Components::ServerActivator_stub::get_component_se
 {
   CORBA::StaticAny __res( _marshaller__seq_Components_ComponentServer );
 
-  CORBA::StaticRequest __req( this, "get_component_servers" );
+  CORBA::StaticRequest __req( this, "get_component_servers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12195,7 +12568,7 @@ CORBA::Object_ptr MICOCCM::MicoCCMD_stub::exec( const char* _par_prog, const Com
   CORBA::Object_ptr _res = CORBA::Object::_nil();
   CORBA::StaticAny __res( CORBA::_stc_Object, &_res );
 
-  CORBA::StaticRequest __req( this, "exec" );
+  CORBA::StaticRequest __req( this, "exec", TRUE );
   __req.add_in_arg( &_sa_prog );
   __req.add_in_arg( &_sa_args );
   __req.add_in_arg( &_sa_iorfile );
@@ -12250,7 +12623,7 @@ void MICOCCM::MicoCCMD_stub::callback( const char* _par_token, CORBA::Object_ptr
 {
   CORBA::StaticAny _sa_token( CORBA::_stc_string, &_par_token );
   CORBA::StaticAny _sa_csref( CORBA::_stc_Object, &_par_csref );
-  CORBA::StaticRequest __req( this, "callback" );
+  CORBA::StaticRequest __req( this, "callback", TRUE );
   __req.add_in_arg( &_sa_token );
   __req.add_in_arg( &_sa_csref );
 
@@ -12487,7 +12860,7 @@ MICOCCM::ComponentServer_stub_clp::~ComponentServer_stub_clp ()
 void MICOCCM::ComponentServer_stub::set_config_values( const Components::ConfigValues& _par_config )
 {
   CORBA::StaticAny _sa_config( _marshaller__seq_Components_ConfigValue, &_par_config );
-  CORBA::StaticRequest __req( this, "set_config_values" );
+  CORBA::StaticRequest __req( this, "set_config_values", TRUE );
   __req.add_in_arg( &_sa_config );
 
   __req.invoke();
@@ -12502,6 +12875,25 @@ void MICOCCM::ComponentServer_stub::set_config_values( const Components::ConfigV
 void
 MICOCCM::ComponentServer_stub_clp::set_config_values( const Components::ConfigValues& _par_config )
 {
+  PortableServer::Servant _serv = _preinvoke ();
+  if (_serv) {
+    POA_MICOCCM::ComponentServer * _myserv = POA_MICOCCM::ComponentServer::_narrow (_serv);
+    if (_myserv) {
+      CORBA::StaticAny _sa_config( _marshaller__seq_Components_ConfigValue, &_par_config );
+      CORBA::StaticRequest __req( this, "set_config_values", TRUE );
+      __req.add_in_arg( &_sa_config );
+
+      _invoke_local( _myserv, __req );
+      _myserv->_remove_ref();
+      _postinvoke();
+
+      mico_sii_throw( &__req, 
+        0);
+      return;
+    }
+    _postinvoke ();
+  }
+
   MICOCCM::ComponentServer_stub::set_config_values(_par_config);
 }
 
@@ -18,6 +18,15 @@ public:
     void f ()
     {
     }
+    void op (CORBA::Long)
+    {
+    }
+    void put (const Octets &)
+    {
+    }
+    void put_records (const Records &)
+    {
+    }
     void sync ()
     {
     }
@@ -11,10 +11,36 @@
 #include "bench.h"
 #include "bench_impl.h"
 #include <mico/os-misc.h>
+#include <new>
+#include <stdlib.h>
 
 
 using namespace std;
 
+// count the heap allocations of the client
+static unsigned long allocs = 0;
+
+void *
+operator new (size_t size) throw (std::bad_alloc)
+{
+    ++allocs;
+    void *p = malloc (size ? size : 1);
+    if (!p)
+	throw std::bad_alloc();
+    return p;
+}
+
+#ifdef __GNUC__
+// gcc warns about free() on memory from operator new when it is inlined
+void operator delete (void *) throw () __attribute__ ((noinline));
+#endif
+
+void
+operator delete (void *p) throw ()
+{
+    free (p);
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -33,7 +59,7 @@ main (int argc, char *argv[])
     boa->impl_is_ready (CORBA::ImplementationDef::_nil());
 #endif
 
-    assert (argc == 2);
+    assert (argc == 2 || argc == 3);
     CORBA::Object_var obj = orb->bind ("IDL:Bench:1.0", argv[1]);
     if (CORBA::is_nil (obj)) {
 	cout << "cannot bind to " << argv[1] << endl;
@@ -62,5 +88,63 @@ main (int argc, char *argv[])
     t2 = OSMisc::gettime();
 
     cout << (double)((t2.tv_sec-t1.tv_sec)*1000 + (t2.tv_usec-t1.tv_usec)/1000)/30000 << " ms per call" << endl;
+
+#ifndef NESTED
+    // heap allocations of a call with a small argument. blocks the
+    // buffer pool has to get from malloc count as well.
+    CORBA::Buffer::PoolStats st1, st2;
+    bench->op (0);
+    CORBA::Buffer::pool_stats (st1);
+    unsigned long a = allocs;
+    for (int i = 0; i < 10000; ++i) {
+	bench->op (i);
+    }
+    CORBA::Buffer::pool_stats (st2);
+    a = allocs - a + (st2.misses - st1.misses);
+    cout << (double)a / 10000
+	 << " allocations per call of op(in long)" << endl;
+#endif
+
+#ifndef NESTED
+    // throughput with arguments of the given number of kbytes
+    if (argc == 3) {
+	CORBA::ULong kbytes = atoi (argv[2]);
+	Octets data;
+	data.length (kbytes * 1024);
+	memset (data.get_buffer(), 0, data.length());
+
+	int n = 200 * 1024 / kbytes;
+	t1 = OSMisc::gettime();
+	for (int i = 0; i < n; ++i) {
+	    bench->put (data);
+	}
+	t2 = OSMisc::gettime();
+
+	double secs = (t2.tv_sec-t1.tv_sec) + (t2.tv_usec-t1.tv_usec)/1000000.0;
+	cout << 200 / secs << " MB per second with " << kbytes
+	     << " kB arguments" << endl;
+
+	// struct heavy arguments
+	Records recs;
+	recs.length (10000);
+	for (CORBA::ULong i = 0; i < recs.length(); ++i) {
+	    recs[i].id = i;
+	    recs[i].value = i * 0.5;
+	    recs[i].flags = i & 0xffff;
+	    recs[i].valid = i & 1;
+	    recs[i].stamp = i * 1000;
+	    recs[i].name = (const char *)"x";
+	}
+	bench->put_records (recs);
+	t1 = OSMisc::gettime();
+	for (int i = 0; i < 100; ++i) {
+	    bench->put_records (recs);
+	}
+	t2 = OSMisc::gettime();
+	cout << (double)((t2.tv_sec-t1.tv_sec)*1000 +
+			 (t2.tv_usec-t1.tv_usec)/1000) / 100
+	     << " ms per call with 10000 Records" << endl;
+    }
+#endif
     return 0;
 }
@@ -612,6 +612,30 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::StructDef_var s = CORBA::StructDef::_narrow( obj );
       CORBA::StructMemberSeq_var mem = s->members();
       
+      // members of primitive types bypass the virtual get_*()
+      bool native = false;
+      for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
+	if( use_native_cdr( mem[ i ].type_def ) )
+	  native = true;
+      }
+      if( native ) {
+	o << "if( dc.native_cdr() ) " << BL_OPEN;
+	o << "::CORBA::Buffer *b = dc.buffer();" << endl;
+	o << "return" << endl << indent;
+	for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
+	  if( use_native_cdr( mem[ i ].type_def ) ) {
+	    o << "::CORBA::NativeCDR::get( b, ((_MICO_T*)v)->"
+	      << ID(mem[ i ].name) << " )";
+	  } else {
+	    emit_marshaller_ref( mem[ i ].type_def );
+	    o << "->demarshal( dc, &((_MICO_T*)v)->" << ID(mem[ i ].name);
+	    emit_marshaller_suffix( mem[i].type_def, TRUE );
+	    o << " )";
+	  }
+	  o << (i + 1 < mem->length() ? " &&" : ";") << endl;
+	}
+	o << exdent << BL_CLOSE;
+      }
       o << "return" << endl << indent;
       o << "dc.struct_begin() &&" << endl;
       for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
@@ -676,6 +700,7 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::IDLType_var elem = s->element_type_def();
       CORBA::TypeCode_var tc = elem->type();
       string mname;
+      CORBA::ULong bsize, balign;
 
       o << "::CORBA::ULong len;" << endl;
       o << "if( !dc.seq_begin( len ) )" << endl;
@@ -688,6 +713,17 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	o << indent << "return FALSE;" << exdent << endl;
 	o << BL_CLOSE;
       } else {
+	bool bulk = use_bulk_marshaller (elem, bsize, balign);
+	if (bulk) {
+	  o << "if (len > 0 && sizeof ((*(_MICO_T *)v)[0]) == " << bsize
+	    << " &&" << endl;
+	  o << indent << "dc.bulk_begin (" << balign << ", len, " << bsize
+	    << ")) " << exdent << BL_OPEN;
+	  o << "if (!dc.get_octets (&(*(_MICO_T *)v)[0], len * " << bsize
+	    << "))" << endl;
+	  o << indent << "return FALSE;" << exdent << endl;
+	  o << BL_CLOSE << "else " << BL_OPEN;
+	}
 	o << "for( ::CORBA::ULong i = 0; i < len; i++ ) " << BL_OPEN;
 	o << "if( !";
 	emit_marshaller_ref( elem );
@@ -709,6 +745,8 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	o << " ) )" << endl;
 	o << indent << "return FALSE;" << exdent << endl;
 	o << BL_CLOSE;
+	if (bulk)
+	  o << BL_CLOSE;
       }
       o << "return dc.seq_end();" << endl;
       break;
@@ -720,6 +758,7 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::TypeCode_var tc = elem->type();
       CORBA::ULong len = a->length();
       string mname;
+      CORBA::ULong bsize, balign;
 
       o << "if( !dc.arr_begin() )" << endl;
       o << indent << "return FALSE;" << exdent << endl;
@@ -731,6 +770,16 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	  o << indent << "return FALSE;" << exdent << endl;
 	}
       } else {
+	bool bulk = use_bulk_marshaller (elem, bsize, balign);
+	if (bulk) {
+	  o << "if (sizeof (((_MICO_T *)v)[0]) == " << bsize << " &&" << endl;
+	  o << indent << "dc.bulk_begin (" << balign << ", " << len << ", "
+	    << bsize << ")) " << exdent << BL_OPEN;
+	  o << "if (!dc.get_octets (&((_MICO_T *)v)[0], " << len * bsize
+	    << "))" << endl;
+	  o << indent << "return FALSE;" << exdent << endl;
+	  o << BL_CLOSE << "else " << BL_OPEN;
+	}
         o << "for( ::CORBA::ULong i = 0; i < " << len << "; i++ ) " << BL_OPEN;
 	o << "if( !";
 	emit_marshaller_ref( elem );
@@ -739,6 +788,8 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	o << " ) )" << endl;
 	o << indent << "return FALSE;" << exdent << endl;
 	o << BL_CLOSE;
+	if (bulk)
+	  o << BL_CLOSE;
       }
       o << "return dc.arr_end();" << endl;
       break;
@@ -850,6 +901,28 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::StructDef_var s = CORBA::StructDef::_narrow( obj );
       CORBA::StructMemberSeq_var mem = s->members();
       
+      bool native = false;
+      for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
+	if( use_native_cdr( mem[ i ].type_def ) )
+	  native = true;
+      }
+      if( native ) {
+	o << "if( ec.native_cdr() ) " << BL_OPEN;
+	o << "::CORBA::Buffer *b = ec.buffer();" << endl;
+	for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
+	  if( use_native_cdr( mem[ i ].type_def ) ) {
+	    o << "::CORBA::NativeCDR::put( b, ((_MICO_T*)v)->"
+	      << ID(mem[ i ].name) << " );" << endl;
+	  } else {
+	    emit_marshaller_ref( mem[ i ].type_def );
+	    o << "->marshal( ec, &((_MICO_T*)v)->" << ID(mem[ i ].name);
+	    emit_marshaller_suffix( mem[i].type_def, FALSE );
+	    o << " );" << endl;
+	  }
+	}
+	o << "return;" << endl;
+	o << BL_CLOSE;
+      }
       o << "ec.struct_begin();" << endl;
       for( CORBA::ULong i = 0; i < mem->length(); i++ ) {
 	emit_marshaller_ref( mem[ i ].type_def );
@@ -904,6 +977,7 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::IDLType_var elem = s->element_type_def();
       CORBA::TypeCode_var tc = elem->type();
       string mname;
+      CORBA::ULong bsize, balign;
       
       o << "::CORBA::ULong len = ((_MICO_T *) v)->length();" << endl;
       o << "ec.seq_begin( len );" << endl;
@@ -913,6 +987,16 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	o << "ec.put_" << mname << " (&(*(_MICO_T *)v)[0], len);" << endl;
 	o << BL_CLOSE;
       } else {
+	bool bulk = use_bulk_marshaller (elem, bsize, balign);
+	if (bulk) {
+	  o << "if (len > 0 && sizeof ((*(_MICO_T *)v)[0]) == " << bsize
+	    << " &&" << endl;
+	  o << indent << "ec.bulk_begin (" << balign << ", len, " << bsize
+	    << ")) " << exdent << BL_OPEN;
+	  o << "ec.put_octets (&(*(_MICO_T *)v)[0], len * " << bsize << ");"
+	    << endl;
+	  o << BL_CLOSE << "else " << BL_OPEN;
+	}
 	o << "for( ::CORBA::ULong i = 0; i < len; i++ )" << endl;
 	o << indent;
 	emit_marshaller_ref( elem );
@@ -933,6 +1017,8 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	emit_marshaller_suffix( elem, FALSE );
 	o << " );" << endl;
 	o << exdent;
+	if (bulk)
+	  o << BL_CLOSE;
       }
       o << "ec.seq_end();" << endl;
       break;
@@ -944,6 +1030,7 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
       CORBA::TypeCode_var tc = elem->type();
       CORBA::ULong len = a->length();
       string mname;
+      CORBA::ULong bsize, balign;
       
       o << "ec.arr_begin();" << endl;
 
@@ -953,6 +1040,15 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	    << endl;
 	}
       } else {
+	bool bulk = use_bulk_marshaller (elem, bsize, balign);
+	if (bulk) {
+	  o << "if (sizeof (((_MICO_T *)v)[0]) == " << bsize << " &&" << endl;
+	  o << indent << "ec.bulk_begin (" << balign << ", " << len << ", "
+	    << bsize << ")) " << exdent << BL_OPEN;
+	  o << "ec.put_octets (&((_MICO_T *)v)[0], " << len * bsize << ");"
+	    << endl;
+	  o << BL_CLOSE << "else " << BL_OPEN;
+	}
         o << "for( ::CORBA::ULong i = 0; i < " << len << "; i++ )" << endl;
 	o << indent;
 	emit_marshaller_ref( elem );
@@ -960,6 +1056,8 @@ CodeGenCPPStub::emit_marshaller( CORBA::IRObject_ptr obj )
 	emit_marshaller_suffix( elem, FALSE );
 	o << " );" << endl;
 	o << exdent;
+	if (bulk)
+	  o << BL_CLOSE;
       }
       o << "ec.arr_end();" << endl;
       break;
@@ -1069,7 +1167,6 @@ void CodeGenCPPStub::emit_sii_stub_method( string &absClassName,
 					   const CORBA::OperationDescription &op,
 					   CORBA::IDLType_ptr result )
 {
-  CORBA::TypeCode_var tc_result = result->type();
   emit_type_for_result( result );
   o << " " << absClassName << _STUB << "::" << ID(op.name) << "(";
   const CORBA::ParDescriptionSeq &p = op.parameters;
@@ -1095,6 +1192,23 @@ void CodeGenCPPStub::emit_sii_stub_method( string &absClassName,
     o << " ";
   o << ")" << endl;
   o << BL_OPEN;
+  emit_sii_stub_body( dispatch_name, op, result, 0 );
+  o << BL_CLOSE << endl << endl;
+}
+
+/*
+ * The body of a SII stub method. If servant is given, the request is
+ * passed to this colocated servant, see StubBase::_invoke_local().
+ */
+void CodeGenCPPStub::emit_sii_stub_body( string &dispatch_name,
+					 const CORBA::OperationDescription &op,
+					 CORBA::IDLType_ptr result,
+					 const char *servant )
+{
+  CORBA::TypeCode_var tc_result = result->type();
+  const CORBA::ParDescriptionSeq &p = op.parameters;
+  const CORBA::ContextIdSeq& ctx = op.contexts;
+  CORBA::ULong k;
 
   // Generate StaticAny's for arguments and result
   for( k = 0; k < p.length(); k++ ) {
@@ -1137,9 +1251,10 @@ void CodeGenCPPStub::emit_sii_stub_method( string &absClassName,
     o << endl << endl;
   }
   
-  // Generate marshalling code
+  // Generate marshalling code, the operation name is a literal
+  // that outlives the request
   o << "CORBA::StaticRequest __req( this, \"" << dispatch_name
-    << "\" );" << endl;
+    << "\", TRUE );" << endl;
 
   // Marshall context
   if( ctx.length() > 0 ) {
@@ -1172,7 +1287,11 @@ void CodeGenCPPStub::emit_sii_stub_method( string &absClassName,
     o << "__req.set_result( &__res );" << endl;
   o << endl;
 
-  if( op.mode == CORBA::OP_NORMAL )
+  if( servant ) {
+    o << "_invoke_local( " << servant << ", __req );" << endl;
+    o << servant << "->_remove_ref();" << endl;
+    o << "_postinvoke();" << endl << endl;
+  } else if( op.mode == CORBA::OP_NORMAL )
     o << "__req.invoke();" << endl << endl;
   else
     o << "__req.oneway();" << endl << endl;
@@ -1231,9 +1350,9 @@ void CodeGenCPPStub::emit_sii_stub_method( string &absClassName,
       o << "_res;";
     }
     o << endl;
+  } else if( servant ) {
+    o << "return;" << endl;
   }
-
-  o << BL_CLOSE << endl << endl;
 }
 
 void
@@ -1273,8 +1392,8 @@ CodeGenCPPStub::emit_poa_stub_method (string &absClassName,
   o << BL_OPEN;
 
   /*
-   * If valuetypes may be shared across parameters, we give up and
-   * just fall back to using the stub.
+   * If valuetypes may be shared across parameters, we cannot copy
+   * them one by one and pass them through a buffer instead.
    */
 
   if (check_simple_clp_call (op) &&
@@ -1311,15 +1430,10 @@ CodeGenCPPStub::emit_poa_stub_method (string &absClassName,
      * We also don't handle valuetypes contained in a structured type
      * (struct, union, sequence, array). So if this operation takes a
      * parameter with some structured type that contains a valuetype,
-     * we do not enter this block at all but fall back to marshalling
-     * everything, using the stub; see check_simple_clp_call() above.
+     * we do not enter this block at all but marshal everything into a
+     * buffer; see check_simple_clp_call() above and the else branch.
      * The return value of check_simple_clp_call() must be well-adjusted
      * to our capabilities here.
-     *
-     * Not yet implemented is the possibility to marshal and unmarshal
-     * all (or just the selected) parameters using a SimpleBuffer, which
-     * should still be much faster than going all the way through the ORB.
-     * But this is already much too complex for my taste.
      */
     
     for (i=0; i<p.length(); i++) {
@@ -1588,6 +1702,24 @@ CodeGenCPPStub::emit_poa_stub_method (string &absClassName,
     o << "_postinvoke ();" << endl;
     o << BL_CLOSE << endl;
   }
+  else {
+    /*
+     * The parameters are too complex to be copied here. The stub's
+     * request is handed to the colocated servant directly, which
+     * copies all parameters through a CDR buffer like a remote
+     * call would, but without the ORB.
+     */
+
+    o << "PortableServer::Servant _serv = _preinvoke ();" << endl;
+    o << "if (_serv) " << BL_OPEN;
+    o << "POA_" << absClassName << " * _myserv = ";
+    o << "POA_" << absClassName << "::_narrow (_serv);" << endl;
+    o << "if (_myserv) " << BL_OPEN;
+    emit_sii_stub_body (dispatch_name, op, result, "_myserv");
+    o << BL_CLOSE;
+    o << "_postinvoke ();" << endl;
+    o << BL_CLOSE << endl;
+  }
 
   /*
    * Either the servant is not colocated, not realized by a POA, or
@@ -40,6 +40,10 @@ private:
 			     std::string &dispatch_name,
 			     const CORBA::OperationDescription &op,
 			     CORBA::IDLType_ptr result );
+  void emit_sii_stub_body( std::string &dispatch_name,
+			   const CORBA::OperationDescription &op,
+			   CORBA::IDLType_ptr result,
+			   const char *servant );
   void emit_poa_stub_method( std::string &absClassName,
 			     std::string &dispatch_name,
 			     const CORBA::OperationDescription &op,
@@ -2648,6 +2648,190 @@ CodeGenCPPUtil::use_builtin_marshaller( CORBA::TypeCode_ptr tc, string &name )
 
 
 
+/*
+ * sequences and arrays of structs whose CDR representation is the same
+ * as their C++ representation are copied with put_octets()/get_octets().
+ * this is the case for structs of integers and floating point numbers
+ * (and nested structs and arrays of them) without padding that CDR
+ * does not have. with #pragma bulk_marshal <struct> on booleans, chars
+ * and enums are allowed too, off disables the bulk copy.
+ *
+ * the layout is computed for natural alignment; the generated code
+ * also compares sizeof(struct) with the CDR size, which fails on ABIs
+ * that align differently.
+ */
+
+static CORBA::ULong
+bulk_size( CORBA::TypeCode_ptr tc, bool force )
+{
+  switch( tc->kind() ) {
+  case CORBA::tk_octet:
+    return 1;
+  case CORBA::tk_boolean:
+  case CORBA::tk_char:
+    return force ? 1 : 0;
+  case CORBA::tk_short:
+  case CORBA::tk_ushort:
+    return 2;
+  case CORBA::tk_long:
+  case CORBA::tk_ulong:
+  case CORBA::tk_float:
+    return 4;
+  case CORBA::tk_enum:
+    return force ? 4 : 0;
+  case CORBA::tk_longlong:
+  case CORBA::tk_ulonglong:
+  case CORBA::tk_double:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+static CORBA::ULong
+round_up( CORBA::ULong off, CORBA::ULong align )
+{
+  return (off + align - 1) / align * align;
+}
+
+// largest alignment of the members of tc, 0 if tc cannot be copied
+CORBA::ULong
+CodeGenCPPUtil::bulk_align( CORBA::TypeCode_ptr _tc, bool force )
+{
+  CORBA::TypeCode_ptr tc = _tc->unalias();
+  switch( tc->kind() ) {
+  case CORBA::tk_struct: {
+    CORBA::ULong align = 0;
+    for( CORBA::ULong i = 0; i < tc->member_count(); i++ ) {
+      CORBA::TypeCode_var m = tc->member_type( i );
+      CORBA::ULong a = bulk_align( m, force );
+      if( a == 0 )
+	return 0;
+      if( a > align )
+	align = a;
+    }
+    return align;
+  }
+  case CORBA::tk_array: {
+    CORBA::TypeCode_var c = tc->content_type();
+    return bulk_align( c, force );
+  }
+  default:
+    return bulk_size( tc, force );
+  }
+}
+
+/*
+ * lay out tc at CDR offset cdr and C++ offset native and advance both.
+ * false if a member ends up at different offsets. first is set to the
+ * size of the first primitive member.
+ */
+bool
+CodeGenCPPUtil::bulk_layout( CORBA::TypeCode_ptr _tc, bool force,
+			     CORBA::ULong &cdr, CORBA::ULong &native,
+			     CORBA::ULong &first )
+{
+  CORBA::TypeCode_ptr tc = _tc->unalias();
+  switch( tc->kind() ) {
+  case CORBA::tk_struct: {
+    CORBA::ULong align = bulk_align( tc, force );
+    if( align == 0 )
+      return false;
+    native = round_up( native, align );
+    for( CORBA::ULong i = 0; i < tc->member_count(); i++ ) {
+      CORBA::TypeCode_var m = tc->member_type( i );
+      if( !bulk_layout( m, force, cdr, native, first ) )
+	return false;
+    }
+    native = round_up( native, align );
+    return true;
+  }
+  case CORBA::tk_array: {
+    // the other elements are laid out like the first one if its
+    // size is a multiple of its alignment
+    CORBA::TypeCode_var c = tc->content_type();
+    CORBA::ULong align = bulk_align( c, force );
+    CORBA::ULong start = cdr;
+    if( align == 0 || !bulk_layout( c, force, cdr, native, first ) )
+      return false;
+    CORBA::ULong size = cdr - start;
+    if( size % align != 0 )
+      return false;
+    cdr += (tc->length() - 1) * size;
+    native += (tc->length() - 1) * size;
+    return true;
+  }
+  default: {
+    CORBA::ULong size = bulk_size( tc, force );
+    if( size == 0 )
+      return false;
+    if( first == 0 )
+      first = size;
+    cdr = round_up( cdr, size );
+    native = round_up( native, size );
+    if( cdr != native )
+      return false;
+    cdr += size;
+    native += size;
+    return true;
+  }
+  }
+}
+
+bool
+CodeGenCPPUtil::use_bulk_marshaller( CORBA::IDLType_ptr t, CORBA::ULong &size,
+				     CORBA::ULong &align )
+{
+  CORBA::IDLType_var st = resolve_alias( t );
+  if( st->def_kind() != CORBA::dk_Struct )
+    return false;
+
+  CORBA::StructDef_var s = CORBA::StructDef::_narrow( st );
+  CORBA::String_var name = s->absolute_name();
+  bool force = false;
+  if( _db->get_bulk_marshal( name.in(), force ) && !force )
+    return false;
+
+  CORBA::TypeCode_var tc = st->type();
+  align = bulk_align( tc, force );
+  if( align == 0 )
+    return false;
+
+  // the data is aligned to align, just like CDR aligns the first member
+  CORBA::ULong cdr = 0, native = 0, first = 0;
+  if( !bulk_layout( tc, force, cdr, native, first ) ||
+      first != align || cdr != native )
+    return false;
+  size = cdr;
+  return true;
+}
+
+/*
+ * struct members of these types are coded with the inline functions of
+ * CORBA::NativeCDR if the codec uses the byte order of the machine.
+ */
+bool
+CodeGenCPPUtil::use_native_cdr( CORBA::IDLType_ptr t )
+{
+  CORBA::TypeCode_var tc = t->type();
+  switch( tc->unalias()->kind() ) {
+  case CORBA::tk_octet:
+  case CORBA::tk_boolean:
+  case CORBA::tk_short:
+  case CORBA::tk_ushort:
+  case CORBA::tk_long:
+  case CORBA::tk_ulong:
+  case CORBA::tk_longlong:
+  case CORBA::tk_ulonglong:
+  case CORBA::tk_float:
+  case CORBA::tk_double:
+    return true;
+  default:
+    return false;
+  }
+}
+
+
 CORBA::IDLType_ptr
 CodeGenCPPUtil::resolve_alias(CORBA::IDLType_ptr alias)
 {
@@ -153,6 +153,12 @@ protected:
   void emit_release( CORBA::IDLType_ptr, const char *var_name );
 
   bool use_builtin_marshaller( CORBA::TypeCode_ptr, std::string &name );
+  bool use_bulk_marshaller( CORBA::IDLType_ptr, CORBA::ULong &size,
+			    CORBA::ULong &align );
+  CORBA::ULong bulk_align( CORBA::TypeCode_ptr, bool force );
+  bool bulk_layout( CORBA::TypeCode_ptr, bool force, CORBA::ULong &cdr,
+		    CORBA::ULong &native, CORBA::ULong &first );
+  bool use_native_cdr( CORBA::IDLType_ptr );
 
   CORBA::IDLType_ptr resolve_alias(CORBA::IDLType_ptr alias);
 
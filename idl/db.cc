@@ -313,6 +313,20 @@ void DB::set_repo_id( const string& name, const string& id )
   _id.push_back( id );
 }
 
+void DB::set_bulk_marshal( const string& name, bool on )
+{
+  _bulk_marshal[ name ] = on;
+}
+
+bool DB::get_bulk_marshal( const string& name, bool &on ) const
+{
+  NameBulkMap::const_iterator it = _bulk_marshal.find( name );
+  if( it == _bulk_marshal.end() )
+    return false;
+  on = (*it).second;
+  return true;
+}
+
 void DB::set_prefix( const string& name, const string& prefix )
 {
   _prefix_name.push_back( name );
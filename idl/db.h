@@ -75,6 +75,9 @@ private:
   std::vector<std::string>  _prefix_name;
   std::vector<std::string>  _prefix;
 
+  typedef std::map<std::string, bool, std::less<std::string> > NameBulkMap;
+  NameBulkMap _bulk_marshal;
+
   void gen_pseudo_repoid( CORBA::IDLType_ptr t, PseudoRepoId &pseudo_id );
 
 public:
@@ -105,6 +108,10 @@ public:
   void set_repo_id( const std::string& name, const std::string& id );
   void set_repoids( CORBA::Repository_ptr repo );
 
+  // #pragma bulk_marshal <name> on|off
+  void set_bulk_marshal( const std::string& name, bool on );
+  bool get_bulk_marshal( const std::string& name, bool &on ) const;
+
   void add_forward_dcl( const char* scoped_name );
   void remove_forward_dcl( const char* scoped_name );
   bool is_in_forward_dcl( const char* scoped_name );
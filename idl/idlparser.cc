@@ -686,6 +686,19 @@ IDLParser::collectPragma( CORBA::Container_ptr con, ParseNode *node )
       check_pragma_syntax( j > i, node );
       value = s.substr( i + 1, j - i - 1 );
     }
+    else if( dir == "bulk_marshal" ) {
+      j = s.find_first_of( " \t", i );
+      check_pragma_syntax( j > i, node );
+      name = s.substr( i, j - i );
+
+      i = s.find_first_not_of( " \t", j );
+      check_pragma_syntax( i > j, node );
+      j = s.find_first_of( " \t\r\n", i );
+      if( j < 0 )
+	j = s.length();
+      value = s.substr( i, j - i );
+      check_pragma_syntax( value == "on" || value == "off", node );
+    }
     else {
       /*
        * ignore unknown pragma
@@ -724,6 +737,9 @@ IDLParser::collectPragma( CORBA::Container_ptr con, ParseNode *node )
   else if (dir == "ID") {
     _db->set_repo_id (name, value);
   }
+  else if (dir == "bulk_marshal") {
+    _db->set_bulk_marshal (name, value == "on");
+  }
 }
 
 void IDLParser::check_pragma_syntax( bool condition, ParseNode *node )
@@ -30,6 +30,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstddef> // for wchar_t
+#include <cstring>
 #ifndef _POCKET_PC
 #include <sys/types.h>
 #include <cerrno>
@@ -204,6 +205,7 @@ namespace PInterceptor
 #include <mico/timebase.h>
 
 #include <mico/mttypes.h>
+#include <mico/metrics.h>
 #ifdef THREADING_POLICIES
 #include <mico/mtpolicy.h>
 #endif // THREADING_POLICIES
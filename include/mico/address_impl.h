@@ -140,10 +140,17 @@ public:
 
 #ifdef HAVE_SYS_UN_H
 class UnixAddress : public CORBA::Address {
+public:
+    enum Family {
+	STREAM,
+	SHM
+    };
+private:
     std::string _filename;
+    Family _family;
 public:
-    UnixAddress (struct sockaddr_un &una);
-    UnixAddress (const char *filename = 0);
+    UnixAddress (struct sockaddr_un &una, Family = STREAM);
+    UnixAddress (const char *filename = 0, Family = STREAM);
     ~UnixAddress ();
 
     std::string stringify () const;
@@ -167,6 +174,9 @@ public:
 
     void sockaddr (struct sockaddr_un &);
     struct sockaddr_un sockaddr () const;
+
+    void family (Family f);
+    Family family () const;
 };
 
 class UnixAddressParser : public CORBA::AddressParser {
@@ -30,18 +30,52 @@ class Buffer {
     enum {
 	MINSIZE = 128,
 	RESIZE_THRESH = 10000,
-	RESIZE_INCREMENT = 10000
+	LOAN_MIN = 4096
     };
     Boolean _readonly;
     ULong _rptr, _wptr;
     ULong _ralignbase, _walignbase;
     ULong _len;
     Octet *_buf;
+    // set while SequenceLoans refer to _buf, see loan()
+    BufferShare *_share;
 
-    Octet *alloc (ULong sz);
-    Octet *realloc (Octet *, ULong osz, ULong nsz);
-    void free (Octet *);
+    static Octet *alloc (ULong &sz);
+    static Octet *realloc (Octet *, ULong osz, ULong &nsz);
+    static void free (Octet *, ULong sz);
+
+    friend class ::SequenceLoan;
+    static Boolean unshare (BufferShare *);
+    Boolean unshare ();
+    void copy_shared ();
 public:
+    /*
+     * Buffers of up to 64k are recycled through a per thread pool of
+     * power of two sized blocks. The limit caps the memory each thread
+     * keeps in its pool, zero disables pooling.
+     */
+    struct PoolStats {
+	ULong hits;
+	ULong misses;
+	ULong pooled;
+    };
+    static void _init ();
+    static void pool_limit (ULong bytes);
+    static ULong pool_limit ();
+    static void pool_stats (PoolStats &);
+
+    /*
+     * Small objects the ORB creates for every request (buffers,
+     * invocation records) take their memory from the same pool.
+     */
+    static void *pool_alloc (size_t sz);
+    static void pool_free (void *, size_t sz);
+
+    static void *operator new (size_t sz)
+    { return pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { pool_free (p, sz); }
+
     Buffer (void *);
     Buffer (ULong sz = 0);
     Buffer (const Buffer &);
@@ -117,9 +151,20 @@ public:
     Boolean get8 (void *);
     Boolean get16 (void *);
 
+    /*
+     * Lends the next len octets to a sequence and skips them. The
+     * sequence keeps the memory alive after the buffer is gone or
+     * reused, the buffer then continues with a copy. Returns 0 if a
+     * copy is cheaper, i.e. for short loans or loans that would keep
+     * a much larger buffer alive.
+     */
+    SequenceLoan *loan (ULong len);
+
     void wseek_rel (Long offs)
     {
 	assert (!_readonly);
+	if (_share)
+	    copy_shared ();
 	assert (_wptr + offs >= _rptr &&
 		_wptr + offs <= _len);
 	_wptr += offs;
@@ -127,6 +172,8 @@ public:
     void wseek_beg (ULong offs)
     {
 	assert (!_readonly);
+	if (_share)
+	    copy_shared ();
 	assert (offs >= _rptr &&
 		offs <= _len);
 	_wptr = offs;
@@ -134,6 +181,8 @@ public:
     void wseek_end (ULong offs)
     {
 	assert (!_readonly);
+	if (_share)
+	    copy_shared ();
 	assert (_len - offs >= _rptr);
 	_wptr = _len - offs;
     }
@@ -94,6 +94,19 @@ public:
 	}
     };
 
+    /*
+     * a flush callback takes the data marshaled so far out of the
+     * buffer while the encoder is still at work. bulk data larger than
+     * the flush size is marshaled in pieces and the callback is
+     * invoked between them, but never while buffer positions are
+     * remembered for patching them later (encapsulations, valuetypes).
+     */
+    class FlushCallback {
+    public:
+	virtual ~FlushCallback ();
+	virtual void flush (DataEncoder *) = 0;
+    };
+
 protected:
     Buffer *buf;
     Boolean dofree_buf;
@@ -101,6 +114,11 @@ protected:
     Boolean dofree_conv;
     ValueState *vstate;
     Boolean dofree_vstate;
+    FlushCallback *flush_cb;
+    ULong flush_sz;
+    ULong flush_locked;
+    // set by codecs whose primitive types NativeCDR can write
+    Boolean native;
 
 public:
     DataEncoder ();
@@ -169,6 +187,13 @@ public:
     void put_string_raw (const std::string &s);
     virtual void put_buffer (const Buffer &);
     virtual void put_octets (const void *, ULong len);
+    /*
+     * TRUE if count values of size octets each can be put with
+     * put_octets() exactly as they are laid out in memory, after
+     * aligning to align. used by generated code for sequences and
+     * arrays of structs without padding.
+     */
+    virtual Boolean bulk_begin (ULong align, ULong count, ULong size);
 
     virtual void enumeration (ULong);
 
@@ -233,6 +258,19 @@ public:
     { return vstate; }
 
     void valuestate (ValueState *vs, Boolean dofree = TRUE);
+
+    // may primitive types be written with NativeCDR::put()?
+    Boolean native_cdr () const
+    { return native; }
+
+    FlushCallback *flush_callback ()
+    { return flush_cb; }
+
+    ULong flush_size () const
+    { return flush_sz; }
+
+    void flush_callback (FlushCallback *cb, ULong size);
+    void flush ();
 };
 
 
@@ -301,6 +339,8 @@ protected:
     Boolean dofree_conv;
     ValueState *vstate;
     Boolean dofree_vstate;
+    // set by codecs whose primitive types NativeCDR can read
+    Boolean native;
 
     Boolean get_indirect_string (std::string &s);
     Boolean get_indirect_string_seq (std::vector<std::string> &s);
@@ -366,6 +406,14 @@ public:
     Boolean get_string_stl (std::string &);
     Boolean get_string_raw_stl (std::string &);
     virtual Boolean get_octets (void *, ULong len);
+    // see DataEncoder::bulk_begin(), also checks count*size octets are there
+    virtual Boolean bulk_begin (ULong align, ULong count, ULong size);
+    /*
+     * lend the next len octets or chars to a sequence instead of
+     * copying them, see Buffer::loan(). 0 if they must be copied.
+     */
+    virtual SequenceLoan *loan_octets (ULong len);
+    virtual SequenceLoan *loan_chars (ULong len);
 
     virtual Boolean enumeration (ULong &);
 
@@ -443,6 +491,81 @@ public:
     { return vstate; }
 
     void valuestate (ValueState *vs, Boolean dofree = TRUE);
+
+    // are we inside a chunked value?
+    Boolean chunking () const
+    { return vstate && vstate->s.chunking; }
+
+    // may primitive types be read with NativeCDR::get()?
+    Boolean native_cdr () const
+    { return native && !chunking(); }
+};
+
+
+/*
+ * Inline CDR coding of primitive types in the byte order of this
+ * machine. Generated marshallers use it instead of the virtual
+ * put_*() and get_*() functions when native_cdr() of the encoder or
+ * decoder says so, i.e. for CDR in the byte order of this machine.
+ * Chars and strings are not covered, they may need conversion.
+ */
+class NativeCDR {
+    template<class T>
+    static void _put (Buffer *b, T v)
+    {
+	b->walign (sizeof (T));
+	b->resize (sizeof (T));
+	memcpy (b->wdata(), &v, sizeof (T));
+	b->wseek_rel (sizeof (T));
+    }
+    template<class T>
+    static Boolean _get (Buffer *b, T &v)
+    {
+	if (!b->ralign (sizeof (T)) || b->length() < sizeof (T))
+	    return FALSE;
+	memcpy (&v, b->data(), sizeof (T));
+	b->rseek_rel (sizeof (T));
+	return TRUE;
+    }
+public:
+    // Octet and Boolean are the same type
+    static void put (Buffer *b, Octet v)
+    { _put (b, v); }
+    static void put (Buffer *b, Short v)
+    { _put (b, v); }
+    static void put (Buffer *b, UShort v)
+    { _put (b, v); }
+    static void put (Buffer *b, Long v)
+    { _put (b, v); }
+    static void put (Buffer *b, ULong v)
+    { _put (b, v); }
+    static void put (Buffer *b, LongLong v)
+    { _put (b, v); }
+    static void put (Buffer *b, ULongLong v)
+    { _put (b, v); }
+    static void put (Buffer *b, Float v)
+    { _put (b, v); }
+    static void put (Buffer *b, Double v)
+    { _put (b, v); }
+
+    static Boolean get (Buffer *b, Octet &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, Short &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, UShort &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, Long &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, ULong &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, LongLong &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, ULongLong &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, Float &v)
+    { return _get (b, v); }
+    static Boolean get (Buffer *b, Double &v)
+    { return _get (b, v); }
 };
 
 }
@@ -36,6 +36,12 @@ public:
 		ValueState *vs = 0, CORBA::Boolean dofree_vs = TRUE);
     ~CDREncoder ();
 
+    // every GIOP message gets its own
+    static void *operator new (size_t sz)
+    { return CORBA::Buffer::pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { CORBA::Buffer::pool_free (p, sz); }
+
     using CORBA::DataEncoder::reset;
     void reset(CORBA::Buffer *b, CORBA::Boolean dofree_b,
                CORBA::CodeSetCoder *c, CORBA::Boolean dofree_c);
@@ -89,6 +95,8 @@ public:
     void put_chars_raw (const CORBA::Char *, CORBA::ULong);
     void put_wchars (const CORBA::WChar *, CORBA::ULong);
     void put_booleans (const CORBA::Boolean *, CORBA::ULong);
+    CORBA::Boolean bulk_begin (CORBA::ULong align, CORBA::ULong count,
+			       CORBA::ULong size);
 
     CORBA::ULong max_alignment () const;
     
@@ -106,6 +114,12 @@ public:
                 CORBA::CodeSetCoder *c = 0, CORBA::Boolean dofree_c = TRUE,
 		ValueState *vs = 0, CORBA::Boolean dofree_vs = TRUE);
     ~CDRDecoder ();
+
+    // every GIOP message gets its own
+    static void *operator new (size_t sz)
+    { return CORBA::Buffer::pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { CORBA::Buffer::pool_free (p, sz); }
     
     CORBA::DataDecoder *clone () const;
     CORBA::DataDecoder *clone (CORBA::Buffer *b,
@@ -155,6 +169,10 @@ public:
     CORBA::Boolean get_chars_raw (CORBA::Char *, CORBA::ULong);
     CORBA::Boolean get_wchars (CORBA::WChar *, CORBA::ULong);
     CORBA::Boolean get_booleans (CORBA::Boolean *, CORBA::ULong);
+    CORBA::Boolean bulk_begin (CORBA::ULong align, CORBA::ULong count,
+			       CORBA::ULong size);
+    SequenceLoan *loan_octets (CORBA::ULong len);
+    SequenceLoan *loan_chars (CORBA::ULong len);
 
     CORBA::ULong max_alignment () const;
 
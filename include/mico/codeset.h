@@ -127,6 +127,12 @@ public:
   virtual CodeSetCoder * clone () = 0;
   virtual CORBA::Boolean isok () = 0;
 
+  /*
+   * transmission code sets for chars and wide chars, 0 if none
+   */
+  virtual CORBA::Codeset::CodesetId tcs_c () = 0;
+  virtual CORBA::Codeset::CodesetId tcs_w () = 0;
+
   /*
    * Decode
    */
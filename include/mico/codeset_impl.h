@@ -127,6 +127,14 @@ protected:
   
   CORBA::Long convert (const char *from, CORBA::ULong len,
 		       char *to);
+  // single pass conversion of common Unicode code sets, -1 if the
+  // data needs convert()
+  CORBA::Long put_direct (const CORBA::Octet *from, CORBA::ULong size,
+			  CORBA::ULong len, CORBA::Buffer &to,
+			  CORBA::Boolean terminate);
+  CORBA::Long get_direct (CORBA::Buffer &from, CORBA::ULong len,
+			  CORBA::Octet *to, CORBA::ULong size,
+			  CORBA::Boolean terminate);
 public:
   ~UniCodesetConv ();
   
@@ -172,6 +180,8 @@ public:
   
   CORBA::CodeSetCoder * clone ();
   CORBA::Boolean isok ();
+  CORBA::Codeset::CodesetId tcs_c ();
+  CORBA::Codeset::CodesetId tcs_w ();
   
   CORBA::Boolean get_char (CORBA::DataDecoder &, CORBA::Char &);
   CORBA::Boolean get_chars (CORBA::DataDecoder &, CORBA::Char *, CORBA::ULong);
@@ -219,6 +229,8 @@ public:
 
   CORBA::CodeSetCoder * clone ();
   CORBA::Boolean isok ();
+  CORBA::Codeset::CodesetId tcs_c ();
+  CORBA::Codeset::CodesetId tcs_w ();
   
   CORBA::Boolean get_char (CORBA::DataDecoder &, CORBA::Char &);
   CORBA::Boolean get_chars (CORBA::DataDecoder &, CORBA::Char *, CORBA::ULong);
@@ -270,6 +282,7 @@ public:
   
   CORBA::CodeSetCoder * clone ();
   CORBA::Boolean isok ();
+  CORBA::Codeset::CodesetId tcs_w ();
   
   CORBA::Boolean get_wchar (CORBA::DataDecoder &, CORBA::WChar &);
   CORBA::Boolean get_wchars (CORBA::DataDecoder &, CORBA::WChar *, CORBA::ULong);
@@ -0,0 +1,118 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 2004-2010 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_epoll_dispatcher_h__
+#define __mico_epoll_dispatcher_h__
+
+namespace MICO {
+
+/*
+ * Dispatcher based on the Linux epoll(7) interface. File events are
+ * kept in a table indexed by file descriptor and the kernel keeps the
+ * interest set, so registering, removing and waking up costs do not
+ * depend on the number of watched descriptors.
+ *
+ * In edge-triggered mode a callback is only invoked when the state of
+ * its descriptor changes, so callbacks must consume all available
+ * input (resp. fill the output buffer) before returning.
+ */
+class EpollDispatcher : public CORBA::Dispatcher {
+    struct Handler {
+        Event event;
+        CORBA::DispatcherCallback *cb;
+
+        Handler () {}
+        Handler (Event _ev, CORBA::DispatcherCallback *_cb)
+            : event(_ev), cb(_cb)
+        {}
+    };
+    struct FileEvent {
+        CORBA::Long fd;
+        CORBA::ULong mask;
+        std::vector<Handler> handlers;
+
+        FileEvent (CORBA::Long _fd)
+            : fd(_fd), mask(0)
+        {}
+    };
+    typedef std::vector<CORBA::Long> FDVec;
+    typedef std::map<CORBA::DispatcherCallback *, FDVec> CBMap;
+
+    int epfd;
+    CORBA::Boolean edge_triggered;
+
+    // indexed by file descriptor
+    std::vector<FileEvent *> fevents;
+    // file descriptors each callback is registered for
+    CBMap cbfds;
+    CORBA::ULong nfevents;
+    TimerWheel tevents;
+    std::vector<struct epoll_event> evbuf;
+
+    CORBA::Long gettime () const;
+    void add_fevent (Event, CORBA::DispatcherCallback *, CORBA::Long fd);
+    void del_fevent (CORBA::Long fd, CORBA::DispatcherCallback *, Event);
+    CORBA::Boolean has_handler (CORBA::Long fd, const Handler &) const;
+    void update_interest (FileEvent *);
+    void handle_tevents ();
+    void handle_fevents (int nevents);
+    CORBA::Long sleeptime ();
+
+    static CORBA::Boolean _isblocking;
+public:
+    EpollDispatcher (CORBA::Boolean edge_triggered = FALSE);
+    virtual ~EpollDispatcher ();
+    virtual void rd_event (CORBA::DispatcherCallback *, CORBA::Long fd);
+    virtual void wr_event (CORBA::DispatcherCallback *, CORBA::Long fd);
+    virtual void ex_event (CORBA::DispatcherCallback *, CORBA::Long fd);
+    virtual void tm_event (CORBA::DispatcherCallback *, CORBA::ULong tmout);
+    virtual void remove (CORBA::DispatcherCallback *, Event);
+    virtual void move (CORBA::Dispatcher *);
+    virtual void run (CORBA::Boolean infinite = TRUE);
+    virtual CORBA::Boolean idle () const;
+
+    virtual void block(CORBA::Boolean b);
+    virtual CORBA::Boolean isblocking ();
+};
+
+
+class EpollDispatcherFactory
+    : public CORBA::DispatcherFactory
+{
+    CORBA::Boolean _edge_triggered;
+public:
+    EpollDispatcherFactory (CORBA::Boolean edge_triggered = FALSE)
+        : _edge_triggered(edge_triggered)
+    {}
+
+    virtual
+    ~EpollDispatcherFactory()
+    {}
+
+    virtual CORBA::Dispatcher*
+    create();
+};
+
+}
+
+#endif // __mico_epoll_dispatcher_h__
@@ -60,11 +60,16 @@
 #include <poll.h>
 #endif // HAVE_POLL_H
 
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif // HAVE_SYS_EPOLL_H
+
 /*
  * MICO Namespace
  */
 
 #include <mico/fast_array.h>
+#include <mico/metrics_impl.h>
 
 #ifdef HAVE_THREADS
 #include <mico/message.h>
@@ -77,14 +82,21 @@
 #include <mico/process.h>
 #include <mico/address_impl.h>
 #include <mico/ior_impl.h>
+#include <mico/timer_wheel.h>
+#include <mico/isa_cache.h>
+#include <mico/invoke_table.h>
 #include <mico/select_dispatcher.h>
 #ifdef HAVE_POLL_H
 #include <mico/poll_dispatcher.h>
 #endif // HAVE_POLL_H
+#ifdef HAVE_SYS_EPOLL_H
+#include <mico/epoll_dispatcher.h>
+#endif // HAVE_SYS_EPOLL_H
 #include <mico/transport_impl.h>
 #include <mico/transport/tcp.h>
 #include <mico/transport/udp.h>
 #include <mico/transport/unix.h>
+#include <mico/transport/shm.h>
 #include <mico/shlib_impl.h>
 #include <mico/process_impl.h>
 #include <mico/codec_impl.h>
@@ -0,0 +1,88 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2019 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_invoke_table_h__
+#define __mico_invoke_table_h__
+
+namespace MICO {
+
+/*
+ * Table of the pending invocations of an ORB, keyed by message id.
+ *
+ * The table is split into stripes by the low bits of the message id.
+ * Each stripe has its own lock and hash chains, so adding, finding and
+ * removing an invocation only locks one stripe no matter which thread
+ * created the invocation. Message ids are handed out sequentially, so
+ * consecutive invocations end up in different stripes.
+ *
+ * The table holds a reference to each record. Records are only
+ * released after the stripe lock has been dropped.
+ */
+class InvokeTable {
+public:
+    typedef CORBA::ULong MsgId;
+    typedef CORBA::Boolean (*Predicate) (CORBA::ORBInvokeRec *);
+
+    InvokeTable ();
+    ~InvokeTable ();
+
+    void add (CORBA::ORBInvokeRec *);
+    // these return a new reference or NULL
+    CORBA::ORBInvokeRec *get (MsgId);
+    CORBA::ORBInvokeRec *find (Predicate);
+    void remove (MsgId);
+
+    CORBA::ULong size ();
+
+private:
+    enum { NSTRIPES = 64, MIN_BUCKETS = 8 };
+
+    struct Entry {
+        MsgId id;
+        CORBA::ORBInvokeRec *rec;
+        Entry *next;
+
+        static void *operator new (size_t sz)
+        { return CORBA::Buffer::pool_alloc (sz); }
+        static void operator delete (void *p, size_t sz)
+        { CORBA::Buffer::pool_free (p, sz); }
+    };
+
+    struct Stripe {
+        MICOMT::Mutex lock;
+        std::vector<Entry *> chains;
+        CORBA::ULong size;
+    };
+
+    Stripe &stripe (MsgId id)
+    { return _stripes[id % NSTRIPES]; }
+    static Entry *&chain (Stripe &s, MsgId id)
+    { return s.chains[(id / NSTRIPES) & (s.chains.size() - 1)]; }
+    static void grow (Stripe &);
+
+    Stripe _stripes[NSTRIPES];
+};
+
+}
+
+#endif // __mico_invoke_table_h__
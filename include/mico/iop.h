@@ -35,6 +35,7 @@
 namespace MICO {
 
 class GIOPCodec;
+class GIOPConn;
 
 class GIOPInContext {
     CORBA::DataDecoder *_dc;
@@ -59,6 +60,7 @@ class GIOPOutContext {
     CORBA::Buffer *_buf;
     CORBA::Boolean _delete_buf;
     CORBA::Boolean _delete_ec;
+    GIOPConn *_stream;
 
 public:
     GIOPOutContext (GIOPCodec *, CORBA::CodeSetCoder *csc = 0);
@@ -68,6 +70,12 @@ public:
     CORBA::DataEncoder *ec()
     { return _ec; }
 
+    // connection large messages may be sent to while being marshaled
+    GIOPConn *stream ()
+    { return _stream; }
+    void stream (GIOPConn *conn)
+    { _stream = conn; }
+
     void reset ();
 
     CORBA::Buffer *_retn();
@@ -76,6 +84,12 @@ public:
 #define GIOP_BYTEORDER_BIT 1
 #define GIOP_FRAGMENT_BIT 2
 
+// size of the per connection read-ahead buffer
+#define GIOP_READAHEAD_SIZE 65536
+
+// smallest size of outgoing fragments
+#define GIOP_MIN_FRAGMENT_SIZE 64
+
 class GIOPCodec;
 typedef GIOPCodec *GIOPCodec_ptr;
 typedef ObjVar<GIOPCodec> GIOPCodec_var;
@@ -102,12 +116,14 @@ class GIOPCodec : public CORBA::ServerlessObject {
 			  CORBA::Boolean codesets = FALSE);
     void put_target (GIOPOutContext &out, CORBA::Object_ptr obj);
     CORBA::Boolean put_args (GIOPOutContext &out, CORBA::ORBRequest *,
-			     CORBA::Boolean inp);
+			     CORBA::Boolean inp, CORBA::ULong &key);
 
     CORBA::Boolean get_contextlist (GIOPInContext &in,
 				    IOP::ServiceContextList &ctx,
 				    CORBA::Boolean codesets = FALSE);
     CORBA::Boolean get_target (GIOPInContext &in, CORBA::Object_ptr obj);
+    void put_fragment_header (CORBA::Octet *hdr, CORBA::Octet flags,
+			      CORBA::ULong sz);
 public:
     GIOPCodec (CORBA::DataDecoder *dc, CORBA::DataEncoder *ec,
                CORBA::UShort giop_ver = 0x0100);
@@ -183,6 +199,9 @@ public:
 
     CORBA::Boolean put_error_msg (GIOPOutContext &out);
 
+    CORBA::Buffer *get_fragment (CORBA::Buffer *msg, CORBA::Buffer *&hdr,
+				 CORBA::ULong size);
+
     CORBA::Boolean get_header (GIOPInContext &in, GIOP::MsgType &,
 			       CORBA::ULong &sz, CORBA::Octet &flags);
     CORBA::Boolean check_header (GIOPInContext &in, GIOP::MsgType &,
@@ -385,12 +404,16 @@ class GIOPConn : public CORBA::TransportCallback,
     CORBA::Buffer *_inbufs;
     CORBA::Buffer *_inbuf, *_infrag;
     CORBA::ULong _inlen;
+    // read-ahead buffer, input is read from the transport in big chunks
+    CORBA::Buffer *_rabuf;
+    CORBA::Boolean _ra_drained;
     CORBA::Octet _inflags;
     GIOPConnCallback *_cb;
     GIOPCodec_ptr _codec;
     CORBA::Long _refcnt;
     MICOMT::Mutex refcnt_lock_;
     CORBA::Long _idle_tmout;
+    CORBA::ULong _last_used;
     CORBA::Boolean _have_tmout;
     CORBA::Boolean _have_wselect;
     GIOPInContext _inctx;
@@ -399,7 +422,38 @@ class GIOPConn : public CORBA::TransportCallback,
 
     CORBA::ULong _total_fragsize;
     std::map<CORBA::ULong, CORBA::Buffer *, std::less<CORBA::ULong> > _fragments;
+    // outgoing messages waiting for their turn, large ones are sent
+    // in fragments of at most _frag_size bytes
+    struct OutFrag {
+	CORBA::Buffer *msg;
+	CORBA::Buffer *hdr;
+    };
+    std::list<OutFrag> _outfrags;
+    CORBA::ULong _frag_size;
+    void next_fragments ();
+    CORBA::Long write_outbufs ();
     void do_write ();
+    CORBA::Long read_input (CORBA::ULong len, CORBA::Boolean readahead);
+
+    // traffic of this connection, NULL if metrics were disabled
+    // when it was opened
+    Metrics::ConnStats *_stats;
+    void count_in (CORBA::Long r)
+    {
+	if (r > 0 && Metrics::enabled()) {
+	    Metrics::add (Metrics::BytesIn, r);
+	    if (_stats)
+		_stats->bytes_in += r;
+	}
+    }
+    void count_out (CORBA::Long r)
+    {
+	if (r > 0 && Metrics::enabled()) {
+	    Metrics::add (Metrics::BytesOut, r);
+	    if (_stats)
+		_stats->bytes_out += r;
+	}
+    }
 
 #ifdef HAVE_THREADS
     GIOPConnReader *_reader;
@@ -464,6 +518,10 @@ public:
     void ref ();
     CORBA::Boolean deref (CORBA::Boolean all = FALSE);
 
+    // replies we are waiting for, start() holds one reference
+    CORBA::Long pending () const
+    { return _refcnt - 1; }
+
     void get_exclusive ()
     { _excl_mutex.lock(); };
 
@@ -499,6 +557,9 @@ public:
     void ref ();
     CORBA::Boolean deref (CORBA::Boolean all = FALSE);
 
+    CORBA::Long pending () const
+    { return _refcnt; }
+
     void get_exclusive ()
     {};
     void release_exclusive ()
@@ -508,7 +569,18 @@ public:
     CORBA::ULong id () { return _id; }
     void id (CORBA::ULong i) { _id = i; }
 
+    // seconds since the epoch when the connection was last chosen
+    // for a request, used to close idle pooled connections
+    CORBA::ULong last_used () const { return _last_used; }
+    void last_used (CORBA::ULong t) { _last_used = t; }
+
+    CORBA::ULong fragment_size () { return _frag_size; }
+    void fragment_size (CORBA::ULong sz);
+
     CORBA::Boolean input_ready_callback(CORBA::Buffer *b);
+#ifdef HAVE_THREADS
+    CORBA::Boolean input_rejected(CORBA::Buffer *b);
+#endif // HAVE_THREADS
 
     virtual void callback (CORBA::Transport *,
 			   CORBA::TransportCallback::Event);
@@ -571,6 +643,9 @@ struct GIOPConnCallback {
     virtual CORBA::Boolean input_callback (GIOPConn *, CORBA::Buffer *) = 0;
     virtual ~GIOPConnCallback ();
 #ifdef HAVE_THREADS
+    // input the thread pool had no room for, processed as usual by default
+    virtual CORBA::Boolean reject_callback (GIOPConn *c, CORBA::Buffer *b)
+    { return input_callback (c, b); }
     void send_orb_msg (GIOPConn *, ORBMsg::Event);
     //#else
     //    void kill_conn (GIOPConn *conn, CORBA::Boolean redo = FALSE) { kill_conn_callback( conn, redo ); };
@@ -582,6 +657,13 @@ GIOPConn::input_ready_callback(CORBA::Buffer *b) {
     return _cb->input_callback (this, b);
 }
 
+#ifdef HAVE_THREADS
+inline CORBA::Boolean
+GIOPConn::input_rejected(CORBA::Buffer *b) {
+    return _cb->reject_callback (this, b);
+}
+#endif // HAVE_THREADS
+
 struct GIOPConnMsg {
     GIOPConnMsg(GIOPConn *_conn, CORBA::Buffer *_b, GIOPConnCallback::Event _ev):
 	conn(_conn), b(_b), ev(_ev) {};
@@ -620,6 +702,7 @@ public:
     InputHandler( ThreadPool& _tp );
 
     void process( msg_type * msg );
+    void reject( msg_type * msg );
     virtual Operation *copy() const;
 };
 
@@ -693,6 +776,12 @@ public:
 	}
     }
 
+    // one is created for every invocation
+    static void *operator new (size_t sz)
+    { return CORBA::Buffer::pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { CORBA::Buffer::pool_free (p, sz); }
+
     void free ()
     { assert(0); }
 
@@ -748,7 +837,8 @@ class IIOPProxy : public CORBA::ObjectAdapter, public GIOPConnCallback, public G
         }
     };
 
-    typedef std::map<const CORBA::Address *, GIOPConn *, addrcomp> MapAddrConn;
+    // more than one connection per address with -ORBConnectionsPerEndpoint
+    typedef std::multimap<const CORBA::Address *, GIOPConn *, addrcomp> MapAddrConn;
     typedef std::map<CORBA::UShort, MapAddrConn, std::less<CORBA::UShort> > MapVerAddrConn;
     typedef std::map<const CORBA::IORProfile *, GIOPConn *,
 	              iorcomp > MapProfConn;
@@ -763,9 +853,13 @@ class IIOPProxy : public CORBA::ObjectAdapter, public GIOPConnCallback, public G
     CORBA::ORB_ptr _orb;
     CORBA::UShort _giop_ver;
     CORBA::ULong _max_message_size;
+    CORBA::ULong _frag_size;
 
     CORBA::Address *_reroute;
 
+    CORBA::ULong _conns_per_endpoint;
+    CORBA::ULong _last_reap;
+
 #ifdef USE_IOP_CACHE
     IIOPProxyInvokeRec *_cache_rec;
     CORBA::Boolean _cache_used;
@@ -790,6 +884,10 @@ class IIOPProxy : public CORBA::ObjectAdapter, public GIOPConnCallback, public G
 			 const char* tls_creds_id = 0
 #endif // USE_SL3
 			 );
+    GIOPConn *pick_conn (CORBA::UShort version, const CORBA::Address *,
+			 CORBA::ULong now, CORBA::Boolean &grow);
+    void reap_conns (CORBA::ULong now);
+    void close_conn (GIOPConn *, CORBA::Boolean redo);
     void conn_error (GIOPConn *, CORBA::Boolean send_error = TRUE);
 
     void deref_conn (GIOPConn *conn, CORBA::Boolean all = FALSE );
@@ -805,7 +903,8 @@ class IIOPProxy : public CORBA::ObjectAdapter, public GIOPConnCallback, public G
 public:
     IIOPProxy (CORBA::ORB_ptr,
                CORBA::UShort giop_ver = 0x0100,
-	       CORBA::ULong max_size = 0);
+	       CORBA::ULong max_size = 0,
+	       CORBA::ULong frag_size = 0);
     ~IIOPProxy ();
 
     void register_profile_id (CORBA::ULong id);
@@ -850,6 +949,8 @@ public:
 
     void redirect (CORBA::Address *addr) { _reroute = addr; }
 
+    void conns_per_endpoint (CORBA::ULong n)
+    { _conns_per_endpoint = n > 0 ? n : 1; }
 };
 
 
@@ -948,6 +1049,7 @@ private:
 
     CORBA::UShort _iiop_ver;
     CORBA::ULong _max_message_size;
+    CORBA::ULong _frag_size;
 
 #ifdef HAVE_THREADS
     MICOMT::Thread::ThreadKey target_obj_key_;
@@ -965,13 +1067,15 @@ private:
 
     void deref_conn (GIOPConn *conn, CORBA::Boolean all = FALSE );
 
-    CORBA::Boolean handle_input (GIOPConn *, CORBA::Buffer *);
+    CORBA::Boolean handle_input (GIOPConn *, CORBA::Buffer *,
+				 CORBA::Boolean reject = FALSE);
     CORBA::ORBMsgId exec_invoke_request (GIOPInContext &, CORBA::Object_ptr,
 			       CORBA::ORBRequest *,
 			       CORBA::Principal_ptr, CORBA::Boolean resp_exp,
 			       GIOPConn *conn,
 			       CORBA::ORBMsgId msgid);
-    CORBA::Boolean handle_invoke_request (GIOPConn *conn, GIOPInContext &);
+    CORBA::Boolean handle_invoke_request (GIOPConn *conn, GIOPInContext &,
+					  CORBA::Boolean reject = FALSE);
     CORBA::Boolean handle_locate_request (GIOPConn *conn, GIOPInContext &);
     CORBA::Boolean handle_cancel_request (GIOPConn *conn, GIOPInContext &);
 
@@ -980,7 +1084,7 @@ private:
     void handle_bind_reply   (CORBA::ORBMsgId);
 public:
     IIOPServer (CORBA::ORB_ptr, CORBA::UShort iiop_ver = 0x0100,
-		CORBA::ULong max_size = 0);
+		CORBA::ULong max_size = 0, CORBA::ULong frag_size = 0);
     ~IIOPServer ();
 
     CORBA::Boolean listen (CORBA::Address*, CORBA::Address*, const CORBA::Address*&);
@@ -1025,6 +1129,9 @@ public:
 
     CORBA::Boolean callback (GIOPConn *, GIOPConnCallback::Event);
     CORBA::Boolean input_callback (GIOPConn *, CORBA::Buffer *);
+#ifdef HAVE_THREADS
+    CORBA::Boolean reject_callback (GIOPConn *, CORBA::Buffer *);
+#endif // HAVE_THREADS
     void callback (CORBA::TransportServer *,
 		   CORBA::TransportServerCallback::Event);
 
@@ -186,9 +186,11 @@ public:
 
 class UIOPProfileDecoder : public CORBA::IORProfileDecoder {
     CORBA::IORProfile::ProfileId tagid;
+    UnixAddress::Family family;
 public:
     UIOPProfileDecoder (CORBA::IORProfile::ProfileId
-			= CORBA::IORProfile::TAG_UNIX_IOP);
+			= CORBA::IORProfile::TAG_UNIX_IOP,
+			UnixAddress::Family = UnixAddress::STREAM);
     ~UIOPProfileDecoder ();
     CORBA::IORProfile *decode (CORBA::DataDecoder &, ProfileId,
     			       CORBA::ULong) const;
@@ -0,0 +1,90 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2019 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_isa_cache_h__
+#define __mico_isa_cache_h__
+
+namespace MICO {
+
+/*
+ * Cache of successful _is_a() checks, keyed by the repository id of
+ * an object and the repository id it was checked against.
+ *
+ * Entries are spread over a number of shards by their hash value. Each
+ * shard has its own lock, hash chains and LRU list, so that lookups of
+ * different pairs rarely contend. A shard holds at most its share of
+ * the capacity and drops its least recently used entry when full.
+ */
+class IsACache {
+public:
+    IsACache (CORBA::ULong capacity);
+    ~IsACache ();
+
+    CORBA::Boolean lookup (const char *objid, const char *repoid);
+    void insert (const char *objid, const char *repoid);
+
+    // changing the capacity empties the cache
+    void capacity (CORBA::ULong);
+    CORBA::ULong capacity () const
+    { return _capacity; }
+
+    void stats (CORBA::ULong &hits, CORBA::ULong &misses);
+
+private:
+    enum { NSHARDS = 16 };
+
+    struct Entry {
+        CORBA::ULong objhash;
+        CORBA::ULong repohash;
+        std::string objid;
+        std::string repoid;
+        Entry *next;
+        Entry *lru_prev;
+        Entry *lru_next;
+    };
+
+    struct Shard {
+        MICOMT::Mutex lock;
+        std::vector<Entry *> chains;
+        // most recently used first
+        Entry *lru_first;
+        Entry *lru_last;
+        CORBA::ULong size;
+        CORBA::ULong max;
+        CORBA::ULong hits;
+        CORBA::ULong misses;
+    };
+
+    static CORBA::ULong hash (const char *);
+    Shard &shard (CORBA::ULong h)
+    { return _shards[(h >> 24) % NSHARDS]; }
+    static void clear (Shard &);
+    static void unlink (Shard &, Entry *);
+
+    CORBA::ULong _capacity;
+    Shard _shards[NSHARDS];
+};
+
+}
+
+#endif // __mico_isa_cache_h__
@@ -67,6 +67,7 @@ namespace MICO
 	 * creation.
 	 */
 	msg_type( void *_ptr, MsgType _t = Process ) :
+	    queued( 0 ),
 	    type( _t ),
 	    ptr(_ptr)
 	{
@@ -131,12 +132,46 @@ namespace MICO
 	};
 	//@}
 
+	//! \name Queue Wait Metrics
+	//@{
+	/*!
+	 * Remember when the message was queued, if metrics are enabled.
+	 */
+	void enqueued()
+	{
+	    queued = Metrics::enabled() ? Metrics::now() : 0;
+	};
+
+	/*!
+	 * Record the time since enqueued() in the QueueWait histogram.
+	 */
+	void dequeued()
+	{
+	    if (queued) {
+		Metrics::record( Metrics::QueueWait, Metrics::now() - queued );
+		queued = 0;
+	    }
+	};
+	//@}
+
+	//! \name Memory Management
+	//@{
+	/*!
+	 * Messages are created and deleted for every hop between two
+	 * operations. Freed messages are kept in a lock free pool and
+	 * reused by the next allocation.
+	 */
+	static void *operator new( size_t );
+	static void operator delete( void *, size_t );
+	//@}
+
 #ifdef MTDEBUG
 	MICO_Long create_time;	//!< Creation time of the message type
 	MICO_Long push_time;	//!< When the message type was pushed
 	MICO_Long pop_time;	//!< When the message type was popped
 #endif
 	int value;		//!< Value associated with the message type.
+	CORBA::ULongLong queued;	//!< When the message was queued
 
     protected:
 	MsgType type;		//!< The message type
@@ -166,7 +201,9 @@ namespace MICO
 	enum Types {
 	    active,
 	    passive,
-	    direct
+	    direct,
+	    active_ring,	//!< Like active, based on a MsgRing
+	    passive_ring	//!< Like passive, based on a MsgRing
 	};
 
 	virtual ~MsgChannel()
@@ -182,6 +219,7 @@ namespace MICO
 	//@{
 	virtual MICO_Boolean check_msg( MICO::WorkerThread * );
 	virtual msg_type *get_msg( OP_id_type );
+	virtual MICO_ULong get_msgs( OP_id_type, msg_type **, MICO_ULong );
 	virtual void put_msg( OP_id_type, msg_type *) = 0;
 	//@}
 
@@ -259,6 +297,146 @@ namespace MICO
 
     };
 
+    /*!
+     * \ingroup micomt
+     *
+     * A bounded queue of pointers for any number of producers and
+     * consumers. Each slot carries a sequence number that tells
+     * whether it is ready to be written or read, so that pushing and
+     * popping only take a compare and swap on the head or tail
+     * position. Without atomic operations a mutex is used instead.
+     */
+    class MsgRing {
+    public:
+	//! \name Constructor/Destructor
+	//@{
+	MsgRing( MICO_ULong _capacity );
+	~MsgRing();
+	//@}
+
+	//! \name Queue Operations
+	//@{
+	MICO_Boolean push( void * );
+	void *pop();
+	MICO_ULong pop( void **, MICO_ULong max );
+	MICO_Boolean empty() const;
+	MICO_Boolean full() const;
+	//@}
+
+	/*!
+	 * \return The number of slots, a power of two.
+	 */
+	MICO_ULong capacity() const
+	{
+	    return mask + 1;
+	};
+
+    private:
+	struct Slot {
+	    volatile MICO_ULong seq;	//!< Position the slot is ready for
+	    void *data;			//!< The queued pointer
+	};
+
+	Slot		       *slots;		//!< The ring
+	MICO_ULong		mask;		//!< Capacity - 1
+	// keep producers and consumers off each others cache line
+	char			pad0[64];
+	volatile MICO_ULong	head;		//!< Next position to push
+	char			pad1[64];
+	volatile MICO_ULong	tail;		//!< Next position to pop
+	char			pad2[64];
+#if !defined(HAVE_GCC_ATOMICS)
+	mutable MICOMT::Mutex	lock;		//!< Protects the ring
+#endif // !HAVE_GCC_ATOMICS
+
+	MsgRing( const MsgRing & );
+	MsgRing &operator=( const MsgRing & );
+    };
+
+
+    /*!
+     * \ingroup micomt
+     *
+     * An active message queue that keeps the waiting messages in a
+     * MsgRing. Messages that do not fit into the ring go to an
+     * overflow queue, so put_msg() never blocks.
+     */
+    class ActiveRingMsgQueue: public MsgChannel
+#ifdef DEBUG_NAMES
+			    ,public NamedObject
+#endif
+    {
+    public:
+	//! \name Constructor/Destructor
+	//@{
+	ActiveRingMsgQueue( MICO_ULong capacity = 1024 );
+	virtual ~ActiveRingMsgQueue();
+	//@}
+
+#ifdef DEBUG_NAMES
+	const char *name (const char *new_name = NULL);
+#endif
+
+	//! \name Active Message Queue Operations
+	//@{
+	MICO_Boolean check_msg( MICO::WorkerThread * );
+	void put_msg( OP_id_type nextOP_id, msg_type *);
+	//@}
+
+    protected:
+	msg_type *pop();
+
+	MsgRing			ring;		//!< The waiting messages
+	std::queue<msg_type*>	overflow;	//!< Messages beyond the ring
+	MICOMT::Mutex		overflow_lock;	//!< A lock for overflow
+	volatile MICO_ULong	overflowed;	//!< Size of overflow
+    };
+
+
+    /*!
+     * \ingroup micomt
+     *
+     * A passive message queue that keeps the messages in a MsgRing.
+     * Consumers and producers only sleep when the ring is empty or
+     * full, and only then does the other side have to wake them up.
+     * Messages are returned in the order they were put.
+     */
+    class PassiveRingMsgQueue: public MsgChannel
+#ifdef DEBUG_NAMES
+			     ,public NamedObject
+#endif
+    {
+    public:
+	//! \name Constructor/Destructor
+	//@{
+	PassiveRingMsgQueue( MICO_ULong capacity = 1024 );
+	virtual ~PassiveRingMsgQueue();
+	//@}
+
+#ifdef DEBUG_NAMES
+	const char *name (const char *new_name = NULL);
+#endif
+
+	//! \name Passive Message Queue Operations
+	//@{
+	msg_type *get_msg( OP_id_type nextOP_id );
+	MICO_ULong get_msgs( OP_id_type nextOP_id, msg_type **msgs,
+			     MICO_ULong max );
+	void put_msg( OP_id_type nextOP_id, msg_type *msg);
+	//@}
+
+    protected:
+	void wake( volatile MICO_Long &waiting, MICOMT::CondVar &cond );
+
+	MsgRing			ring;		//!< The queued messages
+	MICOMT::Mutex		wait_lock;	//!< Lock for sleeping
+	MICOMT::CondVar		not_empty;	//!< Signalled after a put
+	MICOMT::CondVar		not_full;	//!< Signalled after a get
+	volatile MICO_Long	consumers;	//!< Sleeping consumers
+	volatile MICO_Long	producers;	//!< Sleeping producers
+    };
+
+
     /*!
      * \ingroup micomt
      *
@@ -0,0 +1,245 @@
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2006 by The Mico Team
+ *
+ *  This file was automatically generated. DO NOT EDIT!
+ */
+
+#include <CORBA.h>
+
+#ifndef __METRICS_H__
+#define __METRICS_H__
+
+
+#ifdef _WIN32
+#ifdef BUILD_MICO_DLL
+#define MICO_EXPORT /**/
+#else // BUILD_MICO_DLL
+#define MICO_EXPORT __declspec(dllimport)
+#endif // BUILD_MICO_DLL
+#else // _WIN32
+#define MICO_EXPORT /**/
+#endif // _WIN32
+
+
+
+
+namespace MICOMetrics
+{
+
+class Registry;
+typedef Registry *Registry_ptr;
+typedef Registry_ptr RegistryRef;
+typedef ObjVar< Registry > Registry_var;
+typedef ObjOut< Registry > Registry_out;
+
+}
+
+
+
+
+
+
+namespace MICOMetrics
+{
+
+struct Counter;
+typedef TVarVar< Counter > Counter_var;
+typedef TVarOut< Counter > Counter_out;
+
+
+struct Counter {
+  #ifdef HAVE_TYPEDEF_OVERLOAD
+  typedef Counter_var _var_type;
+  #endif
+  #ifdef HAVE_EXPLICIT_STRUCT_OPS
+  Counter();
+  ~Counter();
+  Counter( const Counter& s );
+  Counter& operator=( const Counter& s );
+  #endif //HAVE_EXPLICIT_STRUCT_OPS
+
+  CORBA::String_var name;
+  CORBA::ULongLong value;
+};
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_Counter;
+
+typedef SequenceTmpl< Counter,MICO_TID_DEF> CounterSeq;
+typedef TSeqVar< SequenceTmpl< Counter,MICO_TID_DEF> > CounterSeq_var;
+typedef TSeqOut< SequenceTmpl< Counter,MICO_TID_DEF> > CounterSeq_out;
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_CounterSeq;
+
+struct Histogram;
+typedef TVarVar< Histogram > Histogram_var;
+typedef TVarOut< Histogram > Histogram_out;
+
+
+struct Histogram {
+  #ifdef HAVE_TYPEDEF_OVERLOAD
+  typedef Histogram_var _var_type;
+  #endif
+  #ifdef HAVE_EXPLICIT_STRUCT_OPS
+  Histogram();
+  ~Histogram();
+  Histogram( const Histogram& s );
+  Histogram& operator=( const Histogram& s );
+  #endif //HAVE_EXPLICIT_STRUCT_OPS
+
+  CORBA::String_var name;
+  CORBA::ULongLong count;
+  CORBA::ULongLong total;
+  CORBA::ULongLong min;
+  CORBA::ULongLong max;
+  CORBA::ULongLong p50;
+  CORBA::ULongLong p90;
+  CORBA::ULongLong p99;
+  CORBA::ULongLong p999;
+};
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_Histogram;
+
+typedef SequenceTmpl< Histogram,MICO_TID_DEF> HistogramSeq;
+typedef TSeqVar< SequenceTmpl< Histogram,MICO_TID_DEF> > HistogramSeq_var;
+typedef TSeqOut< SequenceTmpl< Histogram,MICO_TID_DEF> > HistogramSeq_out;
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_HistogramSeq;
+
+struct Connection;
+typedef TVarVar< Connection > Connection_var;
+typedef TVarOut< Connection > Connection_out;
+
+
+struct Connection {
+  #ifdef HAVE_TYPEDEF_OVERLOAD
+  typedef Connection_var _var_type;
+  #endif
+  #ifdef HAVE_EXPLICIT_STRUCT_OPS
+  Connection();
+  ~Connection();
+  Connection( const Connection& s );
+  Connection& operator=( const Connection& s );
+  #endif //HAVE_EXPLICIT_STRUCT_OPS
+
+  CORBA::String_var peer;
+  CORBA::ULongLong bytes_in;
+  CORBA::ULongLong bytes_out;
+};
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_Connection;
+
+typedef SequenceTmpl< Connection,MICO_TID_DEF> ConnectionSeq;
+typedef TSeqVar< SequenceTmpl< Connection,MICO_TID_DEF> > ConnectionSeq_var;
+typedef TSeqOut< SequenceTmpl< Connection,MICO_TID_DEF> > ConnectionSeq_out;
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_ConnectionSeq;
+
+
+/*
+ * Base class and common definitions for local interface Registry
+ */
+
+class Registry : 
+  virtual public CORBA::Object
+{
+  public:
+    virtual ~Registry();
+
+    #ifdef HAVE_TYPEDEF_OVERLOAD
+    typedef Registry_ptr _ptr_type;
+    typedef Registry_var _var_type;
+    #endif
+
+    static Registry_ptr _narrow( CORBA::Object_ptr obj );
+    static Registry_ptr _narrow( CORBA::AbstractBase_ptr obj );
+    static Registry_ptr _duplicate( Registry_ptr _obj )
+    {
+      CORBA::Object::_duplicate (_obj);
+      return _obj;
+    }
+
+    static Registry_ptr _nil()
+    {
+      return 0;
+    }
+
+    virtual void *_narrow_helper( const char *repoid );
+
+    virtual CORBA::Boolean enabled() = 0;
+    virtual void enabled( CORBA::Boolean value ) = 0;
+
+    virtual ::MICOMetrics::CounterSeq* counters() = 0;
+    virtual ::MICOMetrics::HistogramSeq* histograms() = 0;
+    virtual ::MICOMetrics::ConnectionSeq* connections() = 0;
+    virtual void reset() = 0;
+    virtual void dump( const char* filename ) = 0;
+
+  protected:
+    Registry() {};
+  private:
+    Registry( const Registry& );
+    void operator=( const Registry& );
+};
+
+extern MICO_EXPORT CORBA::TypeCodeConst _tc_Registry;
+
+
+}
+
+
+#ifndef MICO_CONF_NO_POA
+
+
+
+namespace POA_MICOMetrics
+{
+
+}
+
+
+#endif // MICO_CONF_NO_POA
+
+void operator<<=( CORBA::Any &_a, const ::MICOMetrics::Counter &_s );
+void operator<<=( CORBA::Any &_a, ::MICOMetrics::Counter *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, ::MICOMetrics::Counter &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const ::MICOMetrics::Counter *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Counter;
+
+void operator<<=( CORBA::Any &_a, const ::MICOMetrics::Histogram &_s );
+void operator<<=( CORBA::Any &_a, ::MICOMetrics::Histogram *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, ::MICOMetrics::Histogram &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const ::MICOMetrics::Histogram *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Histogram;
+
+void operator<<=( CORBA::Any &_a, const ::MICOMetrics::Connection &_s );
+void operator<<=( CORBA::Any &_a, ::MICOMetrics::Connection *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, ::MICOMetrics::Connection &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const ::MICOMetrics::Connection *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Connection;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> &_s );
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Counter;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> &_s );
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Histogram;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> &_s );
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> *_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> &_s );
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> *&_s );
+
+extern MICO_EXPORT CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Connection;
+
+#endif
@@ -0,0 +1,247 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2007 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_metrics_impl_h__
+#define __mico_metrics_impl_h__
+
+namespace MICO {
+
+/*
+ * counters and latency histograms of the ORB. every thread has its
+ * own copy of them (a shard), so updates take no locks. the registry
+ * adds the shards up when it is read. while metrics are disabled all
+ * that is left of an update is the test of enabled().
+ */
+class Metrics {
+public:
+    typedef CORBA::ULong Id;
+
+    // predefined counters
+    enum {
+	BytesIn,		// GIOP bytes read
+	BytesOut,		// GIOP bytes written
+	ConnOpened,		// GIOP connections opened
+	ConnClosed,		// GIOP connections closed
+	NumCounters
+    };
+
+    // predefined histograms
+    enum {
+	Marshal,		// marshaling of arguments and results
+	Unmarshal,		// unmarshaling of arguments and results
+	QueueWait,		// time in the queue of a thread pool
+	NumHistograms
+    };
+
+    /*
+     * log-linear histogram of values in nanoseconds: the values of
+     * each power of two are split up into 32 buckets, so a bucket is
+     * accurate to about 3 percent. values above 2^40 (18 minutes)
+     * end up in the last bucket.
+     */
+    class Histogram {
+    public:
+	enum {
+	    SubBits = 5,
+	    MaxBits = 40,
+	    Buckets = (MaxBits - SubBits + 1) << SubBits
+	};
+
+	Histogram ();
+	void record (CORBA::ULongLong);
+	void add (const Histogram &);
+	void reset ();
+	CORBA::ULongLong percentile (double) const;
+
+	CORBA::ULongLong count, total, min, max;
+    private:
+	static CORBA::ULong index (CORBA::ULongLong);
+	static CORBA::ULongLong upper (CORBA::ULong);
+
+	CORBA::ULongLong buckets[Buckets];
+    };
+
+    // traffic of a GIOP connection, owned by the connection
+    struct ConnStats {
+	std::string peer;
+	CORBA::ULongLong bytes_in, bytes_out;
+    };
+
+    /*
+     * measures the time from construction to destruction, if
+     * metrics were enabled at construction
+     */
+    class Stopwatch {
+	Id _id;
+	CORBA::ULongLong _start;
+    public:
+	Stopwatch (Id id)
+	    : _id (id), _start (Metrics::enabled() ? Metrics::now() : 0)
+	{}
+	~Stopwatch ()
+	{
+	    if (_start)
+		Metrics::record (_id, Metrics::now() - _start);
+	}
+    };
+
+    static CORBA::Boolean enabled ()
+    {
+	return _enabled;
+    }
+    static void enable (CORBA::Boolean);
+
+    static CORBA::ULongLong now ()
+    {
+	return OSMisc::nanotime ();
+    }
+
+    // ids of counters and histograms by name, created on first use
+    static Id counter (const char *name);
+    static Id histogram (const char *name);
+
+    static void add (Id counter, CORBA::ULongLong n = 1)
+    {
+	if (_enabled)
+	    shard()->counter (counter) += n;
+    }
+    static void record (Id histogram, CORBA::ULongLong nsecs)
+    {
+	if (_enabled)
+	    shard()->histogram (histogram).record (nsecs);
+    }
+
+    static ConnStats *open_conn (const char *peer);
+    static void close_conn (ConnStats *);
+
+    // sums over all threads
+    static void counters (std::vector<std::pair<std::string,
+			  CORBA::ULongLong> > &);
+    static void histograms (std::vector<std::pair<std::string,
+			    Histogram> > &);
+    static void connections (std::vector<ConnStats> &);
+    static void reset ();
+
+private:
+    enum {
+	ChunkBits = 6,
+	ChunkSize = 1 << ChunkBits,
+	MaxChunks = 64		// at most 4096 counters and histograms
+    };
+
+    struct Shard {
+	CORBA::ULongLong *counters[MaxChunks];
+	Histogram **histograms[MaxChunks];
+	std::map<std::string, Id> hcache;
+
+	Shard ();
+	~Shard ();
+	CORBA::ULongLong &counter (Id id)
+	{
+	    CORBA::ULongLong *c = counters[id >> ChunkBits];
+	    if (!c)
+		c = new_counters (id);
+	    return c[id & (ChunkSize-1)];
+	}
+	Histogram &histogram (Id id)
+	{
+	    Histogram **h = histograms[id >> ChunkBits];
+	    if (!h || !h[id & (ChunkSize-1)])
+		return new_histogram (id);
+	    return *h[id & (ChunkSize-1)];
+	}
+	CORBA::ULongLong *new_counters (Id);
+	Histogram &new_histogram (Id);
+	void add (const Shard &);
+	void reset ();
+    };
+
+    static Shard *shard ()
+    {
+#ifdef HAVE_THREADS
+	Shard *s = (Shard *)MICOMT::Thread::get_specific (_key);
+	return s ? s : new_shard ();
+#else
+	return _shards.empty() ? new_shard () : _shards.front();
+#endif
+    }
+    static Shard *new_shard ();
+    static Id lookup (std::map<std::string, Id> &,
+		      std::vector<std::string> &, const char *);
+    static void retire (void *);
+
+    static CORBA::Boolean _enabled;
+    static MICOMT::Mutex _lock;
+    static std::list<Shard *> _shards;
+    static Shard *_retired;
+    static std::map<std::string, Id> _counter_ids, _histogram_ids;
+    static std::vector<std::string> _counter_names, _histogram_names;
+    static std::list<ConnStats *> _conns;
+#ifdef HAVE_THREADS
+    static MICOMT::Thread::ThreadKey _key;
+#endif
+};
+
+}
+
+
+namespace MICOMetrics {
+
+/*
+ * the local Registry object. when it is given a file name it writes
+ * all metrics to this file periodically, driven by a timer of the
+ * ORB's dispatcher.
+ */
+class Registry_impl
+    : public virtual Registry,
+      public virtual ::CORBA::LocalObject,
+      public ::CORBA::DispatcherCallback
+{
+public:
+    Registry_impl ();
+    ~Registry_impl ();
+
+    CORBA::Boolean enabled ();
+    void enabled (CORBA::Boolean);
+
+    CounterSeq *counters ();
+    HistogramSeq *histograms ();
+    ConnectionSeq *connections ();
+    void reset ();
+    void dump (const char *filename);
+
+    // dump to file every interval seconds
+    void dump_periodically (const char *file, CORBA::ULong interval);
+
+    void callback (CORBA::Dispatcher *, CORBA::Dispatcher::Event);
+private:
+    CORBA::Boolean write (const char *filename);
+
+    std::string _file;
+    CORBA::ULong _interval;
+    CORBA::Dispatcher *_disp;
+};
+
+}
+
+#endif // __mico_metrics_impl_h__
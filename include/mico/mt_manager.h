@@ -296,6 +296,74 @@ namespace MICO
         bool                    shutdown_;      //!< Marks shutdown state
     };
 
+    /*!
+     * \ingroup micomt
+     * The StealingThreadPool class is an alternative engine for the
+     * pools fed by put_msg(). It starts all of its threads up front.
+     * Each thread has its own deque of messages. A message is queued
+     * on the deque of the submitting pool thread, or on the next
+     * deque in round robin order if it comes from outside. A thread
+     * whose deque is empty steals from the others before it sleeps.
+     *
+     * The number of queued messages can be limited. When the limit
+     * is reached, producers either wait for room or the message is
+     * handed to Operation::reject(), depending on the policy. Pool
+     * threads are never blocked by the limit.
+     */
+    class StealingThreadPool: public ThreadPool {
+    public:
+	/*!
+	 * What to do with a message that does not fit in the queue.
+	 */
+	enum OverflowPolicy {
+	    Block,		//!< Wait until there is room
+	    Reject		//!< Pass it to Operation::reject()
+	};
+
+	//! \name Constructor/Destructor
+	//@{
+	StealingThreadPool( unsigned int _max,
+			    unsigned int _queue_limit,
+			    OverflowPolicy _policy,
+			    const std::vector<unsigned int> &_cpus );
+	virtual ~StealingThreadPool();
+	//@}
+
+	virtual void start_threads (void *arg = NULL);
+	virtual void put_msg( OP_id_type nextOP_id, msg_type * msg);
+	virtual void shutdown();
+
+	/*!
+	 * \return The number of messages rejected so far.
+	 */
+	CORBA::ULong rejected()
+	{
+	    return count(_rejected, 0);
+	};
+
+    private:
+	class Worker;
+	friend class Worker;
+
+	msg_type *next_msg( Worker * );
+	CORBA::Long count( volatile CORBA::Long &, CORBA::Long );
+
+	std::vector<Worker *>	workers;	//!< One per thread
+	std::vector<unsigned int> cpus;		//!< CPUs to bind threads to
+	MICOMT::Thread::ThreadKey worker_key;	//!< Worker of calling thread
+	MICOMT::CondVar		space_cond_;	//!< Signalled when queue drains
+	unsigned int		queue_limit;	//!< Max queued msgs, 0 = no limit
+	OverflowPolicy		policy;		//!< What to do on overflow
+	volatile CORBA::Long	_queued;	//!< Messages in all deques
+	volatile CORBA::Long	_idle;		//!< Threads waiting for work
+	volatile CORBA::Long	_blocked;	//!< Producers waiting for room
+	volatile CORBA::Long	_next;		//!< Round robin position
+	volatile CORBA::Long	_rejected;	//!< Rejected messages
+#if !defined(HAVE_GCC_ATOMICS)
+	MICOMT::Mutex		count_lock;	//!< Protects the counters
+#endif // !HAVE_GCC_ATOMICS
+    };
+
     /*!
      * Mark the worker thread idle through its thread pool (if it exists).
      */
@@ -453,6 +521,11 @@ namespace MICO
         static MICOMT::ClientConcurrencyModel _S_client_concurrency_model;
 	static MICO::ThreadPoolManager* _S_thread_pool_manager;
         static bool _S_mt_manager_shutdown_;
+	static bool _S_work_stealing;
+	static unsigned int _S_request_queue_limit;
+	static MICO::StealingThreadPool::OverflowPolicy _S_request_queue_policy;
+	static std::vector<unsigned int> _S_thread_affinity;
+	static bool _S_lockfree_channels;
     public:
 	static void
 	server_concurrency_model(MICOMT::ServerConcurrencyModel __model);
@@ -484,6 +557,17 @@ namespace MICO
 	static void
 	thread_setup(unsigned int __conn_limit, unsigned int __req_limit);
 
+	static void
+	work_stealing_setup(unsigned int __queue_limit,
+			    MICO::StealingThreadPool::OverflowPolicy __policy,
+			    const std::vector<unsigned int> &__cpus);
+
+	static void
+	lockfree_channels(CORBA::Boolean __on);
+
+	static MICO::MsgChannel::Types
+	channel_type(MICO::MsgChannel::Types __type);
+
 	static MICO::ThreadPoolManager*
 	thread_pool_manager()
 	{ return _S_thread_pool_manager; }
@@ -152,6 +152,7 @@ class ThreadPool;
 	void put_msg( OP_id_type nextOP_id, msg_type *msg);
 	void send_msg( OP_id_type nextOP_id, msg_type * msg);
 	virtual void process( msg_type *msg );
+	virtual void reject( msg_type *msg );
   	virtual Operation *copy() const = 0;
 	//@}
 
@@ -200,7 +201,7 @@ class ThreadPool;
 	 * allows the operation to get queued messages from the
 	 * message channel.
 	 */
-	void register_input_mc( PassiveMsgQueue *mc )
+	void register_input_mc( MsgChannel *mc )
 	{
 	    input_mc = mc;
 	};
@@ -209,7 +210,7 @@ class ThreadPool;
 	 * \return A pointer to the input channel.
 	 * Get the passive input channel.
 	 */
-	PassiveMsgQueue *get_input_mc() const
+	MsgChannel *get_input_mc() const
 	{
 	    return input_mc;
 	};
@@ -222,7 +223,7 @@ class ThreadPool;
 	//@}
 
     protected:
-	PassiveMsgQueue *input_mc;	//!< The passive input channel
+	MsgChannel *input_mc;		//!< The passive input channel
     };
 
     /*!
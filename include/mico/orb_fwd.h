@@ -78,6 +78,12 @@ struct ORBAsyncCallback: public ORBCallback {
 	: notified(FALSE), cond(&cond_mutex)
     {};
     virtual ~ORBAsyncCallback ();
+
+    // one is created for every invocation
+    static void *operator new (size_t sz)
+    { return Buffer::pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { Buffer::pool_free (p, sz); }
 };
 
 #endif
@@ -28,6 +28,11 @@
 #  define USE_ORB_CACHE
 #endif
 
+namespace MICO {
+class IsACache;
+class InvokeTable;
+}
+
 namespace CORBA {
 
 class ObjectAdapter;
@@ -86,6 +91,12 @@ public:
     ORBInvokeRec (MsgId);
     virtual ~ORBInvokeRec ();
 
+    // one is created for every invocation
+    static void *operator new (size_t sz)
+    { return Buffer::pool_alloc (sz); }
+    static void operator delete (void *p, size_t sz)
+    { Buffer::pool_free (p, sz); }
+
     void free();
 
     void init_invoke (ORB_ptr, Object_ptr target,
@@ -254,25 +265,23 @@ private:
     void initialize_threading();
 #endif // HAVE_THREADS
     typedef std::vector<ObjectAdapter *> OAVec;
-    typedef std::map<MsgId, ORBInvokeRec_var, std::less<MsgId> > InvokeMap;
     typedef std::map<std::string, Object_var, std::less<std::string> >
     InitialRefMap;
     typedef std::map<std::string, ValueFactoryBase_var, std::less<std::string> >
     ValueFactoryMap;
-    typedef std::list<std::string> isa_cacheList;
 
     std::string _default_init_ref;
 
-    MICOMT::Locked<isa_cacheList> _isa_cache;
+    MICO::IsACache *_isa_cache;
     std::vector<std::string> _bindaddrs;
     MICOMT::RWLocked<OAVec> _adapters;
-#ifndef HAVE_THREADS
-    InvokeMap _invokes;
-#else // HAVE_THREADS
-    typedef std::map<MICOMT::Thread::ThreadID, MICOMT::Locked<InvokeMap>*> ThreadIDInvokeMap;
-    MICOMT::Locked<ThreadIDInvokeMap> _invokes;
-    MICOMT::Thread::ThreadKey _invokes_key;
-#endif // HAVE_THREADS
+    // get_oa() lookup structures, rebuilt whenever adapters come and go
+    typedef std::map<std::string, ObjectAdapter *, std::less<std::string> >
+    OAIndex;
+    OAIndex _oa_index;
+    OAVec _remote_adapters;
+    ULong _unindexed_adapters;
+    MICO::InvokeTable *_invokes;
 
     Dispatcher *_disp;
     IOR *_tmpl;
@@ -319,6 +328,7 @@ private:
 
     Boolean is_local (Object_ptr);
     ObjectAdapter *get_oa (Object_ptr);
+    void reindex_oas ();
     ORBInvokeRec *create_invoke (MsgId);
     void add_invoke (ORBInvokeRec *);
     ORBInvokeRec *get_invoke (MsgId);
@@ -420,6 +430,9 @@ public:
 
     Boolean plugged () { return _is_plugged; }
     void plugged (Boolean which) { _is_plugged = which; }
+    // maximum number of cached _is_a() results, 0 disables the cache
+    void isa_cache_size (ULong);
+    void isa_cache_stats (ULong &hits, ULong &misses);
     const Octet *terminal_id (ULong &length);
     void terminal_id (const Octet *val, ULong len);
 
@@ -596,10 +609,6 @@ public:
     (CORBA::Object_ptr obj,
      CORBA::PolicyList_out inconsistent_policies);
 
-#ifdef HAVE_THREADS
-    Boolean
-    remove_thread_invocations_map(void*);
-#endif // HAVE_THREADS
     // end-mico-extension
 
     static ORB_ptr _duplicate (ORB_ptr o)
@@ -632,6 +641,13 @@ public:
     virtual const char *get_oaid () const = 0;
     virtual Boolean has_object (Object_ptr) = 0;
     virtual Boolean is_local () const = 0;
+    /*
+     * object key prefixes of all objects a local adapter has (apart
+     * from mobile objects). lets the ORB find the adapter of an object
+     * without asking every adapter. adapters that return no prefixes
+     * are asked through has_object() as before.
+     */
+    virtual void get_key_prefixes (std::vector<std::string> &) const;
 
 #ifdef USE_CSL2
     virtual CORBA::Principal_ptr get_principal (CORBA::Object_ptr) = 0;
@@ -71,6 +71,13 @@ struct OSMisc {
 	return (_ts.tv_sec * 1000L) + (_ts.tv_usec / 1000L);
     }
 
+    // nanoseconds since some point in time, for measuring intervals
+    static ulonglong nanotime ()
+    {
+        TimeVal _ts = gettime();
+	return ((ulonglong)_ts.tv_sec * 1000000 + _ts.tv_usec) * 1000;
+    }
+
     static TimeVal gettime ()
     {
       struct _timeb timebuffer;
@@ -151,6 +158,13 @@ struct OSMisc {
       return ct;
     }
 
+    // nanoseconds since some point in time, for measuring intervals
+    static ulonglong nanotime ()
+    {
+        TimeVal _ts = gettime();
+	return ((ulonglong)_ts.tv_sec * 1000000 + _ts.tv_usec) * 1000;
+    }
+
     enum AccessMode {
 	ACCESS_READ = 0,
 	ACCESS_WRITE = 0,
@@ -234,6 +248,13 @@ struct OSMisc {
 			MICO_NOT_IMPLEMENTED;
 			return tv;
 		}
+
+    // nanoseconds since some point in time, for measuring intervals
+    static ulonglong nanotime ()
+    {
+        TimeVal _ts = gettime();
+	return ((ulonglong)_ts.tv_sec * 1000000 + _ts.tv_usec) * 1000;
+    }
 #if 0
 // unsupported
 
@@ -288,6 +309,9 @@ struct OSMisc {
 #include <signal.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#ifdef HAVE_CLOCK_GETTIME
+#include <time.h>
+#endif
 
 #ifdef __CYGWIN32__
 extern "C" int gettimeofday (struct timeval *, struct timezone *);
@@ -320,6 +344,19 @@ struct OSMisc {
 	return (_ts.tv_sec * 1000L) + (_ts.tv_usec / 1000L);
     }
 
+    // nanoseconds since some point in time, for measuring intervals
+    static ulonglong nanotime ()
+    {
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+      struct timespec ts;
+      ::clock_gettime (CLOCK_MONOTONIC, &ts);
+      return (ulonglong)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+      TimeVal _ts = gettime();
+      return ((ulonglong)_ts.tv_sec * 1000000 + _ts.tv_usec) * 1000;
+#endif
+    }
+
     enum AccessMode {
 	ACCESS_READ = R_OK,
 	ACCESS_WRITE = W_OK,
@@ -278,6 +278,9 @@ public:
 #ifdef HAVE_SYS_UN_H
 #include <sys/un.h>
 #endif
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #ifdef HAVE_NETINET_TCP_H
@@ -390,6 +393,14 @@ public:
 	return ::write (fd, buf, count);
     }
 
+#ifdef HAVE_SYS_UIO_H
+    static MICO_Long sock_writev (MICO_Long fd, const struct iovec *iov,
+				  MICO_Long count)
+    {
+	return ::writev (fd, iov, count);
+    }
+#endif
+
     static MICO_Long sock_write_to (MICO_Long fd, const void *buf,
 				    MICO_ULong count,
 				    const struct sockaddr *sa,
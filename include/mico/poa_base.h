@@ -206,6 +206,7 @@ public:
 
   ServantBase * _preinvoke ();
   void _postinvoke ();
+  void _invoke_local (ServantBase *, CORBA::StaticRequest &);
 
 protected:
   StubBase ();
@@ -152,9 +152,8 @@ public:
 
 /*
  * Keeps an Object Id as a vector of octets so that we can compare
- * them faster than using a CORBA sequence. We can then use this
- * ObjectId as the key in a STL map, which should be implemented
- * efficiently.
+ * them faster than using a CORBA sequence. The hash value is computed
+ * once on construction, as the Id is used as a hash table key.
  */
 
 class ObjectId {
@@ -166,9 +165,12 @@ public:
   ~ObjectId ();
 
   ObjectId &     operator=  (const ObjectId &);
-  CORBA::Boolean operator== (const ObjectId &);
+  CORBA::Boolean operator== (const ObjectId &) const;
   bool           operator<  (const ObjectId &) const;
 
+  CORBA::ULong hash () const
+  { return hashval; }
+
   // get reference
   const char * get_data (CORBA::ULong &) const;
   const PortableServer::ObjectId & get_id ();
@@ -177,9 +179,12 @@ public:
   PortableServer::ObjectId * id ();
 
 private:
+  void make_hash ();
+
   bool own;
   char * octets;
   CORBA::ULong idlength;
+  CORBA::ULong hashval;
   PortableServer::ObjectId * oid;
 };
 
@@ -251,8 +256,10 @@ private:
 /*
  * Data structure for our Active Object Map.
  *
- * We maintain two maps so that we can search efficiently for Object Ids
- * and Servants.
+ * We maintain two hash tables so that we can search efficiently for
+ * Object Ids and Servants. Both use open addressing with linear probing;
+ * the records of a servant with several Ids are linked to each other.
+ * The map is protected by the ObjectActivationLock of its POA.
  */
 
 class ObjectMap {
@@ -278,12 +285,50 @@ public:
 
     POAObjectReference * por;
     PortableServer::Servant serv;
+
+    // key in the map, and other records of the same servant
+    ObjectId oid;
+    ObjectRecord * sv_prev;
+    ObjectRecord * sv_next;
+  };
+
+  struct IdSlot {
+    CORBA::ULong hash;
+    ObjectRecord * rec;
+  };
+
+  struct SvSlot {
+    PortableServer::Servant serv;
+    ObjectRecord * recs;
   };
 
-  typedef std::map<ObjectId, ObjectRecord *, std::less<ObjectId> > IdMap;
-  typedef IdMap::iterator iterator;
+  class iterator {
+  public:
+    iterator (IdSlot * s, IdSlot * e)
+      : slot (s), last (e)
+    { skip (); }
+
+    ObjectRecord * operator* () const
+    { return slot->rec; }
+    iterator & operator++ ()
+    { ++slot; skip (); return *this; }
+    iterator operator++ (int)
+    { iterator i = *this; ++*this; return i; }
+    bool operator== (const iterator & i) const
+    { return slot == i.slot; }
+    bool operator!= (const iterator & i) const
+    { return slot != i.slot; }
+
+  private:
+    void skip ()
+    { while (slot != last && !slot->rec) ++slot; }
+
+    IdSlot * slot;
+    IdSlot * last;
+  };
 
 public:
+  ObjectMap ();
   ~ObjectMap ();
 
   bool empty () const;
@@ -310,11 +355,22 @@ public:
   ObjectRecord * find (PortableServer::Servant);
 
 private:
-  typedef std::map<PortableServer::Servant, std::vector<ObjectRecord *>,
-    std::less<PortableServer::Servant> > SvMap;
-
-  IdMap objs;
-  SvMap servants;
+  CORBA::Long id_slot (const ObjectId &);
+  CORBA::Long sv_slot (PortableServer::Servant);
+  void id_remove (CORBA::ULong);
+  void sv_remove (CORBA::ULong);
+  void id_grow ();
+  void sv_grow ();
+  void unlink (ObjectRecord *);
+
+  static CORBA::ULong sv_hash (PortableServer::Servant);
+
+  IdSlot * objs;
+  CORBA::ULong nobjs, objcap;
+  CORBA::ULong popslot;
+
+  SvSlot * servants;
+  CORBA::ULong nservants, servcap;
 };
 
 /*
@@ -641,6 +697,7 @@ public:
   const char *   get_oaid   () const;
   CORBA::Boolean has_object (CORBA::Object_ptr);
   CORBA::Boolean is_local   () const;
+  void get_key_prefixes (std::vector<std::string> &) const;
 
 #ifdef USE_CSL2
   CORBA::Principal_ptr get_principal (CORBA::Object_ptr);
@@ -39,23 +39,10 @@ class PollDispatcher : public CORBA::Dispatcher {
             : event(_ev), fd(_fd), cb(_cb), deleted(FALSE), pollidx(-1)
         {}
     };
-    struct TimerEvent {
-        Event event;
-        CORBA::Long delta;
-        CORBA::DispatcherCallback *cb;
-
-        TimerEvent () {}
-        TimerEvent (Event _ev, CORBA::Long _delta,
-                    CORBA::DispatcherCallback *_cb)
-            : event(_ev), delta(_delta), cb(_cb)
-        {}
-    };
 
     std::list<FileEvent> fevents;
-    std::list<TimerEvent> tevents;
+    TimerWheel tevents;
 
-    CORBA::Long last_update;
-    CORBA::Boolean init;
     CORBA::Long locked;
 
     CORBA::Boolean has_deleted_fevents;
@@ -69,7 +56,6 @@ class PollDispatcher : public CORBA::Dispatcher {
 
     CORBA::Long gettime () const;
     void build_pollset  ();
-    void update_tevents ();
     void handle_tevents ();
     void handle_fevents ();
     CORBA::Long sleeptime ();
@@ -40,23 +40,10 @@ class SelectDispatcher : public CORBA::Dispatcher {
 	    : event(_ev), fd(_fd), cb(_cb), deleted(FALSE)
 	{}
     };
-    struct TimerEvent {
-	Event event;
-	CORBA::Long delta;
-	CORBA::DispatcherCallback *cb;
-
-	TimerEvent () {}
-	TimerEvent (Event _ev, CORBA::Long _delta,
-		    CORBA::DispatcherCallback *_cb)
-	    : event(_ev), delta(_delta), cb(_cb)
-	{}
-    };
 
     std::list<FileEvent> fevents;
-    std::list<TimerEvent> tevents;
+    TimerWheel tevents;
 
-    CORBA::Long last_update;
-    CORBA::Boolean init;
     CORBA::Long locked;
     CORBA::Boolean modified;
     FDSet curr_wset, curr_rset, curr_xset;
@@ -67,7 +54,6 @@ class SelectDispatcher : public CORBA::Dispatcher {
     CORBA::Boolean islocked () const;
 
     CORBA::Long gettime () const;
-    void update_tevents ();
     void handle_tevents ();
     void handle_fevents (FDSet &rset, FDSet &wset, FDSet &xset);
     void update_fevents ();
@@ -26,6 +26,41 @@
 
 template<class T> class TSeqVar;
 
+namespace CORBA {
+    class Buffer;
+    struct BufferShare;
+}
+
+/*
+ * Elements a sequence of octets or chars borrows from the CORBA::Buffer
+ * it was demarshalled from instead of copying them, see Buffer::loan().
+ * A loan is shared by the copies of a sequence and keeps the memory of
+ * the buffer alive; the elements are copied on the first change.
+ */
+class MICO_EXPORT SequenceLoan {
+    friend class CORBA::Buffer;
+
+    MICO_Long _refs;
+    CORBA::BufferShare *_share;
+    const void *_data;
+    MICO_ULong _len;
+
+    SequenceLoan (CORBA::BufferShare *, const void *data, MICO_ULong len);
+    ~SequenceLoan ();
+public:
+    static SequenceLoan *_duplicate (SequenceLoan *);
+    static void _release (SequenceLoan *);
+
+    const void *data () const
+    {
+	return _data;
+    }
+    MICO_ULong length () const
+    {
+	return _len;
+    }
+};
+
 
 /*
  * C++ template for unbounded sequences. The element type of the sequence
@@ -39,9 +74,22 @@ public:
     typedef TSeqVar<SequenceTmpl<T,TID> > _var_type;
 private:
     std::vector<T> vec;
+    // only sequences of octets and chars are lent their elements. the
+    // ORB uses SequenceTmpl for StringSequenceTmpl and others which
+    // lack this member, so it must not be touched for other types.
+    SequenceLoan *loan;
+
+    MICO_Boolean _loaned () const
+    {
+	return sizeof (T) == 1 && loan;
+    }
+    void _unloan ();
 public:
-    SequenceTmpl () {}
+    SequenceTmpl ()
+	: loan (0)
+    {}
     SequenceTmpl (MICO_ULong maxval)
+	: loan (0)
     {
 	vec.reserve (maxval);
     }
@@ -51,10 +99,13 @@ public:
     SequenceTmpl (const SequenceTmpl<T,TID> &s)
     {
 	vec = s.vec;
+	loan = s._loaned () ? SequenceLoan::_duplicate (s.loan) : 0;
     }
     
     ~SequenceTmpl ()
     {
+	if (_loaned ())
+	    SequenceLoan::_release (loan);
     }
     
     void replace (MICO_ULong max, MICO_ULong length, T *value,
@@ -62,12 +113,34 @@ public:
 
     SequenceTmpl<T,TID> &operator= (const SequenceTmpl<T,TID> &s)
     {
-	vec = s.vec;
+	if (this != &s) {
+	    vec = s.vec;
+	    if (sizeof (T) == 1) {
+		if (loan)
+		    SequenceLoan::_release (loan);
+		loan = s.loan ? SequenceLoan::_duplicate (s.loan) : 0;
+	    }
+	}
 	return *this;
     }
 
+    /*
+     * takes over the elements of l instead of a copy of them, used by
+     * the marshallers of sequence<octet> and sequence<char>
+     */
+    void _loan (SequenceLoan *l)
+    {
+	assert (sizeof (T) == 1);
+	vec.erase (vec.begin(), vec.end());
+	if (loan)
+	    SequenceLoan::_release (loan);
+	loan = l;
+    }
+
     MICO_ULong maximum () const
     {
+	if (_loaned ())
+	    return loan->length ();
 	return vec.capacity ();
     }
 
@@ -81,6 +154,8 @@ public:
 
     const T* get_buffer () const
     {
+	if (_loaned ())
+	    return (const T *)loan->data ();
 	assert (vec.size() > 0);
 	return &vec[0];
     }
@@ -119,6 +194,7 @@ public:
 template<class T, int TID>
 SequenceTmpl<T,TID>::SequenceTmpl (MICO_ULong maxval, MICO_ULong lengthval, T *value,
 				   MICO_Boolean rel)
+    : loan (0)
 {
     assert (lengthval <= maxval);
     vec.reserve (maxval);
@@ -133,6 +209,10 @@ SequenceTmpl<T,TID>::replace (MICO_ULong maxval, MICO_ULong lengthval, T *value,
 			      MICO_Boolean rel)
 {
     assert (lengthval <= maxval);
+    if (_loaned ()) {
+	SequenceLoan::_release (loan);
+	loan = 0;
+    }
     vec.erase (vec.begin(), vec.end());
     vec.reserve (maxval);
     vec.insert (vec.begin(), value, value+lengthval);
@@ -140,10 +220,23 @@ SequenceTmpl<T,TID>::replace (MICO_ULong maxval, MICO_ULong lengthval, T *value,
 	freebuf (value);
 }
 
+template<class T, int TID>
+void
+SequenceTmpl<T,TID>::_unloan ()
+{
+    const T *b = (const T *)loan->data ();
+    vec.reserve (loan->length ());
+    vec.insert (vec.end(), b, b + loan->length ());
+    SequenceLoan::_release (loan);
+    loan = 0;
+}
+
 template<class T, int TID>
 void
 SequenceTmpl<T,TID>::length (MICO_ULong l)
 {
+    if (_loaned ())
+	_unloan ();
     if (l < vec.size ()) {
 	vec.erase (vec.begin() + l, vec.end());
     } else if (l > vec.size()) {
@@ -158,6 +251,8 @@ template<class T, int TID>
 inline MICO_ULong
 SequenceTmpl<T,TID>::length () const
 {
+  if (_loaned ())
+    return loan->length ();
   // The MICO_ULong cast is needed for Win64/VC++ 10.0
   return (MICO_ULong)vec.size ();
 }
@@ -166,6 +261,8 @@ template<class T, int TID>
 inline T &
 SequenceTmpl<T,TID>::operator[] (MICO_ULong idx)
 {
+    if (_loaned ())
+	_unloan ();
     return vec[idx];
 }
     
@@ -174,6 +271,8 @@ template<class T, int TID>
 inline const T &
 SequenceTmpl<T,TID>::operator[] (MICO_ULong idx) const
 {
+    if (_loaned ())
+	return ((const T *)loan->data ())[idx];
     return vec[idx];
 }
 
@@ -181,6 +280,8 @@ template<class T, int TID>
 T *
 SequenceTmpl<T,TID>::get_buffer (MICO_Boolean orphan)
 {
+    if (_loaned ())
+	_unloan ();
     if (orphan) {
         // The MICO_ULong cast is needed for Win64/VC++ 10.0
         T *b = allocbuf ((MICO_ULong)vec.capacity());
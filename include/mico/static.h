@@ -139,7 +139,18 @@ class StaticRequest;
 typedef StaticRequest *StaticRequest_ptr;
 
 class StaticRequest : public CORBA::ORBRequest {
-    CORBA::String_var _opname;
+    enum { INLINE_ARGS = 6 };
+
+    const char *_opname;
+    CORBA::String_var _opname_copy;
+    /*
+     * the arguments of an operation with up to INLINE_ARGS arguments
+     * are kept in _inline. _args is filled only when there are more
+     * of them or when someone needs them as a list (interceptors,
+     * collocated calls); from then on it holds all of them.
+     */
+    StaticAny *_inline[INLINE_ARGS];
+    CORBA::ULong _nargs;
     StaticAnyList _args;
     StaticAny *_res;
     CORBA::Context_ptr _ctx;
@@ -150,11 +161,33 @@ class StaticRequest : public CORBA::ORBRequest {
     CORBA::ORBMsgId_var _id;
     // PI client interceptor request info
     PInterceptor::ClientRequestInfo_impl* _cri;
+    // passed to a colocated servant by StubBase::_invoke_local()
+    CORBA::Boolean _local;
 
     CORBA::Boolean copy (StaticAnyList *t, StaticAnyList *f, CORBA::Flags);
+    CORBA::Boolean copy_cdr (StaticAny *dres, StaticAnyList *dst,
+			     StaticAny *sres, StaticAnyList *src,
+			     CORBA::Flags);
     CORBA::Environment_ptr env ();
+
+    StaticAny *arg (CORBA::ULong i)
+    {
+	return _args.empty() ? _inline[i] : _args[i];
+    }
+    StaticAnyList *args ();
+    // the list for the PI calls, which only look at it with a CRI
+    StaticAnyList &pi_args ()
+    {
+	return _cri ? *args() : _args;
+    }
+    void add_arg (StaticAny *, CORBA::Flags);
 public:
-    StaticRequest (CORBA::Object_ptr, const char *opname);
+    /*
+     * the stubs pass static_opname = TRUE for their operation name
+     * literals, which saves a copy of the name for every call.
+     */
+    StaticRequest (CORBA::Object_ptr, const char *opname,
+		   CORBA::Boolean static_opname = FALSE);
     ~StaticRequest ();
 
     // ServerRequestBase methods
@@ -212,6 +245,15 @@ public:
 
     void invoke ();
     void oneway ();
+    /*
+     * while local is set, arguments and results are copied through a
+     * CDR buffer instead of one by one, which keeps valuetypes shared
+     * among them shared
+     */
+    void local (CORBA::Boolean l)
+    {
+	_local = l;
+    }
   
     void send_deferred ();
     void get_response ();
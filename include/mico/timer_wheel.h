@@ -0,0 +1,133 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 2004-2010 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_timer_wheel_h__
+#define __mico_timer_wheel_h__
+
+namespace MICO {
+
+/*
+ * Hierarchical timing wheel holding the timer events of a dispatcher.
+ *
+ * Timers have millisecond resolution. Level 0 has 256 slots of one
+ * millisecond, each of the four upper levels has 64 slots spanning a
+ * full turn of the level below. Timers are cascaded down to the next
+ * level as time advances, so adding and cancelling a timer takes
+ * constant time. Timers are found by callback through a map, which
+ * makes remove() logarithmic in the number of distinct callbacks.
+ *
+ * All operations take the current time in milliseconds; only the
+ * difference between successive values matters, a clock going
+ * backwards is treated as no time having passed.
+ */
+class TimerWheel {
+public:
+    typedef CORBA::Dispatcher::Event Event;
+
+    struct TimerEvent {
+        Event event;
+        CORBA::ULong tmout;
+        CORBA::DispatcherCallback *cb;
+    };
+
+    TimerWheel ();
+    ~TimerWheel ();
+
+    void add (CORBA::DispatcherCallback *, Event, CORBA::ULong tmout,
+              CORBA::ULong now);
+    void remove (CORBA::DispatcherCallback *);
+
+    // pop the next expired timer, FALSE if there is none
+    CORBA::Boolean expired (CORBA::ULong now, TimerEvent &);
+    // milliseconds until the next timer may expire, -1 if there is none
+    CORBA::Long next_timeout (CORBA::ULong now);
+    // remove all timers, tmout is set to the time remaining
+    void drain (CORBA::ULong now, std::vector<TimerEvent> &);
+
+    CORBA::Boolean empty () const
+    {
+        return _size == 0;
+    }
+    CORBA::ULong size () const
+    {
+        return _size;
+    }
+
+private:
+    enum {
+        L0_BITS = 8,
+        LN_BITS = 6,
+        L0_SIZE = 1 << L0_BITS,
+        LN_SIZE = 1 << LN_BITS,
+        L0_MASK = L0_SIZE - 1,
+        LN_MASK = LN_SIZE - 1,
+        LEVELS = 5,
+        SLOTS = L0_SIZE + (LEVELS-1) * LN_SIZE,
+        // level of timers that are due but not yet popped
+        DUE = LEVELS
+    };
+
+    struct Node {
+        // slot list
+        Node *next, *prev;
+        // timers of the same callback
+        Node *cb_next, *cb_prev;
+        CORBA::ULong expires;
+        CORBA::Long level;
+        Event event;
+        CORBA::DispatcherCallback *cb;
+    };
+    typedef std::map<CORBA::DispatcherCallback *, Node *> CBMap;
+
+    // slot list heads, level 0 first
+    Node _slots[SLOTS];
+    Node _due;
+    CORBA::ULong _counts[LEVELS+1];
+    CBMap _cbs;
+    Node *_free;
+    CORBA::ULong _size;
+
+    // current time and next tick to be processed
+    CORBA::ULong _time;
+    CORBA::ULong _tick;
+    CORBA::ULong _last;
+    CORBA::Boolean _init;
+
+    Node *slot (CORBA::Long level, CORBA::ULong idx);
+    Node *alloc ();
+    void dealloc (Node *);
+    void link (Node *head, Node *, CORBA::Long level);
+    void unlink (Node *);
+    void unlink_cb (Node *);
+    void place (Node *);
+    CORBA::ULong cascade (CORBA::Long level);
+    void update (CORBA::ULong now);
+    void run ();
+
+    TimerWheel (const TimerWheel &);
+    TimerWheel &operator= (const TimerWheel &);
+};
+
+}
+
+#endif // __mico_timer_wheel_h__
@@ -98,6 +98,14 @@ class Transport {
 public:
     enum State { Closed, Open };
 
+    // one segment of a gather write
+    struct IOVec {
+        const void *base;
+        ULong len;
+    };
+    // max number of segments passed to writev() at once
+    enum { MAX_IOV = 64 };
+
     virtual void rselect (Dispatcher *, TransportCallback *) = 0;
     virtual void wselect (Dispatcher *, TransportCallback *) = 0;
 
@@ -114,7 +122,9 @@ public:
     Long read (Buffer &, Long len);
     virtual Long read (void *, Long len) = 0;
     Long write (Buffer &, Long len, Boolean eat = TRUE);
+    Long write (Buffer **, ULong nbufs, Boolean eat = TRUE);
     virtual Long write (const void *, Long len) = 0;
+    virtual Long writev (const IOVec *, ULong cnt);
 
     virtual const Address *addr () = 0;
     virtual const Address *peer () = 0;
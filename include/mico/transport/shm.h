@@ -0,0 +1,123 @@
+// -*- c++ -*-
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2007 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifndef __mico_transport_shm_h__
+#define __mico_transport_shm_h__
+
+#if defined(HAVE_SYS_UN_H) && defined(HAVE_SYS_MMAN_H) && \
+    defined(HAVE_GCC_ATOMICS)
+#define HAVE_SHM_TRANSPORT
+#endif
+
+namespace MICO {
+
+#ifdef HAVE_SHM_TRANSPORT
+/*
+ * transport for processes on the same host. the connection is made
+ * over a unix socket, then the client hands the server a shared memory
+ * segment with one ring buffer per direction and a second socket. the
+ * data goes through the rings, the sockets only carry one byte wakeups
+ * for a peer that waits for data (first socket) or for room in a full
+ * ring (second socket), so the dispatcher can wait for both and a
+ * peer that goes away shows up as end of file.
+ */
+class ShmTransport : public SocketTransport {
+    struct Ring;
+
+    struct SpaceCallback : public CORBA::DispatcherCallback {
+	ShmTransport *_t;
+	void callback (CORBA::Dispatcher *, CORBA::Dispatcher::Event);
+    };
+    friend struct SpaceCallback;
+
+    UnixAddress local_addr, peer_addr;
+    CORBA::Long sfd;
+    CORBA::Octet *seg;
+    CORBA::ULong seglen;
+    CORBA::ULong ringlen;
+    Ring *rx, *tx;
+    CORBA::Octet *rxdata, *txdata;
+    SpaceCallback space_cb;
+    CORBA::Boolean wspace;
+    CORBA::Boolean kicked;
+
+    static CORBA::ULong _ring_size;
+
+    static CORBA::ULong segment_length (CORBA::ULong ringlen);
+    CORBA::Boolean map (CORBA::Long segfd, CORBA::Boolean client);
+    CORBA::Boolean attach ();
+    void unmap ();
+    CORBA::Long get (CORBA::Octet *, CORBA::ULong len);
+    CORBA::Long put (const IOVec *, CORBA::ULong cnt, CORBA::ULong skip);
+    CORBA::Boolean drain (CORBA::Long fd);
+    CORBA::Boolean has_input ();
+    void kick ();
+    void wait_for_space ();
+    void space_callback (CORBA::Dispatcher *, CORBA::Dispatcher::Event);
+public:
+    ShmTransport ();
+    ~ShmTransport ();
+
+    CORBA::Boolean bind (const CORBA::Address *);
+    CORBA::Boolean connect (const CORBA::Address *, CORBA::ULong, CORBA::Boolean&);
+
+    void open (CORBA::Long fd = -1);
+    void close ();
+
+    void rselect (CORBA::Dispatcher *, CORBA::TransportCallback *);
+    void wselect (CORBA::Dispatcher *, CORBA::TransportCallback *);
+    void callback (CORBA::Dispatcher *, CORBA::Dispatcher::Event);
+    void block (CORBA::Boolean doblock = TRUE);
+    CORBA::Boolean isreadable ();
+
+    CORBA::Long read (void *, CORBA::Long len);
+    CORBA::Long write (const void *, CORBA::Long len);
+    CORBA::Long writev (const IOVec *, CORBA::ULong cnt);
+
+    const CORBA::Address *addr ();
+    const CORBA::Address *peer ();
+
+    // size of each of the two rings of new connections
+    static void ring_size (CORBA::ULong);
+    static CORBA::ULong ring_size ();
+};
+
+class ShmTransportServer : public SocketTransportServer {
+
+    UnixAddress local_addr;
+
+public:
+    ShmTransportServer ();
+
+    CORBA::Boolean bind (const CORBA::Address *);
+    void close ();
+
+    CORBA::Transport *accept ();
+    const CORBA::Address *addr ();
+    void listen ();
+};
+#endif // HAVE_SHM_TRANSPORT
+
+}
+
+#endif // __mico_transport_shm_h__
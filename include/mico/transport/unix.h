@@ -38,6 +38,9 @@ public:
      
     CORBA::Long read (void *, CORBA::Long len);
     CORBA::Long write (const void *, CORBA::Long len);
+#ifdef HAVE_SYS_UIO_H
+    CORBA::Long writev (const IOVec *, CORBA::ULong cnt);
+#endif
     
     const CORBA::Address *addr ();
     const CORBA::Address *peer ();
@@ -44,6 +44,10 @@ class TypeCode : public ServerlessObject {
     UShort digits;
     Short scale;
     ValueModifier value_mod;
+    // structural fingerprint and a serial number naming this state of
+    // the typecode, 0 if not computed yet. see fingerprint().
+    mutable ULong fp;
+    mutable ULongLong fp_serial;
 
     void init ();
     void copy (const TypeCode &);
@@ -60,6 +64,10 @@ class TypeCode : public ServerlessObject {
     void strip();
     void connect (TypeCode_ptr, Long depth = 0);
     CORBA::ULong get_recurse_depth();
+    Boolean fingerprint (ULong &fp, ULongLong &serial) const;
+    Boolean compare (TypeCode_ptr, Boolean remove_aliases,
+		     Boolean ignore_string_bounds) const;
+    Boolean compare_type (TypeCode_ptr, SetTC *);
     static CORBA::Any *convert_case_label (CORBA::TypeCode_ptr disc,
 					   const CORBA::Any &);
 public:
@@ -73,6 +81,7 @@ public:
     TypeCode (DataDecoder &);
     TypeCode &operator= (const TypeCode &);
     Boolean from_string (const char *);
+    static void _init ();
 
     static TypeCode_ptr create_basic_tc (TCKind);
     static TypeCode_ptr create_struct_tc (const char *rep_id, const char *name,
@@ -166,6 +175,30 @@ public:
     void encode (DataEncoder &, MapTCPos * = NULL) const;
     Boolean decode (DataDecoder &, MapPosTC * = NULL, ULong level = 0);
 
+    /*
+     * decode a typecode which is shared with all others decoded from
+     * the same bytes, so it must not be changed.
+     */
+    static TypeCode_ptr decode_shared (DataDecoder &);
+
+    /*
+     * decode_shared() caches at most entries typecodes whose encodings
+     * take at most bytes octets. when the cache is full it evicts the
+     * least recently used typecode (lru) or stops adding new ones.
+     * entries = 0 disables the cache.
+     */
+    struct CacheStats {
+	ULong hits;
+	ULong misses;
+	ULong entries;
+	ULong bytes;
+	ULong max_entries;
+	ULong max_bytes;
+	Boolean lru;
+    };
+    static void cache_limits (ULong entries, ULong bytes, Boolean lru);
+    static void cache_stats (CacheStats &);
+
     std::string stringify () const;
 
     Boolean is_recursive_seq ();
@@ -113,7 +113,7 @@ public:
 
 template<class V>
 inline CORBA::Long
-mico_vec_compare (V v1, V v2)
+mico_vec_compare (const V &v1, const V &v2)
 {
     typename V::size_type len = v1.size() < v2.size() ? v1.size() : v2.size();
     for (typename V::size_type i = 0; i < len; ++i) {
@@ -210,7 +210,7 @@ CORBA::ComponentIR::ComponentDef_ptr CORBA::ComponentIR::ComponentDef_stub::base
   CORBA::ComponentIR::ComponentDef_ptr _res = CORBA::ComponentIR::ComponentDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_ComponentDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_base_component" );
+  CORBA::StaticRequest __req( this, "_get_base_component", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -260,7 +260,7 @@ CORBA::ComponentIR::ComponentDef_stub_clp::base_component()
 void CORBA::ComponentIR::ComponentDef_stub::base_component( CORBA::ComponentIR::ComponentDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ComponentIR_ComponentDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_base_component" );
+  CORBA::StaticRequest __req( this, "_set_base_component", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -308,7 +308,7 @@ CORBA::InterfaceDefSeq* CORBA::ComponentIR::ComponentDef_stub::supported_interfa
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_InterfaceDef );
 
-  CORBA::StaticRequest __req( this, "_get_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_get_supported_interfaces", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -358,7 +358,7 @@ CORBA::ComponentIR::ComponentDef_stub_clp::supported_interfaces()
 void CORBA::ComponentIR::ComponentDef_stub::supported_interfaces( const CORBA::InterfaceDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_set_supported_interfaces", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -411,7 +411,7 @@ CORBA::ComponentIR::ProvidesDef_ptr CORBA::ComponentIR::ComponentDef_stub::creat
   CORBA::ComponentIR::ProvidesDef_ptr _res = CORBA::ComponentIR::ProvidesDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_ProvidesDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_provides" );
+  CORBA::StaticRequest __req( this, "create_provides", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -472,7 +472,7 @@ CORBA::ComponentIR::UsesDef_ptr CORBA::ComponentIR::ComponentDef_stub::create_us
   CORBA::ComponentIR::UsesDef_ptr _res = CORBA::ComponentIR::UsesDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_UsesDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_uses" );
+  CORBA::StaticRequest __req( this, "create_uses", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -533,7 +533,7 @@ CORBA::ComponentIR::EmitsDef_ptr CORBA::ComponentIR::ComponentDef_stub::create_e
   CORBA::ComponentIR::EmitsDef_ptr _res = CORBA::ComponentIR::EmitsDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_EmitsDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_emits" );
+  CORBA::StaticRequest __req( this, "create_emits", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -593,7 +593,7 @@ CORBA::ComponentIR::PublishesDef_ptr CORBA::ComponentIR::ComponentDef_stub::crea
   CORBA::ComponentIR::PublishesDef_ptr _res = CORBA::ComponentIR::PublishesDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_PublishesDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_publishes" );
+  CORBA::StaticRequest __req( this, "create_publishes", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -653,7 +653,7 @@ CORBA::ComponentIR::ConsumesDef_ptr CORBA::ComponentIR::ComponentDef_stub::creat
   CORBA::ComponentIR::ConsumesDef_ptr _res = CORBA::ComponentIR::ConsumesDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_ConsumesDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_consumes" );
+  CORBA::StaticRequest __req( this, "create_consumes", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -901,7 +901,7 @@ CORBA::ComponentIR::HomeDef_ptr CORBA::ComponentIR::HomeDef_stub::base_home()
   CORBA::ComponentIR::HomeDef_ptr _res = CORBA::ComponentIR::HomeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_HomeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_base_home" );
+  CORBA::StaticRequest __req( this, "_get_base_home", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -951,7 +951,7 @@ CORBA::ComponentIR::HomeDef_stub_clp::base_home()
 void CORBA::ComponentIR::HomeDef_stub::base_home( CORBA::ComponentIR::HomeDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ComponentIR_HomeDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_base_home" );
+  CORBA::StaticRequest __req( this, "_set_base_home", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -999,7 +999,7 @@ CORBA::InterfaceDefSeq* CORBA::ComponentIR::HomeDef_stub::supported_interfaces()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_InterfaceDef );
 
-  CORBA::StaticRequest __req( this, "_get_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_get_supported_interfaces", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -1049,7 +1049,7 @@ CORBA::ComponentIR::HomeDef_stub_clp::supported_interfaces()
 void CORBA::ComponentIR::HomeDef_stub::supported_interfaces( const CORBA::InterfaceDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_set_supported_interfaces", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -1098,7 +1098,7 @@ CORBA::ComponentIR::ComponentDef_ptr CORBA::ComponentIR::HomeDef_stub::managed_c
   CORBA::ComponentIR::ComponentDef_ptr _res = CORBA::ComponentIR::ComponentDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_ComponentDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_managed_component" );
+  CORBA::StaticRequest __req( this, "_get_managed_component", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -1148,7 +1148,7 @@ CORBA::ComponentIR::HomeDef_stub_clp::managed_component()
 void CORBA::ComponentIR::HomeDef_stub::managed_component( CORBA::ComponentIR::ComponentDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ComponentIR_ComponentDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_managed_component" );
+  CORBA::StaticRequest __req( this, "_set_managed_component", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -1197,7 +1197,7 @@ CORBA::ValueDef_ptr CORBA::ComponentIR::HomeDef_stub::primary_key()
   CORBA::ValueDef_ptr _res = CORBA::ValueDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ValueDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_primary_key" );
+  CORBA::StaticRequest __req( this, "_get_primary_key", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -1247,7 +1247,7 @@ CORBA::ComponentIR::HomeDef_stub_clp::primary_key()
 void CORBA::ComponentIR::HomeDef_stub::primary_key( CORBA::ValueDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ValueDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_primary_key" );
+  CORBA::StaticRequest __req( this, "_set_primary_key", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -1301,7 +1301,7 @@ CORBA::ComponentIR::FactoryDef_ptr CORBA::ComponentIR::HomeDef_stub::create_fact
   CORBA::ComponentIR::FactoryDef_ptr _res = CORBA::ComponentIR::FactoryDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_FactoryDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_factory" );
+  CORBA::StaticRequest __req( this, "create_factory", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1363,7 +1363,7 @@ CORBA::ComponentIR::FinderDef_ptr CORBA::ComponentIR::HomeDef_stub::create_finde
   CORBA::ComponentIR::FinderDef_ptr _res = CORBA::ComponentIR::FinderDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_FinderDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_finder" );
+  CORBA::StaticRequest __req( this, "create_finder", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1809,7 +1809,7 @@ CORBA::ComponentIR::ComponentDef_ptr CORBA::ComponentIR::Container_stub::create_
   CORBA::ComponentIR::ComponentDef_ptr _res = CORBA::ComponentIR::ComponentDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_ComponentDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_component" );
+  CORBA::StaticRequest __req( this, "create_component", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1873,7 +1873,7 @@ CORBA::ComponentIR::HomeDef_ptr CORBA::ComponentIR::Container_stub::create_home(
   CORBA::ComponentIR::HomeDef_ptr _res = CORBA::ComponentIR::HomeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_HomeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_home" );
+  CORBA::StaticRequest __req( this, "create_home", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1942,7 +1942,7 @@ CORBA::ComponentIR::EventDef_ptr CORBA::ComponentIR::Container_stub::create_even
   CORBA::ComponentIR::EventDef_ptr _res = CORBA::ComponentIR::EventDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_EventDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_event" );
+  CORBA::StaticRequest __req( this, "create_event", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2598,7 +2598,7 @@ CORBA::InterfaceDef_ptr CORBA::ComponentIR::ProvidesDef_stub::interface_type()
   CORBA::InterfaceDef_ptr _res = CORBA::InterfaceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_InterfaceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_interface_type" );
+  CORBA::StaticRequest __req( this, "_get_interface_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -2648,7 +2648,7 @@ CORBA::ComponentIR::ProvidesDef_stub_clp::interface_type()
 void CORBA::ComponentIR::ProvidesDef_stub::interface_type( CORBA::InterfaceDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_interface_type" );
+  CORBA::StaticRequest __req( this, "_set_interface_type", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3012,7 +3012,7 @@ CORBA::InterfaceDef_ptr CORBA::ComponentIR::UsesDef_stub::interface_type()
   CORBA::InterfaceDef_ptr _res = CORBA::InterfaceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_InterfaceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_interface_type" );
+  CORBA::StaticRequest __req( this, "_get_interface_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3062,7 +3062,7 @@ CORBA::ComponentIR::UsesDef_stub_clp::interface_type()
 void CORBA::ComponentIR::UsesDef_stub::interface_type( CORBA::InterfaceDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_interface_type" );
+  CORBA::StaticRequest __req( this, "_set_interface_type", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3111,7 +3111,7 @@ CORBA::Boolean CORBA::ComponentIR::UsesDef_stub::is_multiple()
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_is_multiple" );
+  CORBA::StaticRequest __req( this, "_get_is_multiple", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3161,7 +3161,7 @@ CORBA::ComponentIR::UsesDef_stub_clp::is_multiple()
 void CORBA::ComponentIR::UsesDef_stub::is_multiple( CORBA::Boolean _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_boolean, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_is_multiple" );
+  CORBA::StaticRequest __req( this, "_set_is_multiple", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3529,7 +3529,7 @@ CORBA::ComponentIR::EventDef_ptr CORBA::ComponentIR::EventPortDef_stub::event()
   CORBA::ComponentIR::EventDef_ptr _res = CORBA::ComponentIR::EventDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ComponentIR_EventDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_event" );
+  CORBA::StaticRequest __req( this, "_get_event", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3579,7 +3579,7 @@ CORBA::ComponentIR::EventPortDef_stub_clp::event()
 void CORBA::ComponentIR::EventPortDef_stub::event( CORBA::ComponentIR::EventDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ComponentIR_EventDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_event" );
+  CORBA::StaticRequest __req( this, "_set_event", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3629,7 +3629,7 @@ CORBA::Boolean CORBA::ComponentIR::EventPortDef_stub::is_a( const char* _par_eve
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "is_a" );
+  CORBA::StaticRequest __req( this, "is_a", TRUE );
   __req.add_in_arg( &_sa_event_id );
   __req.set_result( &__res );
 
@@ -761,12 +761,14 @@ static MICO::InetAddressParser inet_address_parser;
 /****************************** UnixAddress *****************************/
 
 #ifdef HAVE_SYS_UN_H
-MICO::UnixAddress::UnixAddress (struct sockaddr_un &una)
+MICO::UnixAddress::UnixAddress (struct sockaddr_un &una, Family fam)
+    : _family (fam)
 {
     _filename = una.sun_path;
 }
 
-MICO::UnixAddress::UnixAddress (const char *filename)
+MICO::UnixAddress::UnixAddress (const char *filename, Family fam)
+    : _family (fam)
 {
     if (filename)
 	_filename = filename;
@@ -788,13 +790,34 @@ MICO::UnixAddress::stringify () const
 const char *
 MICO::UnixAddress::proto () const
 {
-    return "unix";
+    switch (_family) {
+    case STREAM:
+	return "unix";
+    case SHM:
+	return "shm";
+    default:
+	assert (0);
+	return 0;
+    }
 }
 
 CORBA::Transport *
 MICO::UnixAddress::make_transport () const
 {
-    CORBA::Transport *ret = new UnixTransport;
+    CORBA::Transport *ret;
+    switch (_family) {
+    case STREAM:
+	ret = new UnixTransport;
+	break;
+#ifdef HAVE_SHM_TRANSPORT
+    case SHM:
+	ret = new ShmTransport;
+	break;
+#endif
+    default:
+	assert (0);
+	return 0;
+    }
     ret->open();
     return ret;
 }
@@ -802,7 +825,17 @@ MICO::UnixAddress::make_transport () const
 CORBA::TransportServer *
 MICO::UnixAddress::make_transport_server () const
 {
-    return new UnixTransportServer;
+    switch (_family) {
+    case STREAM:
+	return new UnixTransportServer;
+#ifdef HAVE_SHM_TRANSPORT
+    case SHM:
+	return new ShmTransportServer;
+#endif
+    default:
+	assert (0);
+	return 0;
+    }
 }
 
 CORBA::IORProfile *
@@ -811,7 +844,16 @@ MICO::UnixAddress::make_ior_profile (CORBA::Octet *key,
 				     const CORBA::MultiComponent &mc,
                                      CORBA::UShort version) const
 {
-    return new UIOPProfile (key, len, *this, mc, version);
+    switch (_family) {
+    case STREAM:
+	return new UIOPProfile (key, len, *this, mc, version);
+    case SHM:
+	return new UIOPProfile (key, len, *this, mc, version,
+				CORBA::IORProfile::TAG_SHM_IOP);
+    default:
+	assert (0);
+	return 0;
+    }
 }
 
 CORBA::Boolean
@@ -841,6 +883,9 @@ MICO::UnixAddress::compare (const CORBA::Address &a) const
 
     const UnixAddress &he = (const UnixAddress &)a;
 
+    // need not compare _family, because each family has a different
+    // protocol identifier.
+
     return _filename.compare (he._filename);
 }
 
@@ -887,6 +932,18 @@ MICO::UnixAddress::sockaddr () const
     return una;
 }
 
+MICO::UnixAddress::Family
+MICO::UnixAddress::family () const
+{
+    return _family;
+}
+
+void
+MICO::UnixAddress::family (Family fam)
+{
+    _family = fam;
+}
+
 
 /*************************** UnixAddressParser **************************/
 
@@ -902,15 +959,22 @@ MICO::UnixAddressParser::~UnixAddressParser ()
 }
 
 CORBA::Address *
-MICO::UnixAddressParser::parse (const char *str, const char *) const
+MICO::UnixAddressParser::parse (const char *str, const char *proto) const
 {
+    if (!strcmp (proto, "shm"))
+	return new UnixAddress (str, MICO::UnixAddress::SHM);
     return new UnixAddress (str);
 }
 
 CORBA::Boolean
 MICO::UnixAddressParser::has_proto (const char *p) const
 {
-    return !strcmp ("unix", p);
+    return
+	!strcmp ("unix", p)
+#ifdef HAVE_SHM_TRANSPORT
+	|| !strcmp ("shm", p)
+#endif
+	;
 }
 
 static MICO::UnixAddressParser unix_address_parser;
@@ -965,11 +965,12 @@ CORBA::Any::encode (DataEncoder &e) const
 CORBA::Boolean
 CORBA::Any::decode (DataDecoder &e)
 {
-    TypeCode_ptr t = TypeCode::create_basic_tc (tk_null);
-    if (!e.get_typecode (*t) || !demarshal (t, e))
+    TypeCode_ptr t = TypeCode::decode_shared (e);
+    if (CORBA::is_nil (t))
 	return FALSE;
+    Boolean ret = demarshal (t, e);
     CORBA::release (t);
-    return TRUE;
+    return ret;
 }
 
 CORBA::Boolean
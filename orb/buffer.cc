@@ -41,11 +41,245 @@
 #endif
 #include <mico/template_impl.h>
 
+#ifdef HAVE_SOLARIS_ATOMICS
+#include <atomic.h>
+#endif // HAVE_SOLARIS_ATOMICS
+
 #endif // FAST_PCH
 
 
 using namespace std;
 
+
+/****************************** BufferPool ******************************/
+
+
+/*
+ * per thread cache of free buffer memory in power of two size classes.
+ * The blocks are allocated individually, so they can be freed by any
+ * thread and a pool can be thrown away without caring for blocks that
+ * are still in use.
+ */
+class BufferPool {
+public:
+    enum {
+	MINSHIFT = 7,
+	MAXSHIFT = 16,
+	CLASSES = MAXSHIFT - MINSHIFT + 1
+    };
+
+    static CORBA::ULong limit;
+
+    static BufferPool *get (CORBA::Boolean create);
+    static void destroy (void *);
+    static void stats (CORBA::Buffer::PoolStats &);
+    static void init ();
+
+    // size class of a block of sz bytes, -1 if not pooled
+    static CORBA::Long size_class (CORBA::ULong sz)
+    {
+	if (sz > (1UL << MAXSHIFT))
+	    return -1;
+	CORBA::Long c = 0;
+	while ((1UL << (c + MINSHIFT)) < sz)
+	    ++c;
+	return c;
+    }
+
+    CORBA::Octet *alloc (CORBA::Long c);
+    CORBA::Boolean free (CORBA::Octet *, CORBA::Long c);
+
+private:
+    struct Block {
+	Block *next;
+    };
+    Block *_free[CLASSES];
+    CORBA::ULong _pooled;
+    CORBA::ULong _hits;
+    CORBA::ULong _misses;
+    BufferPool *_next, *_prev;
+
+    // all pools, for statistics
+    static BufferPool *_pools;
+    static CORBA::ULong _hits_exited;
+    static CORBA::ULong _misses_exited;
+    static CORBA::Boolean _initialized;
+#ifdef HAVE_THREADS
+    static MICOMT::Mutex _pools_lock;
+    static MICOMT::Thread::ThreadKey _key;
+#else
+    static BufferPool *_pool;
+#endif
+
+    BufferPool ();
+    ~BufferPool ();
+};
+
+CORBA::ULong BufferPool::limit = 256*1024;
+BufferPool *BufferPool::_pools = 0;
+CORBA::ULong BufferPool::_hits_exited = 0;
+CORBA::ULong BufferPool::_misses_exited = 0;
+CORBA::Boolean BufferPool::_initialized = FALSE;
+#ifdef HAVE_THREADS
+MICOMT::Mutex BufferPool::_pools_lock;
+MICOMT::Thread::ThreadKey BufferPool::_key;
+#else
+BufferPool *BufferPool::_pool = 0;
+#endif
+
+BufferPool::BufferPool ()
+    : _pooled (0), _hits (0), _misses (0), _prev (0)
+{
+    for (CORBA::Long c = 0; c < CLASSES; ++c)
+	_free[c] = 0;
+
+    MICOMT::AutoLock l (_pools_lock);
+    _next = _pools;
+    if (_pools)
+	_pools->_prev = this;
+    _pools = this;
+}
+
+BufferPool::~BufferPool ()
+{
+    for (CORBA::Long c = 0; c < CLASSES; ++c) {
+	while (_free[c]) {
+	    Block *b = _free[c];
+	    _free[c] = b->next;
+	    ::free ((void *)b);
+	}
+    }
+
+    MICOMT::AutoLock l (_pools_lock);
+    if (_prev)
+	_prev->_next = _next;
+    else
+	_pools = _next;
+    if (_next)
+	_next->_prev = _prev;
+    _hits_exited += _hits;
+    _misses_exited += _misses;
+}
+
+void
+BufferPool::init ()
+{
+    if (_initialized)
+	return;
+#ifdef HAVE_THREADS
+    MICOMT::Thread::create_key (_key, BufferPool::destroy);
+#endif
+    _initialized = TRUE;
+}
+
+BufferPool *
+BufferPool::get (CORBA::Boolean create)
+{
+    if (!_initialized || limit == 0)
+	return 0;
+#ifdef HAVE_THREADS
+    BufferPool *p = (BufferPool *)MICOMT::Thread::get_specific (_key);
+    if (!p && create) {
+	p = new BufferPool;
+	MICOMT::Thread::set_specific (_key, p);
+    }
+    return p;
+#else
+    if (!_pool && create)
+	_pool = new BufferPool;
+    return _pool;
+#endif
+}
+
+void
+BufferPool::destroy (void *p)
+{
+    delete (BufferPool *)p;
+}
+
+void
+BufferPool::stats (CORBA::Buffer::PoolStats &st)
+{
+    MICOMT::AutoLock l (_pools_lock);
+    st.hits = _hits_exited;
+    st.misses = _misses_exited;
+    st.pooled = 0;
+    for (BufferPool *p = _pools; p; p = p->_next) {
+	st.hits += p->_hits;
+	st.misses += p->_misses;
+	st.pooled += p->_pooled;
+    }
+}
+
+CORBA::Octet *
+BufferPool::alloc (CORBA::Long c)
+{
+    Block *b = _free[c];
+    if (!b) {
+	++_misses;
+	return (CORBA::Octet *)::malloc (1UL << (c + MINSHIFT));
+    }
+    ++_hits;
+    _free[c] = b->next;
+    _pooled -= (1UL << (c + MINSHIFT));
+    return (CORBA::Octet *)b;
+}
+
+CORBA::Boolean
+BufferPool::free (CORBA::Octet *ptr, CORBA::Long c)
+{
+    CORBA::ULong sz = 1UL << (c + MINSHIFT);
+    if (_pooled + sz > limit)
+	return FALSE;
+    Block *b = (Block *)ptr;
+    b->next = _free[c];
+    _free[c] = b;
+    _pooled += sz;
+    return TRUE;
+}
+
+
+/******************************** Buffer *******************************/
+
+
+void
+CORBA::Buffer::_init ()
+{
+    BufferPool::init ();
+}
+
+void
+CORBA::Buffer::pool_limit (ULong bytes)
+{
+    BufferPool::limit = bytes;
+}
+
+CORBA::ULong
+CORBA::Buffer::pool_limit ()
+{
+    return BufferPool::limit;
+}
+
+void
+CORBA::Buffer::pool_stats (PoolStats &st)
+{
+    BufferPool::stats (st);
+}
+
+void *
+CORBA::Buffer::pool_alloc (size_t sz)
+{
+    ULong len = sz;
+    return alloc (len);
+}
+
+void
+CORBA::Buffer::pool_free (void *p, size_t sz)
+{
+    if (p)
+	free ((Octet *)p, sz);
+}
+
 CORBA::Buffer::Buffer (void *b)
 {
     // readonly buffer with given contents
@@ -53,6 +287,7 @@ CORBA::Buffer::Buffer (void *b)
     _rptr = 0;
     _ralignbase = _walignbase = 0;
     _buf = (Octet *)b;
+    _share = 0;
     _readonly = TRUE;
 }
 
@@ -65,25 +300,28 @@ CORBA::Buffer::Buffer (ULong sz)
     _len = sz;
     _rptr = _wptr = 0;
     _ralignbase = _walignbase = 0;
+    _share = 0;
     _readonly = FALSE;
 }
 
 CORBA::Buffer::Buffer (const Buffer &b)
 {
-    _buf = alloc (b._len);
-    memcpy (_buf, b._buf, b._len);
     _len = b._len;
+    _buf = alloc (_len);
+    memcpy (_buf, b._buf, b._len);
     _rptr = b._rptr;
     _wptr = b._wptr;
     _ralignbase = b._ralignbase;
     _walignbase = b._walignbase;
+    _share = 0;
     _readonly = FALSE;
 }
 
 CORBA::Buffer::~Buffer ()
 {
-    if (!_readonly)
-        free (_buf);
+    // with loans left the last of them frees the memory
+    if (!_readonly && (!_share || unshare ()))
+        free (_buf, _len);
 }
 
 CORBA::Buffer &
@@ -91,10 +329,11 @@ CORBA::Buffer::operator= (const Buffer &b)
 {
     if (this != &b) {
 	assert (!_readonly && !b._readonly);
-	free (_buf);
-	_buf = alloc (b._len);
-	memcpy (_buf, b._buf, b._len);
+	if (!_share || unshare ())
+	    free (_buf, _len);
 	_len = b._len;
+	_buf = alloc (_len);
+	memcpy (_buf, b._buf, b._len);
 	_rptr = b._rptr;
 	_wptr = b._wptr;
 	_ralignbase = b._ralignbase;
@@ -110,25 +349,50 @@ CORBA::Buffer::operator== (const Buffer &b)
     return length() == b.length() && !memcmp (data(), b.data(), length());
 }
 
+/*
+ * blocks of a pooled size are always allocated with the full size of
+ * their size class, so sz is rounded up and the size of a block tells
+ * whether it may go back to the pool.
+ */
 CORBA::Octet *
-CORBA::Buffer::alloc (ULong sz)
+CORBA::Buffer::alloc (ULong &sz)
 {
-    Octet *b = (Octet *)::malloc (sz);
+    Octet *b;
+    Long c = BufferPool::size_class (sz);
+    if (c >= 0) {
+	sz = 1UL << (c + BufferPool::MINSHIFT);
+	BufferPool *p = BufferPool::get (TRUE);
+	b = p ? p->alloc (c) : (Octet *)::malloc (sz);
+    } else {
+	b = (Octet *)::malloc (sz);
+    }
     assert (b);
     return b;
 }
 
 CORBA::Octet *
-CORBA::Buffer::realloc (Octet *b, ULong osz, ULong nsz)
+CORBA::Buffer::realloc (Octet *b, ULong osz, ULong &nsz)
 {
-    Octet *nb = (Octet *)::realloc ((void *)b, nsz);
-    assert (nb);
+    if (BufferPool::size_class (osz) < 0) {
+	Octet *nb = (Octet *)::realloc ((void *)b, nsz);
+	assert (nb);
+	return nb;
+    }
+    Octet *nb = alloc (nsz);
+    memcpy (nb, b, osz);
+    free (b, osz);
     return nb;
 }
 
 void
-CORBA::Buffer::free (Octet *b)
+CORBA::Buffer::free (Octet *b, ULong sz)
 {
+    Long c = BufferPool::size_class (sz);
+    if (c >= 0) {
+	BufferPool *p = BufferPool::get (FALSE);
+	if (p && p->free (b, c))
+	    return;
+    }
     ::free ((void *)b);
 }
 
@@ -141,8 +405,12 @@ CORBA::Buffer::reset (ULong sz)
         _wptr = 0;
         if (sz < MINSIZE)
             sz = MINSIZE;
-        if (_len < sz) {
-	    free (_buf);
+        if (_share && !unshare ()) {
+            // the loans keep the old memory
+            _buf = alloc (sz);
+            _len = sz;
+        } else if (_len < sz) {
+	    free (_buf, _len);
             _buf = alloc (sz);
             _len = sz;
         }
@@ -154,12 +422,19 @@ CORBA::Buffer::doresize (ULong needed)
 {
     assert (!_readonly);
     if (_wptr + needed > _len) {
+        // grow geometrically, so appending n bytes costs O(n)
         ULong nlen = (_len < RESIZE_THRESH)
             ? (2*_len)
-            : (_len + RESIZE_INCREMENT);
+            : (_len + _len/2);
         if (_wptr + needed > nlen)
             nlen = _wptr + needed;
-	_buf = realloc (_buf, _len, nlen);
+        if (_share && !unshare ()) {
+            Octet *b = alloc (nlen);
+            memcpy (b, _buf, _wptr);
+            _buf = b;
+        } else {
+            _buf = realloc (_buf, _len, nlen);
+        }
         _len = nlen;
     }
 }
@@ -438,6 +713,100 @@ CORBA::Buffer::put16 (const void *p)
     _wptr = (ULong)t;
 }
 
+/*
+ * memory of a buffer that SequenceLoans refer to. The buffer holds a
+ * reference as long as it uses the memory and every loan another one,
+ * the last reference frees it.
+ */
+struct CORBA::BufferShare {
+    CORBA::Long refs;
+    CORBA::Octet *buf;
+    CORBA::ULong len;
+};
+
+#if !defined(HAVE_GCC_ATOMICS) && !defined(HAVE_SOLARIS_ATOMICS)
+static MICOMT::Mutex loan_lock;
+#endif
+
+static inline void
+loan_ref (MICO_Long &refs)
+{
+#if defined(HAVE_GCC_ATOMICS)
+    __sync_fetch_and_add (&refs, 1);
+#elif defined(HAVE_SOLARIS_ATOMICS)
+    atomic_inc_32 ((uint32_t *)&refs);
+#else
+    MICOMT::AutoLock l (loan_lock);
+    ++refs;
+#endif
+}
+
+// TRUE if the last reference is gone
+static inline CORBA::Boolean
+loan_deref (MICO_Long &refs)
+{
+#if defined(HAVE_GCC_ATOMICS)
+    return __sync_sub_and_fetch (&refs, 1) == 0;
+#elif defined(HAVE_SOLARIS_ATOMICS)
+    return atomic_dec_32_nv ((uint32_t *)&refs) == 0;
+#else
+    MICOMT::AutoLock l (loan_lock);
+    return --refs == 0;
+#endif
+}
+
+CORBA::Boolean
+CORBA::Buffer::unshare (BufferShare *s)
+{
+    if (!loan_deref (s->refs))
+	return FALSE;
+    delete s;
+    return TRUE;
+}
+
+/*
+ * the buffer stops sharing its memory. TRUE if no loans were left and
+ * the memory still belongs to the buffer, otherwise the last loan
+ * frees it and the buffer must not touch it any more.
+ */
+CORBA::Boolean
+CORBA::Buffer::unshare ()
+{
+    BufferShare *s = _share;
+    _share = 0;
+    return unshare (s);
+}
+
+// before data that may be lent is overwritten
+void
+CORBA::Buffer::copy_shared ()
+{
+    if (!unshare ()) {
+	ULong len = _len;
+	Octet *b = alloc (len);
+	memcpy (b, _buf, _wptr);
+	_buf = b;
+	_len = len;
+    }
+}
+
+SequenceLoan *
+CORBA::Buffer::loan (ULong len)
+{
+    if (_readonly || len < LOAN_MIN || len < _wptr / 4 ||
+	_wptr - _rptr < len)
+	return 0;
+    if (!_share) {
+	_share = new BufferShare;
+	_share->refs = 1;
+	_share->buf = _buf;
+	_share->len = _len;
+    }
+    SequenceLoan *l = new SequenceLoan (_share, &_buf[_rptr], len);
+    _rptr += len;
+    return l;
+}
+
 void
 CORBA::Buffer::dump (const char * desc, ostream &o) const
 {
@@ -484,3 +853,36 @@ CORBA::Buffer::dump (const char * desc, ostream &o) const
     }
   }
 }
+
+
+/***************************** SequenceLoan *****************************/
+
+
+SequenceLoan::SequenceLoan (CORBA::BufferShare *s, const void *data,
+			    MICO_ULong len)
+    : _refs (1), _share (s), _data (data), _len (len)
+{
+    loan_ref (s->refs);
+}
+
+SequenceLoan::~SequenceLoan ()
+{
+    CORBA::Octet *b = _share->buf;
+    CORBA::ULong len = _share->len;
+    if (CORBA::Buffer::unshare (_share))
+	CORBA::Buffer::free (b, len);
+}
+
+SequenceLoan *
+SequenceLoan::_duplicate (SequenceLoan *l)
+{
+    loan_ref (l->_refs);
+    return l;
+}
+
+void
+SequenceLoan::_release (SequenceLoan *l)
+{
+    if (loan_deref (l->_refs))
+	delete l;
+}
@@ -41,6 +41,16 @@
 
 #endif // FAST_PCH
 
+/*
+ * SSE2 is always there on x86-64, AVX2 kernels are compiled with the
+ * target attribute and only used when the CPU has AVX2.
+ */
+#if defined(__GNUC__) && __GNUC__ >= 5 && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define MICO_SWAP_SIMD
+#include <immintrin.h>
+#endif
+
 
 using namespace std;
 
@@ -55,6 +65,10 @@ CORBA::DataEncoder::DataEncoder ()
     dofree_conv = FALSE;
     vstate = 0;
     dofree_vstate = FALSE;
+    flush_cb = 0;
+    flush_sz = 0;
+    flush_locked = 0;
+    native = FALSE;
 }
 
 CORBA::DataEncoder::DataEncoder (Buffer *b, Boolean dofree_b,
@@ -67,6 +81,10 @@ CORBA::DataEncoder::DataEncoder (Buffer *b, Boolean dofree_b,
     dofree_conv = dofree_c;
     vstate = vs;
     dofree_vstate = dofree_vs;
+    flush_cb = 0;
+    flush_sz = 0;
+    flush_locked = 0;
+    native = FALSE;
 }
 
 CORBA::DataEncoder::~DataEncoder ()
@@ -101,15 +119,30 @@ CORBA::DataEncoder::reset(Buffer* b, Boolean dofree_b,
 void
 CORBA::DataEncoder::put_buffer (const Buffer &b)
 {
-    buf->put (b.data(), b.length());
+    put_octets (b.data(), b.length());
 }
 
 void
 CORBA::DataEncoder::put_octets (const void *data, ULong len)
 {
+    if (flush_cb && len > flush_sz) {
+	const Octet *p = (const Octet *)data;
+	for (ULong n; len > 0; len -= n, p += n) {
+	    n = len < flush_sz ? len : flush_sz;
+	    buf->put (p, n);
+	    flush ();
+	}
+	return;
+    }
     buf->put (data, len);
 }
 
+CORBA::Boolean
+CORBA::DataEncoder::bulk_begin (ULong, ULong, ULong)
+{
+    return FALSE;
+}
+
 void
 CORBA::DataEncoder::put_string (const string &s)
 {
@@ -180,6 +213,7 @@ CORBA::DataEncoder::encaps_begin (EncapsState &state)
     state.align = buffer()->walign_base ();
     state.bo = byteorder();
     state.pos = buffer()->wpos();
+    ++flush_locked;
 
     put_ulong (0);
 
@@ -204,6 +238,7 @@ CORBA::DataEncoder::encaps_end (EncapsState &state)
     put_ulong (end-data_start);
 
     buffer()->wseek_beg (end);
+    --flush_locked;
 }
 
 void
@@ -211,6 +246,7 @@ CORBA::DataEncoder::delayed_seq_begin (DelayedSeqState &state)
 {
     state.pos = buffer()->wpos();
     put_ulong (0);
+    ++flush_locked;
 }
 
 void
@@ -220,6 +256,7 @@ CORBA::DataEncoder::delayed_seq_end (DelayedSeqState &state, ULong l)
     buffer()->wseek_beg (state.pos);
     put_ulong (l);
     buffer()->wseek_beg (pos);
+    --flush_locked;
 }
 
 void
@@ -362,6 +399,28 @@ CORBA::DataEncoder::value_ref (Long value_id)
     }
 }
 
+CORBA::DataEncoder::FlushCallback::~FlushCallback ()
+{
+}
+
+void
+CORBA::DataEncoder::flush_callback (FlushCallback *cb, ULong size)
+{
+    flush_cb = cb;
+    flush_sz = size;
+}
+
+void
+CORBA::DataEncoder::flush ()
+{
+    if (!flush_cb || flush_locked > 0 || buf->length() < flush_sz)
+	return;
+    // value ids and chunk tags are buffer positions
+    if (vstate && (vstate->nesting_level > 0 || vstate->visited.size() > 0))
+	return;
+    flush_cb->flush (this);
+}
+
 void
 CORBA::DataEncoder::buffer (Buffer *b, Boolean release)
 {
@@ -419,6 +478,7 @@ CORBA::DataDecoder::DataDecoder (Buffer *b, Boolean dofree_b,
     dofree_conv = dofree_c;
     vstate = vs;
     dofree_vstate = dofree_vs;
+    native = FALSE;
 }
 
 CORBA::DataDecoder::~DataDecoder ()
@@ -437,6 +497,24 @@ CORBA::DataDecoder::get_octets (void *data, ULong len)
     return buf->get (data, len);
 }
 
+CORBA::Boolean
+CORBA::DataDecoder::bulk_begin (ULong, ULong, ULong)
+{
+    return FALSE;
+}
+
+SequenceLoan *
+CORBA::DataDecoder::loan_octets (ULong)
+{
+    return 0;
+}
+
+SequenceLoan *
+CORBA::DataDecoder::loan_chars (ULong)
+{
+    return 0;
+}
+
 CORBA::Boolean
 CORBA::DataDecoder::get_string_stl (string &str)
 {
@@ -963,6 +1041,97 @@ static inline void swap8 (void *d, const void *s)
 }
 
 
+/*
+ * swap the byte order of n values of the given size (2, 4 or 8) from s
+ * to d. used for sequences and arrays in the other byte order.
+ */
+#ifdef MICO_SWAP_SIMD
+
+__attribute__ ((target ("avx2")))
+static CORBA::ULong
+swap_array_avx2 (CORBA::Octet *d, const CORBA::Octet *s, CORBA::ULong n,
+		 CORBA::ULong size)
+{
+    CORBA::Octet m[32];
+    for (CORBA::ULong i = 0; i < 32; ++i)
+	m[i] = (i & 15) ^ (size-1);
+    __m256i mask = _mm256_loadu_si256 ((const __m256i *)m);
+
+    CORBA::ULong bytes = n*size & ~31UL;
+    for (CORBA::ULong i = 0; i < bytes; i += 32) {
+	__m256i v = _mm256_loadu_si256 ((const __m256i *)(s+i));
+	_mm256_storeu_si256 ((__m256i *)(d+i), _mm256_shuffle_epi8 (v, mask));
+    }
+    return bytes / size;
+}
+
+static CORBA::ULong
+swap_array_sse2 (CORBA::Octet *d, const CORBA::Octet *s, CORBA::ULong n,
+		 CORBA::ULong size)
+{
+    // SSE2 has no byte shuffle: reorder the 16 bit words, then swap
+    // the bytes within them
+    CORBA::ULong bytes = n*size & ~15UL;
+    for (CORBA::ULong i = 0; i < bytes; i += 16) {
+	__m128i v = _mm_loadu_si128 ((const __m128i *)(s+i));
+	if (size == 4) {
+	    v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+	    v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+	} else if (size == 8) {
+	    v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+	    v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+	}
+	v = _mm_or_si128 (_mm_slli_epi16 (v, 8), _mm_srli_epi16 (v, 8));
+	_mm_storeu_si128 ((__m128i *)(d+i), v);
+    }
+    return bytes / size;
+}
+
+static CORBA::Boolean
+have_avx2 ()
+{
+    static int avx2 = -1;
+    if (avx2 < 0)
+	avx2 = __builtin_cpu_supports ("avx2") ? 1 : 0;
+    return avx2;
+}
+
+#endif // MICO_SWAP_SIMD
+
+static void
+swap_array (void *_d, const void *_s, CORBA::ULong n, CORBA::ULong size)
+{
+    CORBA::Octet *d = (CORBA::Octet *)_d;
+    const CORBA::Octet *s = (const CORBA::Octet *)_s;
+
+#ifdef MICO_SWAP_SIMD
+    CORBA::ULong done = have_avx2 ()
+	? swap_array_avx2 (d, s, n, size)
+	: swap_array_sse2 (d, s, n, size);
+    d += done*size;
+    s += done*size;
+    n -= done;
+#endif
+
+    switch (size) {
+    case 2:
+	for ( ; n > 0; --n, d += 2, s += 2)
+	    swap2 (d, s);
+	break;
+    case 4:
+	for ( ; n > 0; --n, d += 4, s += 4)
+	    swap4 (d, s);
+	break;
+    case 8:
+	for ( ; n > 0; --n, d += 8, s += 8)
+	    swap8 (d, s);
+	break;
+    default:
+	assert (0);
+    }
+}
+
+
 // OpenBSD defines macro swap16
 static inline void swap_16 (void *d, const void *s)
 {
@@ -984,6 +1153,20 @@ static inline void swap_16 (void *d, const void *s)
     ((CORBA::Octet *)d)[15] = ((CORBA::Octet *)s)[0];
 }
 
+/*
+ * NativeCDR copies the bytes of a value, so it needs the byte order
+ * and the floating point format of this machine.
+ */
+static inline CORBA::Boolean
+native_bo (CORBA::ByteOrder data_bo, CORBA::ByteOrder mach_bo)
+{
+#ifdef HAVE_IEEE_FP
+    return data_bo == mach_bo;
+#else
+    return FALSE;
+#endif
+}
+
 MICO::CDREncoder::CDREncoder ()
 {
 #ifdef HAVE_BYTEORDER_BE
@@ -992,6 +1175,7 @@ MICO::CDREncoder::CDREncoder ()
     mach_bo = CORBA::LittleEndian;
 #endif
     data_bo = mach_bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 MICO::CDREncoder::CDREncoder (CORBA::Buffer *b, CORBA::Boolean dofree_b,
@@ -1007,6 +1191,7 @@ MICO::CDREncoder::CDREncoder (CORBA::Buffer *b, CORBA::Boolean dofree_b,
     mach_bo = CORBA::LittleEndian;
 #endif
     data_bo = (_bo == CORBA::DefaultEndian) ? mach_bo : _bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 MICO::CDREncoder::~CDREncoder ()
@@ -1211,17 +1396,39 @@ MICO::CDREncoder::put_boolean (CORBA::Boolean b)
     buf->put1 (&b);
 }
 
+/*
+ * marshal a large array in pieces of at most the flush size and give
+ * the flush callback a chance to send the buffer after each of them.
+ */
+template<class T>
+static void
+put_chunked (MICO::CDREncoder *ec,
+	     void (MICO::CDREncoder::*put) (const T *, CORBA::ULong),
+	     const T *p, CORBA::ULong l)
+{
+    CORBA::ULong chunk = ec->flush_size() / sizeof (T);
+    if (chunk == 0)
+	chunk = 1;
+    for (CORBA::ULong n; l > 0; l -= n, p += n) {
+	n = l < chunk ? l : chunk;
+	(ec->*put) (p, n);
+	ec->flush ();
+    }
+}
+
 void
 MICO::CDREncoder::put_shorts (const CORBA::Short *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Short)) {
+	put_chunked (this, &MICO::CDREncoder::put_shorts, p, l);
+	return;
+    }
     buf->walign (2);
     if (mach_bo == data_bo) {
 	buf->put (p, 2*l);
     } else {
 	buf->resize (2*l);
-	CORBA::Short *d = (CORBA::Short *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap2 (d, p);
+	swap_array (buf->wdata(), p, l, 2);
 	buf->wseek_rel (2*l);
     }
 }
@@ -1229,14 +1436,16 @@ MICO::CDREncoder::put_shorts (const CORBA::Short *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_ushorts (const CORBA::UShort *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::UShort)) {
+	put_chunked (this, &MICO::CDREncoder::put_ushorts, p, l);
+	return;
+    }
     buf->walign (2);
     if (mach_bo == data_bo) {
 	buf->put (p, 2*l);
     } else {
 	buf->resize (2*l);
-	CORBA::UShort *d = (CORBA::UShort *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap2 (d, p);
+	swap_array (buf->wdata(), p, l, 2);
 	buf->wseek_rel (2*l);
     }
 }
@@ -1244,14 +1453,16 @@ MICO::CDREncoder::put_ushorts (const CORBA::UShort *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_longs (const CORBA::Long *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Long)) {
+	put_chunked (this, &MICO::CDREncoder::put_longs, p, l);
+	return;
+    }
     buf->walign (4);
     if (mach_bo == data_bo) {
 	buf->put (p, 4*l);
     } else {
 	buf->resize (4*l);
-	CORBA::Long *d = (CORBA::Long *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap4 (d, p);
+	swap_array (buf->wdata(), p, l, 4);
 	buf->wseek_rel (4*l);
     }
 }
@@ -1259,14 +1470,16 @@ MICO::CDREncoder::put_longs (const CORBA::Long *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_longlongs (const CORBA::LongLong *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::LongLong)) {
+	put_chunked (this, &MICO::CDREncoder::put_longlongs, p, l);
+	return;
+    }
     buf->walign (8);
     if (mach_bo == data_bo) {
 	buf->put (p, 8*l);
     } else {
 	buf->resize (8*l);
-	CORBA::LongLong *d = (CORBA::LongLong *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap8 (d, p);
+	swap_array (buf->wdata(), p, l, 8);
 	buf->wseek_rel (8*l);
     }
 }
@@ -1274,14 +1487,16 @@ MICO::CDREncoder::put_longlongs (const CORBA::LongLong *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_ulongs (const CORBA::ULong *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::ULong)) {
+	put_chunked (this, &MICO::CDREncoder::put_ulongs, p, l);
+	return;
+    }
     buf->walign (4);
     if (mach_bo == data_bo) {
 	buf->put (p, 4*l);
     } else {
 	buf->resize (4*l);
-	CORBA::ULong *d = (CORBA::ULong *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap4 (d, p);
+	swap_array (buf->wdata(), p, l, 4);
 	buf->wseek_rel (4*l);
     }
 }
@@ -1289,14 +1504,16 @@ MICO::CDREncoder::put_ulongs (const CORBA::ULong *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_ulonglongs (const CORBA::ULongLong *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::ULongLong)) {
+	put_chunked (this, &MICO::CDREncoder::put_ulonglongs, p, l);
+	return;
+    }
     buf->walign (8);
     if (mach_bo == data_bo) {
 	buf->put (p, 8*l);
     } else {
 	buf->resize (8*l);
-	CORBA::ULongLong *d = (CORBA::ULongLong *)buf->wdata();
-	for (CORBA::Long i = l; --i >= 0; ++d, ++p)
-	    swap8 (d, p);
+	swap_array (buf->wdata(), p, l, 8);
 	buf->wseek_rel (8*l);
     }
 }
@@ -1304,20 +1521,54 @@ MICO::CDREncoder::put_ulonglongs (const CORBA::ULongLong *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_floats (const CORBA::Float *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Float)) {
+	put_chunked (this, &MICO::CDREncoder::put_floats, p, l);
+	return;
+    }
+#ifdef HAVE_IEEE_FP
+    buf->walign (4);
+    if (mach_bo == data_bo) {
+	buf->put (p, 4*l);
+    } else {
+	buf->resize (4*l);
+	swap_array (buf->wdata(), p, l, 4);
+	buf->wseek_rel (4*l);
+    }
+#else
     for (CORBA::Long i = l; --i >= 0; ++p)
 	put_float (*p);
+#endif
 }
 
 void
 MICO::CDREncoder::put_doubles (const CORBA::Double *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Double)) {
+	put_chunked (this, &MICO::CDREncoder::put_doubles, p, l);
+	return;
+    }
+#ifdef HAVE_IEEE_FP
+    buf->walign (8);
+    if (mach_bo == data_bo) {
+	buf->put (p, 8*l);
+    } else {
+	buf->resize (8*l);
+	swap_array (buf->wdata(), p, l, 8);
+	buf->wseek_rel (8*l);
+    }
+#else
     for (CORBA::Long i = l; --i >= 0; ++p)
 	put_double (*p);
+#endif
 }
 
 void
 MICO::CDREncoder::put_longdoubles (const CORBA::LongDouble *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::LongDouble)) {
+	put_chunked (this, &MICO::CDREncoder::put_longdoubles, p, l);
+	return;
+    }
     for (CORBA::Long i = l; --i >= 0; ++p)
 	put_longdouble (*p);
 }
@@ -1325,6 +1576,10 @@ MICO::CDREncoder::put_longdoubles (const CORBA::LongDouble *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_chars (const CORBA::Char *p, CORBA::ULong l)
 {
+  if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Char)) {
+    put_chunked (this, &MICO::CDREncoder::put_chars, p, l);
+    return;
+  }
   if (!conv) {
     buf->put (p, l);
     return;
@@ -1335,12 +1590,20 @@ MICO::CDREncoder::put_chars (const CORBA::Char *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_chars_raw (const CORBA::Char *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Char)) {
+	put_chunked (this, &MICO::CDREncoder::put_chars_raw, p, l);
+	return;
+    }
     buf->put (p, l);
 }
 
 void
 MICO::CDREncoder::put_wchars (const CORBA::WChar *p, CORBA::ULong l)
 {
+  if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::WChar)) {
+    put_chunked (this, &MICO::CDREncoder::put_wchars, p, l);
+    return;
+  }
   if (!conv) {
     buf->put (p, l * sizeof (CORBA::WChar));
     return;
@@ -1351,9 +1614,23 @@ MICO::CDREncoder::put_wchars (const CORBA::WChar *p, CORBA::ULong l)
 void
 MICO::CDREncoder::put_booleans (const CORBA::Boolean *p, CORBA::ULong l)
 {
+    if (flush_cb && l > 1 && l > flush_sz / sizeof (CORBA::Boolean)) {
+	put_chunked (this, &MICO::CDREncoder::put_booleans, p, l);
+	return;
+    }
     buf->put (p, l);
 }
 
+CORBA::Boolean
+MICO::CDREncoder::bulk_begin (CORBA::ULong align, CORBA::ULong,
+			      CORBA::ULong)
+{
+    if (data_bo != mach_bo)
+	return FALSE;
+    buf->walign (align);
+    return TRUE;
+}
+
 void
 MICO::CDREncoder::put_string (const char *s)
 {
@@ -1468,6 +1745,7 @@ void
 MICO::CDREncoder::byteorder (CORBA::ByteOrder _bo)
 {
     data_bo = _bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 CORBA::ULong
@@ -1489,6 +1767,7 @@ MICO::CDRDecoder::CDRDecoder ()
     mach_bo = CORBA::LittleEndian;
 #endif
     data_bo = mach_bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 MICO::CDRDecoder::CDRDecoder (CORBA::Buffer *b, CORBA::Boolean dofree_b,
@@ -1504,6 +1783,7 @@ MICO::CDRDecoder::CDRDecoder (CORBA::Buffer *b, CORBA::Boolean dofree_b,
     mach_bo = CORBA::LittleEndian;
 #endif
     data_bo = (_bo == CORBA::DefaultEndian) ? mach_bo : _bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 MICO::CDRDecoder::~CDRDecoder ()
@@ -1761,9 +2041,7 @@ MICO::CDRDecoder::get_shorts (CORBA::Short *p, CORBA::ULong l)
     if (buf->length() < 2*l)
 	return FALSE;
 
-    CORBA::Short *s = (CORBA::Short *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap2 (p, s);
+    swap_array (p, buf->data(), l, 2);
     buf->rseek_rel (2*l);
 
     return TRUE;
@@ -1781,9 +2059,7 @@ MICO::CDRDecoder::get_ushorts (CORBA::UShort *p, CORBA::ULong l)
     if (buf->length() < 2*l)
 	return FALSE;
 
-    CORBA::UShort *s = (CORBA::UShort *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap2 (p, s);
+    swap_array (p, buf->data(), l, 2);
     buf->rseek_rel (2*l);
 
     return TRUE;
@@ -1801,9 +2077,7 @@ MICO::CDRDecoder::get_longs (CORBA::Long *p, CORBA::ULong l)
     if (buf->length() < 4*l)
 	return FALSE;
 
-    CORBA::Long *s = (CORBA::Long *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap4 (p, s);
+    swap_array (p, buf->data(), l, 4);
     buf->rseek_rel (4*l);
 
     return TRUE;
@@ -1821,9 +2095,7 @@ MICO::CDRDecoder::get_longlongs (CORBA::LongLong *p, CORBA::ULong l)
     if (buf->length() < 8*l)
 	return FALSE;
 
-    CORBA::LongLong *s = (CORBA::LongLong *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap8 (p, s);
+    swap_array (p, buf->data(), l, 8);
     buf->rseek_rel (8*l);
 
     return TRUE;
@@ -1841,9 +2113,7 @@ MICO::CDRDecoder::get_ulongs (CORBA::ULong *p, CORBA::ULong l)
     if (buf->length() < 4*l)
 	return FALSE;
 
-    CORBA::ULong *s = (CORBA::ULong *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap4 (p, s);
+    swap_array (p, buf->data(), l, 4);
     buf->rseek_rel (4*l);
 
     return TRUE;
@@ -1861,9 +2131,7 @@ MICO::CDRDecoder::get_ulonglongs (CORBA::ULongLong *p, CORBA::ULong l)
     if (buf->length() < 8*l)
 	return FALSE;
 
-    CORBA::ULongLong *s = (CORBA::ULongLong *)buf->data();
-    for (CORBA::Long i = l; --i >= 0; ++p, ++s)
-	swap8 (p, s);
+    swap_array (p, buf->data(), l, 8);
     buf->rseek_rel (8*l);
 
     return TRUE;
@@ -1880,13 +2148,20 @@ MICO::CDRDecoder::get_floats (CORBA::Float *p, CORBA::ULong l)
 
     if (data_bo == mach_bo)
 	    return buf->get (p, 4*l);
-#endif // HAVE_IEEE_FP
 
+    if (buf->length() < 4*l)
+	return FALSE;
+
+    swap_array (p, buf->data(), l, 4);
+    buf->rseek_rel (4*l);
+    return TRUE;
+#else
     for (CORBA::Long i = l; --i >= 0; ++p) {
 	if (!get_float (*p))
 	    return FALSE;
     }
     return TRUE;
+#endif // HAVE_IEEE_FP
 }
 
 CORBA::Boolean
@@ -1900,13 +2175,20 @@ MICO::CDRDecoder::get_doubles (CORBA::Double *p, CORBA::ULong l)
 
     if (data_bo == mach_bo)
 	    return buf->get (p, 8*l);
-#endif // HAVE_IEEE_FP
 
+    if (buf->length() < 8*l)
+	return FALSE;
+
+    swap_array (p, buf->data(), l, 8);
+    buf->rseek_rel (8*l);
+    return TRUE;
+#else
     for (CORBA::Long i = l; --i >= 0; ++p) {
 	if (!get_double (*p))
 	    return FALSE;
     }
     return TRUE;
+#endif // HAVE_IEEE_FP
 }
 
 CORBA::Boolean
@@ -1959,6 +2241,31 @@ MICO::CDRDecoder::get_booleans (CORBA::Boolean *p, CORBA::ULong l)
     return buf->get (p, l);
 }
 
+CORBA::Boolean
+MICO::CDRDecoder::bulk_begin (CORBA::ULong align, CORBA::ULong count,
+			      CORBA::ULong size)
+{
+    if (data_bo != mach_bo || !buf->ralign (align) || !check_chunk ())
+	return FALSE;
+    // count*size may overflow
+    return size == 0 || count <= buf->length() / size;
+}
+
+SequenceLoan *
+MICO::CDRDecoder::loan_octets (CORBA::ULong len)
+{
+    return buf->loan (len);
+}
+
+SequenceLoan *
+MICO::CDRDecoder::loan_chars (CORBA::ULong len)
+{
+    // converted chars are not the octets in the buffer
+    if (conv)
+	return 0;
+    return buf->loan (len);
+}
+
 CORBA::Boolean
 MICO::CDRDecoder::get_string (CORBA::String_out s)
 {
@@ -2119,6 +2426,7 @@ void
 MICO::CDRDecoder::byteorder (CORBA::ByteOrder _bo)
 {
     data_bo = _bo;
+    native = native_bo (data_bo, mach_bo);
 }
 
 CORBA::ULong
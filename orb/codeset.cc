@@ -49,6 +49,16 @@
 
 #endif // FAST_PCH
 
+/*
+ * SSE2 is always there on x86-64, UniCodesetConv converts runs of
+ * ASCII characters with it.
+ */
+#if defined(__GNUC__) && defined(__SSE2__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define MICO_CONV_SIMD
+#include <emmintrin.h>
+#endif
+
 
 using namespace std;
 
@@ -422,6 +432,315 @@ MICO::CodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
 #include "uni_strtypes.h"
 #include "uni_errors.h"
 
+/*
+ * Direct conversion between ISO 8859-1, UTF-8, UCS-2, UTF-16 and UCS-4.
+ *
+ * convert() goes through an intermediate UTF-8 string, so encode() and
+ * decode() copy the data three times. For these code sets the
+ * characters are converted in one pass from the source straight into
+ * the destination instead, 16 ASCII characters at a time with SSE2.
+ * Whatever convert() treats specially is still left to it: NUL, CR and
+ * LF, which it translates, the 0x1a and 0x1d line markers of UTF-16,
+ * malformed UTF-8, unpaired surrogates and characters the destination
+ * code set lacks.
+ */
+
+enum UniForm {
+    UniNone, UniLatin1, UniUTF8, UniUCS2, UniUTF16, UniUCS4
+};
+
+static UniForm
+uni_form (CORBA::Codeset *cs)
+{
+    switch (cs->id()) {
+    case C_ISO8859_1:
+	return UniLatin1;
+    case C_UTF8:
+	return UniUTF8;
+    case C_UCS2:
+	return UniUCS2;
+    case C_UTF16:
+	return UniUTF16;
+    case C_UCS4:
+	return UniUCS4;
+    default:
+	return UniNone;
+    }
+}
+
+// largest number of bytes written for one source unit
+static CORBA::ULong
+uni_max_bytes (UniForm sf, UniForm df)
+{
+    switch (df) {
+    case UniLatin1:
+	return 1;
+    case UniUTF8:
+	return sf == UniLatin1 ? 2 : sf == UniUTF8 ? 1 : sf == UniUCS4 ? 4 : 3;
+    case UniUCS2:
+	return 2;
+    case UniUTF16:
+	return sf == UniUCS4 ? 4 : 2;
+    default:
+	return 4;
+    }
+}
+
+template<class U>
+static inline CORBA::ULong
+uni_load (const CORBA::Octet *p)
+{
+    U u;
+    memcpy (&u, p, sizeof (U));
+    return u;
+}
+
+template<class U>
+static inline void
+uni_store (CORBA::Octet *p, CORBA::ULong c)
+{
+    U u = (U)c;
+    memcpy (p, &u, sizeof (U));
+}
+
+#ifdef MICO_CONV_SIMD
+
+/*
+ * convert 16 units from s to d if all of them are printable ASCII
+ * characters (0x20 to 0x7f). the signed compares fail for larger
+ * values as well.
+ */
+template<class SU, class DU>
+static inline CORBA::Boolean
+uni_ascii16 (const CORBA::Octet *s, CORBA::Octet *d)
+{
+    __m128i v;
+    if (sizeof (SU) == 1) {
+	v = _mm_loadu_si128 ((const __m128i *)s);
+	__m128i ok = _mm_cmpgt_epi8 (v, _mm_set1_epi8 (0x1f));
+	if (_mm_movemask_epi8 (ok) != 0xffff)
+	    return FALSE;
+    } else if (sizeof (SU) == 2) {
+	__m128i lo = _mm_set1_epi16 (0x1f), hi = _mm_set1_epi16 (0x80);
+	__m128i a = _mm_loadu_si128 ((const __m128i *)s);
+	__m128i b = _mm_loadu_si128 ((const __m128i *)(s+16));
+	__m128i ok = _mm_and_si128 (
+	    _mm_and_si128 (_mm_cmpgt_epi16 (a, lo), _mm_cmplt_epi16 (a, hi)),
+	    _mm_and_si128 (_mm_cmpgt_epi16 (b, lo), _mm_cmplt_epi16 (b, hi)));
+	if (_mm_movemask_epi8 (ok) != 0xffff)
+	    return FALSE;
+	v = _mm_packus_epi16 (a, b);
+    } else {
+	__m128i lo = _mm_set1_epi32 (0x1f), hi = _mm_set1_epi32 (0x80);
+	__m128i a = _mm_loadu_si128 ((const __m128i *)s);
+	__m128i b = _mm_loadu_si128 ((const __m128i *)(s+16));
+	__m128i c = _mm_loadu_si128 ((const __m128i *)(s+32));
+	__m128i e = _mm_loadu_si128 ((const __m128i *)(s+48));
+	__m128i ok = _mm_and_si128 (
+	    _mm_and_si128 (
+		_mm_and_si128 (_mm_cmpgt_epi32 (a, lo),
+			       _mm_cmplt_epi32 (a, hi)),
+		_mm_and_si128 (_mm_cmpgt_epi32 (b, lo),
+			       _mm_cmplt_epi32 (b, hi))),
+	    _mm_and_si128 (
+		_mm_and_si128 (_mm_cmpgt_epi32 (c, lo),
+			       _mm_cmplt_epi32 (c, hi)),
+		_mm_and_si128 (_mm_cmpgt_epi32 (e, lo),
+			       _mm_cmplt_epi32 (e, hi))));
+	if (_mm_movemask_epi8 (ok) != 0xffff)
+	    return FALSE;
+	v = _mm_packus_epi16 (_mm_packs_epi32 (a, b), _mm_packs_epi32 (c, e));
+    }
+
+    if (sizeof (DU) == 1) {
+	_mm_storeu_si128 ((__m128i *)d, v);
+	return TRUE;
+    }
+    __m128i z = _mm_setzero_si128 ();
+    __m128i lo = _mm_unpacklo_epi8 (v, z);
+    __m128i hi = _mm_unpackhi_epi8 (v, z);
+    if (sizeof (DU) == 2) {
+	_mm_storeu_si128 ((__m128i *)d, lo);
+	_mm_storeu_si128 ((__m128i *)(d+16), hi);
+    } else {
+	_mm_storeu_si128 ((__m128i *)d, _mm_unpacklo_epi16 (lo, z));
+	_mm_storeu_si128 ((__m128i *)(d+16), _mm_unpackhi_epi16 (lo, z));
+	_mm_storeu_si128 ((__m128i *)(d+32), _mm_unpacklo_epi16 (hi, z));
+	_mm_storeu_si128 ((__m128i *)(d+48), _mm_unpackhi_epi16 (hi, z));
+    }
+    return TRUE;
+}
+
+#endif // MICO_CONV_SIMD
+
+/*
+ * convert n units of type SU at s in code set sf to units of type DU
+ * at d in code set df. returns the number of units written or -1 if
+ * convert() has to do it.
+ */
+template<class SU, class DU>
+static CORBA::Long
+uni_transcode (const CORBA::Octet *s, CORBA::ULong n, UniForm sf,
+	       CORBA::Octet *d, UniForm df)
+{
+    CORBA::Octet *d0 = d;
+    CORBA::ULong i = 0;
+
+    while (i < n) {
+	CORBA::ULong stop = n;
+#ifdef MICO_CONV_SIMD
+	if (n - i >= 16) {
+	    if (uni_ascii16<SU, DU> (s + i*sizeof (SU), d)) {
+		i += 16;
+		d += 16*sizeof (DU);
+		continue;
+	    }
+	    // no ASCII run, convert the next characters one by one
+	    stop = i + 16;
+	}
+#endif
+	while (i < stop) {
+	    CORBA::ULong c = uni_load<SU> (s + i*sizeof (SU));
+	    ++i;
+
+	    switch (sf) {
+	    case UniUTF8:
+		if (c >= 0x80) {
+		    CORBA::ULong more, min;
+		    if (c >= 0xc2 && c < 0xe0) {
+			more = 1;
+			min = 0x80;
+			c &= 0x1f;
+		    } else if (c >= 0xe0 && c < 0xf0) {
+			more = 2;
+			min = 0x800;
+			c &= 0x0f;
+		    } else if (c >= 0xf0 && c < 0xf5) {
+			more = 3;
+			min = 0x10000;
+			c &= 0x07;
+		    } else {
+			return -1;
+		    }
+		    if (n - i < more)
+			return -1;
+		    for ( ; more > 0; --more, ++i) {
+			CORBA::ULong b = s[i];
+			if ((b & 0xc0) != 0x80)
+			    return -1;
+			c = (c << 6) | (b & 0x3f);
+		    }
+		    if (c < min)
+			return -1;
+		}
+		break;
+	    case UniUCS2:
+	    case UniUTF16:
+		// wide characters must fit into the code set
+		if (c > 0xffff)
+		    return -1;
+		if (sf == UniUTF16 && c >= 0xd800 && c < 0xdc00 && i < n) {
+		    CORBA::ULong c2 = uni_load<SU> (s + i*sizeof (SU));
+		    if (c2 >= 0xdc00 && c2 < 0xe000) {
+			c = 0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00);
+			++i;
+		    }
+		}
+		break;
+	    default:
+		break;
+	    }
+	    if (c > 0x10ffff || (c >= 0xd800 && c < 0xe000) ||
+		c == 0 || c == '\n' || c == '\r' || c == 0x1a || c == 0x1d)
+		return -1;
+
+	    switch (df) {
+	    case UniLatin1:
+		if (c > 0xff)
+		    return -1;
+		uni_store<DU> (d, c);
+		d += sizeof (DU);
+		break;
+	    case UniUTF8:
+		if (c < 0x80) {
+		    uni_store<DU> (d, c);
+		    d += sizeof (DU);
+		} else {
+		    CORBA::Octet b[4];
+		    CORBA::ULong len;
+		    if (c < 0x800) {
+			b[0] = 0xc0 | (c >> 6);
+			len = 2;
+		    } else if (c < 0x10000) {
+			b[0] = 0xe0 | (c >> 12);
+			len = 3;
+		    } else {
+			b[0] = 0xf0 | (c >> 18);
+			len = 4;
+		    }
+		    for (CORBA::ULong k = 1; k < len; ++k)
+			b[k] = 0x80 | ((c >> 6*(len-1-k)) & 0x3f);
+		    for (CORBA::ULong k = 0; k < len; ++k) {
+			uni_store<DU> (d, b[k]);
+			d += sizeof (DU);
+		    }
+		}
+		break;
+	    case UniUCS2:
+		if (c > 0xffff)
+		    return -1;
+		uni_store<DU> (d, c);
+		d += sizeof (DU);
+		break;
+	    case UniUTF16:
+		if (c > 0xffff) {
+		    c -= 0x10000;
+		    uni_store<DU> (d, 0xd800 + (c >> 10));
+		    d += sizeof (DU);
+		    c = 0xdc00 + (c & 0x3ff);
+		}
+		uni_store<DU> (d, c);
+		d += sizeof (DU);
+		break;
+	    default:
+		uni_store<DU> (d, c);
+		d += sizeof (DU);
+		break;
+	    }
+	}
+    }
+    return (d - d0) / sizeof (DU);
+}
+
+template<class SU>
+static CORBA::Long
+uni_convert (const CORBA::Octet *s, CORBA::ULong n, UniForm sf,
+	     CORBA::Octet *d, CORBA::ULong dsize, UniForm df)
+{
+    switch (dsize) {
+    case 1:
+	return uni_transcode<SU, CORBA::Octet> (s, n, sf, d, df);
+    case 2:
+	return uni_transcode<SU, CORBA::UShort> (s, n, sf, d, df);
+    default:
+	return uni_transcode<SU, CORBA::ULong> (s, n, sf, d, df);
+    }
+}
+
+static CORBA::Long
+uni_convert (const CORBA::Octet *s, CORBA::ULong ssize, CORBA::ULong n,
+	     UniForm sf, CORBA::Octet *d, CORBA::ULong dsize, UniForm df)
+{
+    switch (ssize) {
+    case 1:
+	return uni_convert<CORBA::Octet> (s, n, sf, d, dsize, df);
+    case 2:
+	return uni_convert<CORBA::UShort> (s, n, sf, d, dsize, df);
+    default:
+	return uni_convert<CORBA::ULong> (s, n, sf, d, dsize, df);
+    }
+}
+
 MICO::UniCodesetConv::UniCodesetConv ()
 {
     assert (0);
@@ -539,11 +858,7 @@ MICO::UniCodesetConv::convert (const char *f, CORBA::ULong len, char *t)
     }
 
     // UTF8 has max 6 code points per char
-#ifdef __GNUG__
-    char tmp[len*6+1];
-#else
     CORBA::String_var tmp = CORBA::string_alloc (len*6);
-#endif
 
     CORBA::ULong chars, utf_read, written;
     CORBA::Long ret = uni_toUTF8 (tmp, f,
@@ -572,23 +887,78 @@ MICO::UniCodesetConv::convert (const char *f, CORBA::ULong len, char *t)
     return written;
 }
 
+CORBA::Long
+MICO::UniCodesetConv::put_direct (const CORBA::Octet *f, CORBA::ULong fsize,
+				  CORBA::ULong len, CORBA::Buffer &t,
+				  CORBA::Boolean terminate)
+{
+    UniForm sf = uni_form (_from);
+    UniForm df = uni_form (_to);
+    if (sf == UniNone || df == UniNone || len > 0x10000000)
+	return -1;
+    // Chars hold byte oriented, WChars wide code sets
+    if ((fsize == 1) != (_from->codepoint_size() == 1))
+	return -1;
+
+    CORBA::ULong dsize = _to->codepoint_size();
+    t.resize (len * uni_max_bytes (sf, df) + dsize);
+    CORBA::Long written = uni_convert (f, fsize, len, sf,
+				       t.wdata(), dsize, df);
+    if (written < 0)
+	return -1;
+    if (terminate) {
+	memset (t.wdata() + written * dsize, 0, dsize);
+	++written;
+    }
+    t.wseek_rel (written * dsize);
+    return written;
+}
+
+CORBA::Long
+MICO::UniCodesetConv::get_direct (CORBA::Buffer &f, CORBA::ULong len,
+				  CORBA::Octet *t, CORBA::ULong tsize,
+				  CORBA::Boolean terminate)
+{
+    UniForm sf = uni_form (_from);
+    UniForm df = uni_form (_to);
+    if (sf == UniNone || df == UniNone)
+	return -1;
+    if ((tsize == 1) != (_to->codepoint_size() == 1))
+	return -1;
+
+    CORBA::ULong ssize = _from->codepoint_size();
+    if (len > f.length() / ssize)
+	return -1;
+    CORBA::Long written = uni_convert (f.data(), ssize, len, sf,
+				       t, tsize, df);
+    if (written < 0)
+	return -1;
+    if (terminate) {
+	memset (t + written * tsize, 0, tsize);
+	++written;
+    }
+    f.rseek_rel (len * ssize);
+    return written;
+}
+
 CORBA::Long
 MICO::UniCodesetConv::encode (const CORBA::Char *f, CORBA::ULong len,
 			      CORBA::Buffer &t, CORBA::Boolean terminate)
 {
-    char *from = NULL, *to = NULL, *cp = NULL;
+    CORBA::Long written = put_direct ((const CORBA::Octet *)f, 1, len,
+				      t, terminate);
+    if (written >= 0)
+	return written;
+
+    char *from = NULL, *cp = NULL;
 
     CORBA::ULong flen = _from->codepoint_size();
     assert (flen == 1 || flen == 2 || flen == 4);
     flen *= len;
 
-#ifdef __GNUG__
-    char _f[flen+1];
-#else
     CORBA::String_var _f;
     if (_from->codepoint_size() != 1)
 	_f = CORBA::string_alloc (flen);
-#endif
 
     switch (_from->codepoint_size()) {
     case 1:
@@ -618,22 +988,16 @@ MICO::UniCodesetConv::encode (const CORBA::Char *f, CORBA::ULong len,
 	tlen = 4;
     tlen *= len * _to->max_codepoints();
 
-#ifdef __GNUG__
-    char _t[tlen+4];
-#else
-    CORBA::String_var _t;
-    _t = CORBA::string_alloc (tlen);
-#endif
+    // with room for a wide terminator
+    CORBA::String_var _t = CORBA::string_alloc (tlen+4);
 
-    to = (char*) _t;
-
-    CORBA::Long written = convert (from, flen, to);
+    written = convert (from, flen, _t);
     if (written < 0)
 	return written;
     if (!terminate)
 	--written;
 
-    t.put (to, written * _to->codepoint_size());
+    t.put ((char *) _t, written * _to->codepoint_size());
 
     return written;
 }
@@ -642,20 +1006,21 @@ CORBA::Long
 MICO::UniCodesetConv::encode (const CORBA::WChar *f, CORBA::ULong len,
 			      CORBA::Buffer &t, CORBA::Boolean terminate)
 {
+    assert (sizeof (CORBA::WChar) == 4);
+    CORBA::Long written = put_direct ((const CORBA::Octet *)f, 4, len,
+				      t, terminate);
+    if (written >= 0)
+	return written;
+
     char *cp = NULL, *from = NULL;
 
     CORBA::ULong flen = _from->codepoint_size();
     assert (flen == 1 || flen == 2 || flen == 4);
-    assert (sizeof (CORBA::WChar) == 4);
     flen *= len;
 
-#ifdef __GNUG__
-    char _f[flen+1];
-#else
     CORBA::String_var _f;
     if (_from->codepoint_size() < 3)
 	_f = CORBA::string_alloc (flen);
-#endif
 
     switch (_from->codepoint_size()) {
     case 1:
@@ -685,13 +1050,9 @@ MICO::UniCodesetConv::encode (const CORBA::WChar *f, CORBA::ULong len,
 	tlen = 4;
     tlen *= len * _to->max_codepoints();
 
-#ifdef __GNUG__
-    char _t[tlen+4];
-#else
-    CORBA::String_var _t = CORBA::string_alloc (tlen);
-#endif
+    CORBA::String_var _t = CORBA::string_alloc (tlen+4);
 
-    CORBA::Long written = convert (from, len, _t);
+    written = convert (from, len, _t);
     if (written < 0)
 	return written;
     if (!terminate)
@@ -706,6 +1067,11 @@ CORBA::Long
 MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
 			      CORBA::Char *t, CORBA::Boolean terminate)
 {
+    CORBA::Long written = get_direct (f, len, (CORBA::Octet *)t, 1,
+				      terminate);
+    if (written >= 0)
+	return written;
+
     char *cp, *to;
 
     CORBA::ULong flen = _from->codepoint_size();
@@ -717,13 +1083,9 @@ MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
       return -1;
     }
 
-#ifdef __GNUG__
-    char _f[flen+1];
-#else
     CORBA::String_var _f = CORBA::string_alloc (flen);
-#endif
 
-    if (!f.get (_f, len * _from->codepoint_size())) {
+    if (!f.get ((char *) _f, len * _from->codepoint_size())) {
       return -1;
     }
     _f[len] = 0;
@@ -733,13 +1095,9 @@ MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
 	tlen = 4;
     tlen *= len * _to->max_codepoints();
 
-#ifdef __GNUG__
-    char _t[tlen+1];
-#else
     CORBA::String_var _t;
     if (_to->codepoint_size() != 1)
-	_t = CORBA::string_alloc (tlen);
-#endif
+	_t = CORBA::string_alloc (tlen+4);
 
     if (_to->codepoint_size() == 1) {
       to = t;
@@ -748,7 +1106,7 @@ MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
       to = (char*) _t;
     }
 
-    CORBA::Long written = convert (_f, flen, to);
+    written = convert (_f, flen, to);
 
     if (written < 0)
 	return written;
@@ -784,6 +1142,11 @@ CORBA::Long
 MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
 			      CORBA::WChar *t, CORBA::Boolean terminate)
 {
+    CORBA::Long written = get_direct (f, len, (CORBA::Octet *)t, 4,
+				      terminate);
+    if (written >= 0)
+	return written;
+
     char *cp, *to;
 
     CORBA::ULong flen = _from->codepoint_size();
@@ -795,13 +1158,9 @@ MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
       return -1;
     }
 
-#ifdef __GNUG__
-    char _f[flen+1];
-#else
     CORBA::String_var _f = CORBA::string_alloc (flen);
-#endif
 
-    if (!f.get (_f, len * _from->codepoint_size())) {
+    if (!f.get ((char *) _f, len * _from->codepoint_size())) {
       return -1;
     }
     _f[len * _from->codepoint_size()] = 0;
@@ -811,20 +1170,16 @@ MICO::UniCodesetConv::decode (CORBA::Buffer &f, CORBA::ULong len,
 	tlen = 4;
     tlen *= len * _to->max_codepoints();
 
-#ifdef __GNUG__
-    char _t[tlen+1];
-#else
     CORBA::String_var _t;
     if (_to->codepoint_size() < 3)
-	_t = CORBA::string_alloc (tlen);
-#endif
+	_t = CORBA::string_alloc (tlen+4);
 
     if (_to->codepoint_size() >= 3)
 	to = (char *)t;
     else
 	to = (char*) _t;
 
-    CORBA::Long written = convert (_f, len, to);
+    written = convert (_f, len, to);
 
     if (written < 0)
 	return written;
@@ -915,6 +1270,18 @@ MICO::GIOP_1_0_CodeSetCoder::isok ()
   return _isok;
 }
 
+CORBA::Codeset::CodesetId
+MICO::GIOP_1_0_CodeSetCoder::tcs_c ()
+{
+  return 0x00010001uL;
+}
+
+CORBA::Codeset::CodesetId
+MICO::GIOP_1_0_CodeSetCoder::tcs_w ()
+{
+  return 0;
+}
+
 CORBA::Boolean
 MICO::GIOP_1_0_CodeSetCoder::get_char (CORBA::DataDecoder & decoder,
 				       CORBA::Char & data)
@@ -1191,6 +1558,18 @@ MICO::GIOP_1_1_CodeSetCoder::isok ()
   return _isok;
 }
 
+CORBA::Codeset::CodesetId
+MICO::GIOP_1_1_CodeSetCoder::tcs_c ()
+{
+  return _tcsc;
+}
+
+CORBA::Codeset::CodesetId
+MICO::GIOP_1_1_CodeSetCoder::tcs_w ()
+{
+  return 0;
+}
+
 CORBA::Boolean
 MICO::GIOP_1_1_CodeSetCoder::get_char (CORBA::DataDecoder & decoder,
 				       CORBA::Char & data)
@@ -1697,6 +2076,12 @@ MICO::GIOP_1_2_CodeSetCoder::isok ()
   return _w_isok && GIOP_1_1_CodeSetCoder::isok ();
 }
 
+CORBA::Codeset::CodesetId
+MICO::GIOP_1_2_CodeSetCoder::tcs_w ()
+{
+  return _tcsw;
+}
+
 CORBA::Boolean
 MICO::GIOP_1_2_CodeSetCoder::get_wchar (CORBA::DataDecoder & decoder,
 					CORBA::WChar & data)
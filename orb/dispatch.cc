@@ -95,6 +95,325 @@ CORBA::Timeout::callback (Dispatcher *d, Event ev)
 }
 
 
+/**************************** TimerWheel *******************************/
+
+
+MICO::TimerWheel::TimerWheel ()
+    : _free (0), _size (0), _time (0), _tick (1), _last (0), _init (TRUE)
+{
+    for (CORBA::ULong i = 0; i < SLOTS; ++i)
+        _slots[i].next = _slots[i].prev = &_slots[i];
+    _due.next = _due.prev = &_due;
+    for (CORBA::Long l = 0; l <= LEVELS; ++l)
+        _counts[l] = 0;
+}
+
+MICO::TimerWheel::~TimerWheel ()
+{
+    std::vector<TimerEvent> tv;
+    drain (_last, tv);
+    while (_free) {
+        Node *n = _free;
+        _free = n->next;
+        delete n;
+    }
+}
+
+MICO::TimerWheel::Node *
+MICO::TimerWheel::slot (CORBA::Long level, CORBA::ULong idx)
+{
+    if (level == 0)
+        return &_slots[idx & L0_MASK];
+    return &_slots[L0_SIZE + (level-1) * LN_SIZE + (idx & LN_MASK)];
+}
+
+MICO::TimerWheel::Node *
+MICO::TimerWheel::alloc ()
+{
+    if (!_free)
+        return new Node;
+    Node *n = _free;
+    _free = n->next;
+    return n;
+}
+
+void
+MICO::TimerWheel::dealloc (Node *n)
+{
+    n->next = _free;
+    _free = n;
+}
+
+void
+MICO::TimerWheel::link (Node *head, Node *n, CORBA::Long level)
+{
+    n->prev = head->prev;
+    n->next = head;
+    head->prev->next = n;
+    head->prev = n;
+    n->level = level;
+    ++_counts[level];
+}
+
+void
+MICO::TimerWheel::unlink (Node *n)
+{
+    n->prev->next = n->next;
+    n->next->prev = n->prev;
+    --_counts[n->level];
+}
+
+void
+MICO::TimerWheel::unlink_cb (Node *n)
+{
+    if (n->cb_next)
+        n->cb_next->cb_prev = n->cb_prev;
+    if (n->cb_prev) {
+        n->cb_prev->cb_next = n->cb_next;
+    } else if (n->cb_next) {
+        _cbs[n->cb] = n->cb_next;
+    } else {
+        _cbs.erase (n->cb);
+    }
+}
+
+void
+MICO::TimerWheel::place (Node *n)
+{
+    CORBA::ULong delta = n->expires - _tick;
+
+    if ((CORBA::Long)delta < 0) {
+        // already late, expire with the next tick
+        link (slot (0, _tick), n, 0);
+    } else if (delta < (1UL << L0_BITS)) {
+        link (slot (0, n->expires), n, 0);
+    } else {
+        CORBA::Long level = 1;
+        CORBA::ULong shift = L0_BITS;
+        while (level < LEVELS-1 && delta >= (1UL << (shift + LN_BITS))) {
+            ++level;
+            shift += LN_BITS;
+        }
+        link (slot (level, n->expires >> shift), n, level);
+    }
+}
+
+/*
+ * move the timers of the current slot of the given level down to
+ * the levels below. Returns the slot index, a return value of zero
+ * means the level above has to be cascaded as well.
+ */
+CORBA::ULong
+MICO::TimerWheel::cascade (CORBA::Long level)
+{
+    CORBA::ULong idx = (_tick >> (L0_BITS + (level-1) * LN_BITS)) & LN_MASK;
+    Node *head = slot (level, idx);
+
+    while (head->next != head) {
+        Node *n = head->next;
+        unlink (n);
+        place (n);
+    }
+    return idx;
+}
+
+void
+MICO::TimerWheel::run ()
+{
+    while ((CORBA::Long)(_time - _tick) >= 0) {
+        if (_size == _counts[DUE]) {
+            // nothing left in the wheel
+            _tick = _time + 1;
+            break;
+        }
+        CORBA::ULong idx = _tick & L0_MASK;
+        if (idx == 0) {
+            for (CORBA::Long l = 1; l < LEVELS && cascade (l) == 0; ++l)
+                ;
+        }
+        if (_counts[0] == 0) {
+            // level 0 is empty up to the next cascade
+            CORBA::ULong next = (_tick | L0_MASK) + 1;
+            if ((CORBA::Long)(next - _time) > 0) {
+                _tick = _time + 1;
+                break;
+            }
+            _tick = next;
+            continue;
+        }
+        Node *head = slot (0, idx);
+        while (head->next != head) {
+            Node *n = head->next;
+            unlink (n);
+            link (&_due, n, DUE);
+        }
+        ++_tick;
+    }
+}
+
+void
+MICO::TimerWheel::update (CORBA::ULong now)
+{
+    if (_init) {
+        _init = FALSE;
+        _last = now;
+        return;
+    }
+    CORBA::Long elapsed = (CORBA::Long)(now - _last);
+    _last = now;
+    if (elapsed <= 0)
+        return;
+    _time += elapsed;
+    run ();
+}
+
+void
+MICO::TimerWheel::add (CORBA::DispatcherCallback *cb, Event ev,
+                       CORBA::ULong tmout, CORBA::ULong now)
+{
+    assert ((CORBA::Long)tmout >= 0);
+
+    update (now);
+
+    Node *n = alloc ();
+    n->expires = _time + tmout;
+    n->event = ev;
+    n->cb = cb;
+
+    CBMap::iterator i = _cbs.find (cb);
+    n->cb_prev = 0;
+    if (i == _cbs.end()) {
+        n->cb_next = 0;
+        _cbs[cb] = n;
+    } else {
+        n->cb_next = (*i).second;
+        n->cb_next->cb_prev = n;
+        (*i).second = n;
+    }
+
+    if (tmout == 0)
+        link (&_due, n, DUE);
+    else
+        place (n);
+    ++_size;
+}
+
+void
+MICO::TimerWheel::remove (CORBA::DispatcherCallback *cb)
+{
+    CBMap::iterator i = _cbs.find (cb);
+    if (i == _cbs.end())
+        return;
+
+    Node *n = (*i).second;
+    _cbs.erase (i);
+    while (n) {
+        Node *next = n->cb_next;
+        unlink (n);
+        dealloc (n);
+        --_size;
+        n = next;
+    }
+}
+
+CORBA::Boolean
+MICO::TimerWheel::expired (CORBA::ULong now, TimerEvent &te)
+{
+    if (_size == 0)
+        return FALSE;
+
+    update (now);
+    if (_due.next == &_due)
+        return FALSE;
+
+    Node *n = _due.next;
+    unlink (n);
+    unlink_cb (n);
+    te.event = n->event;
+    te.cb = n->cb;
+    te.tmout = 0;
+    dealloc (n);
+    --_size;
+    return TRUE;
+}
+
+CORBA::Long
+MICO::TimerWheel::next_timeout (CORBA::ULong now)
+{
+    if (_size == 0)
+        return -1;
+
+    update (now);
+    if (_counts[DUE] > 0)
+        return 0;
+
+    // exact expiry of the first timer in level 0
+    CORBA::ULong next = 0;
+    CORBA::Boolean found = FALSE;
+    if (_counts[0] > 0) {
+        for (CORBA::ULong k = 0; k < L0_SIZE; ++k) {
+            Node *head = slot (0, _tick + k);
+            if (head->next != head) {
+                next = _tick + k;
+                found = TRUE;
+                break;
+            }
+        }
+    }
+    // timers in the upper levels cannot expire before their slot is
+    // cascaded, which gives a lower bound for their expiry
+    for (CORBA::Long l = 1; l < LEVELS; ++l) {
+        if (_counts[l] == 0)
+            continue;
+        CORBA::ULong shift = L0_BITS + (l-1) * LN_BITS;
+        CORBA::ULong base = _tick >> shift;
+        CORBA::ULong k = (_tick & ((1UL << shift) - 1)) ? 1 : 0;
+        for (; k <= LN_SIZE; ++k) {
+            Node *head = slot (l, base + k);
+            if (head->next != head) {
+                CORBA::ULong t = (base + k) << shift;
+                if (!found || (CORBA::Long)(t - next) < 0) {
+                    next = t;
+                    found = TRUE;
+                }
+                break;
+            }
+        }
+    }
+    assert (found);
+
+    CORBA::Long tmout = (CORBA::Long)(next - _time);
+    return tmout > 0 ? tmout : 0;
+}
+
+void
+MICO::TimerWheel::drain (CORBA::ULong now, std::vector<TimerEvent> &tv)
+{
+    if (_size == 0)
+        return;
+
+    update (now);
+    for (CORBA::ULong i = 0; i <= SLOTS; ++i) {
+        Node *head = (i < SLOTS) ? &_slots[i] : &_due;
+        while (head->next != head) {
+            Node *n = head->next;
+            unlink (n);
+
+            TimerEvent te;
+            te.event = n->event;
+            te.cb = n->cb;
+            CORBA::Long tmout = (CORBA::Long)(n->expires - _time);
+            te.tmout = tmout > 0 ? tmout : 0;
+            tv.push_back (te);
+
+            dealloc (n);
+        }
+    }
+    _cbs.clear ();
+    _size = 0;
+}
+
+
 /************************** SelectDispatcher *****************************/
 
 class SignalBlocker {
@@ -129,7 +448,7 @@ public:
 CORBA::Boolean MICO::SelectDispatcher::_isblocking = FALSE;
 
 MICO::SelectDispatcher::SelectDispatcher ()
-    : last_update (0), init (TRUE), locked (0), modified (FALSE)
+    : locked (0), modified (FALSE)
 {
     FD_ZERO (&curr_wset);
     FD_ZERO (&curr_rset);
@@ -146,9 +465,10 @@ MICO::SelectDispatcher::~SelectDispatcher ()
         }
     }
 
-    list<TimerEvent>::iterator j;
-    for (j = tevents.begin(); j != tevents.end(); ++j)
-	(*j).cb->callback (this, Remove);
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j)
+	tv[j].cb->callback (this, Remove);
 }
 
 void 
@@ -173,14 +493,13 @@ MICO::SelectDispatcher::gettime () const
 void
 MICO::SelectDispatcher::sleeptime (OSMisc::TimeVal &tm)
 {
-    if (tevents.size() == 0) {
+    CORBA::Long t = tevents.next_timeout (gettime());
+    if (t < 0) {
 	// wdh: changed sleeptime to 1 second
  	tm.tv_sec =  1; //10; 
 	tm.tv_usec = 0;
 	return;
     }
-    update_tevents();
-    CORBA::Long t = (tevents.front().delta > 0 ? tevents.front().delta : 0);
 
     tm.tv_sec = t / 1000L;
     tm.tv_usec = (t % 1000L) * 1000L;
@@ -218,39 +537,16 @@ MICO::SelectDispatcher::update_fevents ()
     }
 }
 
-void
-MICO::SelectDispatcher::update_tevents ()
-{
-    CORBA::Long curr = gettime();
-    if (init || tevents.size() == 0 || curr - last_update < 0) {
-	last_update = curr;
-	init = FALSE;
-    } else {
-	tevents.front().delta -= (curr - last_update);
-	last_update = curr;
-    }
-}
-
 void
 MICO::SelectDispatcher::handle_tevents ()
 {
     SignalBlocker __sb;
 
-    if (tevents.size() == 0)
-	return;
-
-    update_tevents ();
-    while (tevents.size() > 0 && tevents.front().delta <= 0) {
-	TimerEvent t = tevents.front();
-	tevents.pop_front();
-	if (tevents.size() > 0)
-	    tevents.front().delta += t.delta;
-
+    TimerWheel::TimerEvent t;
+    while (tevents.expired (gettime(), t)) {
 	__sb.unblock();
 	t.cb->callback (this, t.event);
 	__sb.block();
-
-	update_tevents ();
     }
 }
 
@@ -362,19 +658,7 @@ MICO::SelectDispatcher::tm_event (CORBA::DispatcherCallback *cb,
     SignalBlocker __sb;
 
     assert ((CORBA::Long)tmout >= 0);
-    TimerEvent t (Timer, tmout, cb);
-
-    update_tevents ();
-    list<TimerEvent>::iterator i;
-    for (i = tevents.begin(); i != tevents.end(); ++i) {
-	if ((*i).delta <= t.delta) {
-	    t.delta -= (*i).delta;
-	} else {
-	    (*i).delta -= t.delta;
-	    break;
-	}
-    }
-    tevents.insert (i, t);
+    tevents.add (cb, Timer, tmout, gettime());
 }
 
 void
@@ -382,27 +666,8 @@ MICO::SelectDispatcher::remove (CORBA::DispatcherCallback *cb, Event e)
 {
     SignalBlocker __sb;
 
-    if (e == All || e == Timer) {
-	list<TimerEvent>::iterator i, next;
-	bool again;
-
-	do {
-	  again = false;
-	  for (i = tevents.begin(); i != tevents.end(); i++) {
-	    next = i;
-	    ++next;
-	    if ((*i).cb == cb) {
-	      CORBA::Long delta = (*i).delta;
-	      if (next != tevents.end())
-		(*next).delta += delta;
-	      tevents.erase (i);
-	      again = true;
-	      break;
-	    }
-	  }
-	}
-	while (again);
-    }
+    if (e == All || e == Timer)
+	tevents.remove (cb);
     if (e == All || e == Read || e == Write || e == Except) {
 	list<FileEvent>::iterator i;
 	bool again;
@@ -508,17 +773,12 @@ MICO::SelectDispatcher::move (CORBA::Dispatcher *disp)
     fevents.erase (fevents.begin(), fevents.end());
     update_fevents ();
 
-    update_tevents ();
-    CORBA::Long tmout = 0;
-    list<TimerEvent>::iterator j;
-    for (j = tevents.begin(); j != tevents.end(); ++j) {
-	tmout += (*j).delta;
-	if (tmout < 0)
-	    tmout = 0;
-        (*j).cb->callback (disp, CORBA::Dispatcher::Moved);
-	disp->tm_event ((*j).cb, tmout);
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j) {
+        tv[j].cb->callback (disp, CORBA::Dispatcher::Moved);
+	disp->tm_event (tv[j].cb, tv[j].tmout);
     }
-    tevents.erase (tevents.begin(), tevents.end());
 }
 
 CORBA::Boolean
@@ -557,9 +817,8 @@ MICO::SelectDispatcher::idle () const
    */
 
   if (tevents.size()) {
-    // Discard const for update_tevents()
-    ((SelectDispatcher *) this)->update_tevents ();
-    if (tevents.front().delta <= 0) {
+    // Discard const for next_timeout()
+    if (((SelectDispatcher *) this)->tevents.next_timeout (gettime()) == 0) {
       return FALSE;
     }
   }
@@ -588,9 +847,7 @@ MICO::SelectDispatcherFactory::create()
 CORBA::Boolean MICO::PollDispatcher::_isblocking = FALSE;
 
 MICO::PollDispatcher::PollDispatcher ()
-:   last_update(0)
-,   init(TRUE)
-,   locked(0)
+:   locked(0)
 ,   has_deleted_fevents(FALSE)
 ,   must_rebuild_pollset(TRUE)
 {
@@ -602,9 +859,10 @@ MICO::PollDispatcher::~PollDispatcher ()
     for (i = fevents.begin(); i != fevents.end(); ++i)
         (*i).cb->callback (this, Remove);
 
-    list<TimerEvent>::iterator j;
-    for (j = tevents.begin(); j != tevents.end(); ++j)
-        (*j).cb->callback (this, Remove);
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j)
+        tv[j].cb->callback (this, Remove);
 }
 
 void 
@@ -629,11 +887,8 @@ MICO::PollDispatcher::gettime () const
 CORBA::Long
 MICO::PollDispatcher::sleeptime ()
 {
-    if (tevents.empty()) 
-        return 1000;
-
-    update_tevents();
-    return (tevents.front().delta > 0 ? tevents.front().delta : 0);
+    CORBA::Long t = tevents.next_timeout (gettime());
+    return (t < 0 ? 1000 : t);
 }
 
 void
@@ -677,39 +932,16 @@ MICO::PollDispatcher::build_pollset ()
     must_rebuild_pollset = FALSE;
 }
 
-void
-MICO::PollDispatcher::update_tevents ()
-{
-    CORBA::Long curr = gettime();
-    if (init || tevents.empty() || curr - last_update < 0) {
-        last_update = curr;
-        init = FALSE;
-    } else {
-        tevents.front().delta -= (curr - last_update);
-        last_update = curr;
-    }
-}
-
 void
 MICO::PollDispatcher::handle_tevents ()
 {
     SignalBlocker __sb;
 
-    if (tevents.empty())
-        return;
-
-    update_tevents ();
-    while (!tevents.empty() && tevents.front().delta <= 0) {
-        TimerEvent t = tevents.front();
-        tevents.pop_front();
-        if (!tevents.empty())
-            tevents.front().delta += t.delta;
-
+    TimerWheel::TimerEvent t;
+    while (tevents.expired (gettime(), t)) {
         __sb.unblock();
         t.cb->callback (this, t.event);
         __sb.block();
-
-        update_tevents ();
     }
 }
 
@@ -820,19 +1052,7 @@ MICO::PollDispatcher::tm_event (CORBA::DispatcherCallback *cb,
     SignalBlocker __sb;
 
     assert ((CORBA::Long)tmout >= 0);
-    TimerEvent t (Timer, tmout, cb);
-
-    update_tevents ();
-    list<TimerEvent>::iterator i;
-    for (i = tevents.begin(); i != tevents.end(); ++i) {
-        if ((*i).delta <= t.delta) {
-            t.delta -= (*i).delta;
-        } else {
-            (*i).delta -= t.delta;
-            break;
-        }
-    }
-    tevents.insert (i, t);
+    tevents.add (cb, Timer, tmout, gettime());
 }
 
 void
@@ -840,20 +1060,8 @@ MICO::PollDispatcher::remove (CORBA::DispatcherCallback *cb, Event e)
 {
     SignalBlocker __sb;
 
-    if (e == All || e == Timer) {
-        list<TimerEvent>::iterator i = tevents.begin();
-        while (i != tevents.end()) {
-            list<TimerEvent>::iterator next = i;
-            ++next;
-            if ((*i).cb == cb) {
-                CORBA::Long delta = (*i).delta;
-                if (next != tevents.end())
-                    (*next).delta += delta;
-                tevents.erase (i);
-            }
-            i = next;
-        }
-    }
+    if (e == All || e == Timer)
+        tevents.remove (cb);
     if (e == All || e == Read || e == Write || e == Except) {
         list<FileEvent>::iterator i = fevents.begin();
 
@@ -923,17 +1131,12 @@ MICO::PollDispatcher::move (CORBA::Dispatcher *disp)
     fevents.erase (fevents.begin(), fevents.end());
     must_rebuild_pollset = TRUE;
 
-    update_tevents ();
-    CORBA::Long tmout = 0;
-    list<TimerEvent>::iterator j;
-    for (j = tevents.begin(); j != tevents.end(); ++j) {
-        tmout += (*j).delta;
-        if (tmout < 0)
-            tmout = 0;
-        (*j).cb->callback (disp, CORBA::Dispatcher::Moved);
-        disp->tm_event ((*j).cb, tmout);
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j) {
+        tv[j].cb->callback (disp, CORBA::Dispatcher::Moved);
+        disp->tm_event (tv[j].cb, tv[j].tmout);
     }
-    tevents.erase (tevents.begin(), tevents.end());
 }
 
 CORBA::Boolean
@@ -963,9 +1166,9 @@ MICO::PollDispatcher::idle () const
      */
 
     if (tevents.size()) {
-        // Discard const for update_tevents()
-        ((PollDispatcher *) this)->update_tevents ();
-        if (tevents.front().delta <= 0) {
+        // Discard const for next_timeout()
+        TimerWheel &tw = ((PollDispatcher *) this)->tevents;
+        if (tw.next_timeout (gettime()) == 0) {
             return FALSE;
         }
     }
@@ -988,3 +1191,409 @@ MICO::PollDispatcherFactory::create()
 }
 
 #endif // HAVE_POLL_H
+
+#ifdef HAVE_SYS_EPOLL_H
+
+/************************** EpollDispatcher *****************************/
+
+CORBA::Boolean MICO::EpollDispatcher::_isblocking = FALSE;
+
+MICO::EpollDispatcher::EpollDispatcher (CORBA::Boolean et)
+:   edge_triggered(et)
+,   nfevents(0)
+,   evbuf(256)
+{
+    epfd = ::epoll_create (256);
+    assert (epfd >= 0);
+}
+
+MICO::EpollDispatcher::~EpollDispatcher ()
+{
+    for (CORBA::ULong fd = 0; fd < fevents.size(); ++fd) {
+        FileEvent *fe = fevents[fd];
+        if (!fe)
+            continue;
+        for (CORBA::ULong i = 0; i < fe->handlers.size(); ++i)
+            fe->handlers[i].cb->callback (this, Remove);
+        delete fe;
+    }
+
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j)
+        tv[j].cb->callback (this, Remove);
+
+    ::close (epfd);
+}
+
+void 
+MICO::EpollDispatcher::block (CORBA::Boolean b)
+{
+    _isblocking = b;
+}
+
+CORBA::Boolean 
+MICO::EpollDispatcher::isblocking ()
+{
+    return _isblocking;
+}
+
+CORBA::Long
+MICO::EpollDispatcher::gettime () const
+{
+    OSMisc::TimeVal ct = OSMisc::gettime();
+    return ct.tv_sec*1000+ct.tv_usec/1000;
+}
+
+CORBA::Long
+MICO::EpollDispatcher::sleeptime ()
+{
+    CORBA::Long t = tevents.next_timeout (gettime());
+    return (t < 0 ? 1000 : t);
+}
+
+void
+MICO::EpollDispatcher::update_interest (FileEvent *fe)
+{
+    CORBA::ULong mask = 0;
+    for (CORBA::ULong i = 0; i < fe->handlers.size(); ++i) {
+        switch (fe->handlers[i].event) {
+            case Read:
+                mask |= EPOLLIN;
+                break;
+            case Write:
+                mask |= EPOLLOUT;
+                break;
+            case Except:
+                mask |= EPOLLPRI;
+                break;
+            default:
+                assert (0);
+        }
+    }
+    if (mask == fe->mask)
+        return;
+
+    struct epoll_event ev;
+    memset (&ev, 0, sizeof (ev));
+    ev.events = mask;
+    if (edge_triggered)
+        ev.events |= EPOLLET;
+    ev.data.fd = fe->fd;
+
+    int r;
+    if (mask == 0) {
+        // fd may already be closed, epoll has forgotten it then
+        ::epoll_ctl (epfd, EPOLL_CTL_DEL, fe->fd, &ev);
+    } else if (fe->mask == 0) {
+        r = ::epoll_ctl (epfd, EPOLL_CTL_ADD, fe->fd, &ev);
+        if (r < 0 && errno == EEXIST)
+            r = ::epoll_ctl (epfd, EPOLL_CTL_MOD, fe->fd, &ev);
+        assert (r == 0 || errno == EBADF);
+    } else {
+        r = ::epoll_ctl (epfd, EPOLL_CTL_MOD, fe->fd, &ev);
+        // fd has been closed and reused behind our back
+        if (r < 0 && errno == ENOENT)
+            r = ::epoll_ctl (epfd, EPOLL_CTL_ADD, fe->fd, &ev);
+        assert (r == 0 || errno == EBADF);
+    }
+    fe->mask = mask;
+}
+
+void
+MICO::EpollDispatcher::add_fevent (Event e, CORBA::DispatcherCallback *cb,
+                                   CORBA::Long fd)
+{
+    assert (fd >= 0);
+
+    if ((CORBA::ULong)fd >= fevents.size())
+        fevents.resize (fd+1, 0);
+    FileEvent *fe = fevents[fd];
+    if (!fe) {
+        fe = fevents[fd] = new FileEvent (fd);
+        ++nfevents;
+    }
+    fe->handlers.push_back (Handler (e, cb));
+    cbfds[cb].push_back (fd);
+    update_interest (fe);
+}
+
+void
+MICO::EpollDispatcher::del_fevent (CORBA::Long fd,
+                                   CORBA::DispatcherCallback *cb, Event e)
+{
+    if ((CORBA::ULong)fd >= fevents.size() || !fevents[fd])
+        return;
+    FileEvent *fe = fevents[fd];
+
+    std::vector<Handler>::iterator i = fe->handlers.begin();
+    while (i != fe->handlers.end()) {
+        if ((*i).cb == cb && (e == All || (*i).event == e))
+            i = fe->handlers.erase (i);
+        else
+            ++i;
+    }
+    update_interest (fe);
+    if (fe->handlers.empty()) {
+        fevents[fd] = 0;
+        --nfevents;
+        delete fe;
+    }
+}
+
+CORBA::Boolean
+MICO::EpollDispatcher::has_handler (CORBA::Long fd, const Handler &h) const
+{
+    if ((CORBA::ULong)fd >= fevents.size() || !fevents[fd])
+        return FALSE;
+    const std::vector<Handler> &hs = fevents[fd]->handlers;
+    for (CORBA::ULong i = 0; i < hs.size(); ++i) {
+        if (hs[i].cb == h.cb && hs[i].event == h.event)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+void
+MICO::EpollDispatcher::handle_tevents ()
+{
+    SignalBlocker __sb;
+
+    TimerWheel::TimerEvent t;
+    while (tevents.expired (gettime(), t)) {
+        __sb.unblock();
+        t.cb->callback (this, t.event);
+        __sb.block();
+    }
+}
+
+void
+MICO::EpollDispatcher::handle_fevents (int nevents)
+{
+    // callbacks may add and remove file events for any fd, including
+    // the one being dispatched, so work on a snapshot of the handlers
+    // and check each of them is still registered before calling it
+    std::vector<Handler> hs;
+
+    for (int n = 0; n < nevents; ++n) {
+        CORBA::Long fd = evbuf[n].data.fd;
+        CORBA::ULong revents = evbuf[n].events;
+
+        if ((CORBA::ULong)fd >= fevents.size() || !fevents[fd])
+            continue;
+        hs = fevents[fd]->handlers;
+
+        for (CORBA::ULong i = 0; i < hs.size(); ++i) {
+            switch (hs[i].event) {
+                case Read:
+                    if (!(revents & (EPOLLIN | EPOLLERR | EPOLLHUP)))
+                        continue;
+                    break;
+                case Write:
+                    if (!(revents & (EPOLLOUT | EPOLLERR)))
+                        continue;
+                    break;
+                case Except:
+                    if (!(revents & EPOLLPRI))
+                        continue;
+                    break;
+                default:
+                    assert (0);
+            }
+            if (has_handler (fd, hs[i]))
+                hs[i].cb->callback (this, hs[i].event);
+        }
+    }
+}
+
+void
+MICO::EpollDispatcher::rd_event (CORBA::DispatcherCallback *cb,
+                                 CORBA::Long fd)
+{
+    SignalBlocker __sb;
+
+    add_fevent (Read, cb, fd);
+}
+
+void
+MICO::EpollDispatcher::wr_event (CORBA::DispatcherCallback *cb,
+                                 CORBA::Long fd)
+{
+    SignalBlocker __sb;
+
+    add_fevent (Write, cb, fd);
+}
+
+void
+MICO::EpollDispatcher::ex_event (CORBA::DispatcherCallback *cb,
+                                 CORBA::Long fd)
+{
+    SignalBlocker __sb;
+
+    add_fevent (Except, cb, fd);
+}
+
+void
+MICO::EpollDispatcher::tm_event (CORBA::DispatcherCallback *cb,
+                                 CORBA::ULong tmout)
+{
+    SignalBlocker __sb;
+
+    assert ((CORBA::Long)tmout >= 0);
+    tevents.add (cb, Timer, tmout, gettime());
+}
+
+void
+MICO::EpollDispatcher::remove (CORBA::DispatcherCallback *cb, Event e)
+{
+    SignalBlocker __sb;
+
+    if (e == All || e == Timer)
+        tevents.remove (cb);
+    if (e == All || e == Read || e == Write || e == Except) {
+        CBMap::iterator i = cbfds.find (cb);
+        if (i == cbfds.end())
+            return;
+
+        // a callback is usually registered for a single fd
+        FDVec fds;
+        fds.swap ((*i).second);
+        cbfds.erase (i);
+        for (CORBA::ULong k = 0; k < fds.size(); ++k)
+            del_fevent (fds[k], cb, e);
+
+        if (e != All) {
+            // keep the fds the callback still has other events for
+            for (CORBA::ULong k = 0; k < fds.size(); ++k) {
+                if ((CORBA::ULong)fds[k] >= fevents.size() || !fevents[fds[k]])
+                    continue;
+                const std::vector<Handler> &hs = fevents[fds[k]]->handlers;
+                for (CORBA::ULong h = 0; h < hs.size(); ++h) {
+                    if (hs[h].cb == cb) {
+                        cbfds[cb].push_back (fds[k]);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+MICO::EpollDispatcher::run (CORBA::Boolean infinite)
+{
+    do {
+        int r = ::epoll_wait (epfd, &evbuf[0], evbuf.size(), sleeptime());
+        assert (r >= 0 || errno == EINTR || errno == EAGAIN ||
+                errno == EWOULDBLOCK);
+
+        if (r > 0) {
+            handle_fevents (r);
+            if ((CORBA::ULong)r == evbuf.size())
+                evbuf.resize (2*evbuf.size());
+        }
+        handle_tevents ();
+    } while (infinite);
+}
+
+void
+MICO::EpollDispatcher::move (CORBA::Dispatcher *disp)
+{
+    SignalBlocker __sb;
+
+    for (CORBA::ULong fd = 0; fd < fevents.size(); ++fd) {
+        FileEvent *fe = fevents[fd];
+        if (!fe)
+            continue;
+        fevents[fd] = 0;
+        ::epoll_ctl (epfd, EPOLL_CTL_DEL, fd, 0);
+
+        for (CORBA::ULong i = 0; i < fe->handlers.size(); ++i) {
+            Handler &h = fe->handlers[i];
+            switch (h.event) {
+                case Read:
+                    h.cb->callback (disp, CORBA::Dispatcher::Moved);
+                    disp->rd_event (h.cb, fd);
+                    break;
+                case Write:
+                    h.cb->callback (disp, CORBA::Dispatcher::Moved);
+                    disp->wr_event (h.cb, fd);
+                    break;
+                case Except:
+                    h.cb->callback (disp, CORBA::Dispatcher::Moved);
+                    disp->ex_event (h.cb, fd);
+                    break;
+                default:
+                    break;
+            }
+        }
+        delete fe;
+    }
+    fevents.clear ();
+    cbfds.clear ();
+    nfevents = 0;
+
+    vector<TimerWheel::TimerEvent> tv;
+    tevents.drain (gettime(), tv);
+    for (mico_vec_size_type j = 0; j < tv.size(); ++j) {
+        tv[j].cb->callback (disp, CORBA::Dispatcher::Moved);
+        disp->tm_event (tv[j].cb, tv[j].tmout);
+    }
+}
+
+CORBA::Boolean
+MICO::EpollDispatcher::idle () const
+{
+    SignalBlocker __sb;
+
+    /*
+     * Any pending file events? The epoll fd itself polls readable
+     * when events are queued; polling it does not consume them, which
+     * matters in edge-triggered mode.
+     */
+
+    if (nfevents > 0) {
+        struct pollfd pfd;
+        pfd.fd = epfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        int r = ::poll (&pfd, 1, 0);
+        assert (r >= 0 || errno == EINTR || errno == EAGAIN ||
+                errno == EWOULDBLOCK);
+
+        if (r > 0) {
+            return FALSE;
+        }
+    }
+
+    /*
+     * No? Then what about pending timer events?
+     */
+
+    if (tevents.size()) {
+        // Discard const for next_timeout()
+        TimerWheel &tw = ((EpollDispatcher *) this)->tevents;
+        if (tw.next_timeout (gettime()) == 0) {
+            return FALSE;
+        }
+    }
+
+    /*
+     * Then we're idle ...
+     */
+
+    return TRUE;
+}
+
+//
+// EpollDispatcherFactory
+//
+
+CORBA::Dispatcher*
+MICO::EpollDispatcherFactory::create()
+{
+    return new EpollDispatcher (_edge_triggered);
+}
+
+#endif // HAVE_SYS_EPOLL_H
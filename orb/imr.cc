@@ -387,7 +387,7 @@ CORBA::ImplementationDef::ActivationMode CORBA::ImplementationDef_stub::mode()
   CORBA::ImplementationDef::ActivationMode _res;
   CORBA::StaticAny __res( _marshaller_CORBA_ImplementationDef_ActivationMode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_mode" );
+  CORBA::StaticRequest __req( this, "_get_mode", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -437,7 +437,7 @@ CORBA::ImplementationDef_stub_clp::mode()
 void CORBA::ImplementationDef_stub::mode( CORBA::ImplementationDef::ActivationMode _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ImplementationDef_ActivationMode, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_mode" );
+  CORBA::StaticRequest __req( this, "_set_mode", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -485,7 +485,7 @@ CORBA::ImplementationDef::ObjectInfoList* CORBA::ImplementationDef_stub::objs()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ImplementationDef_ObjectInfo );
 
-  CORBA::StaticRequest __req( this, "_get_objs" );
+  CORBA::StaticRequest __req( this, "_get_objs", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -535,7 +535,7 @@ CORBA::ImplementationDef_stub_clp::objs()
 void CORBA::ImplementationDef_stub::objs( const CORBA::ImplementationDef::ObjectInfoList& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ImplementationDef_ObjectInfo, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_objs" );
+  CORBA::StaticRequest __req( this, "_set_objs", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -584,7 +584,7 @@ char* CORBA::ImplementationDef_stub::name()
   char* _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_name" );
+  CORBA::StaticRequest __req( this, "_get_name", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -636,7 +636,7 @@ char* CORBA::ImplementationDef_stub::command()
   char* _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_command" );
+  CORBA::StaticRequest __req( this, "_get_command", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -686,7 +686,7 @@ CORBA::ImplementationDef_stub_clp::command()
 void CORBA::ImplementationDef_stub::command( const char* _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_command" );
+  CORBA::StaticRequest __req( this, "_set_command", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -735,7 +735,7 @@ char* CORBA::ImplementationDef_stub::tostring()
   char* _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_tostring" );
+  CORBA::StaticRequest __req( this, "_get_tostring", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -972,7 +972,7 @@ CORBA::ImplementationDef_ptr CORBA::ImplRepository_stub::restore( const char* _p
   CORBA::ImplementationDef_ptr _res = CORBA::ImplementationDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ImplementationDef, &_res );
 
-  CORBA::StaticRequest __req( this, "restore" );
+  CORBA::StaticRequest __req( this, "restore", TRUE );
   __req.add_in_arg( &_sa_asstring );
   __req.set_result( &__res );
 
@@ -1029,7 +1029,7 @@ CORBA::ImplementationDef_ptr CORBA::ImplRepository_stub::create( CORBA::Implemen
   CORBA::ImplementationDef_ptr _res = CORBA::ImplementationDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ImplementationDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create" );
+  CORBA::StaticRequest __req( this, "create", TRUE );
   __req.add_in_arg( &_sa_mode );
   __req.add_in_arg( &_sa_objs );
   __req.add_in_arg( &_sa_name );
@@ -1083,7 +1083,7 @@ CORBA::ImplRepository_stub_clp::create( CORBA::ImplementationDef::ActivationMode
 void CORBA::ImplRepository_stub::destroy( CORBA::ImplementationDef_ptr _par_impl_def )
 {
   CORBA::StaticAny _sa_impl_def( _marshaller_CORBA_ImplementationDef, &_par_impl_def );
-  CORBA::StaticRequest __req( this, "destroy" );
+  CORBA::StaticRequest __req( this, "destroy", TRUE );
   __req.add_in_arg( &_sa_impl_def );
 
   __req.invoke();
@@ -1132,7 +1132,7 @@ CORBA::ImplRepository::ImplDefSeq* CORBA::ImplRepository_stub::find_by_name( con
   CORBA::StaticAny _sa_name( CORBA::_stc_string, &_par_name );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ImplementationDef );
 
-  CORBA::StaticRequest __req( this, "find_by_name" );
+  CORBA::StaticRequest __req( this, "find_by_name", TRUE );
   __req.add_in_arg( &_sa_name );
   __req.set_result( &__res );
 
@@ -1185,7 +1185,7 @@ CORBA::ImplRepository::ImplDefSeq* CORBA::ImplRepository_stub::find_by_repoid( c
   CORBA::StaticAny _sa_repoid( CORBA::_stc_string, &_par_repoid );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ImplementationDef );
 
-  CORBA::StaticRequest __req( this, "find_by_repoid" );
+  CORBA::StaticRequest __req( this, "find_by_repoid", TRUE );
   __req.add_in_arg( &_sa_repoid );
   __req.set_result( &__res );
 
@@ -1239,7 +1239,7 @@ CORBA::ImplRepository::ImplDefSeq* CORBA::ImplRepository_stub::find_by_repoid_ta
   CORBA::StaticAny _sa_tag( CORBA::_stcseq_octet, &_par_tag );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ImplementationDef );
 
-  CORBA::StaticRequest __req( this, "find_by_repoid_tag" );
+  CORBA::StaticRequest __req( this, "find_by_repoid_tag", TRUE );
   __req.add_in_arg( &_sa_repoid );
   __req.add_in_arg( &_sa_tag );
   __req.set_result( &__res );
@@ -1292,7 +1292,7 @@ CORBA::ImplRepository::ImplDefSeq* CORBA::ImplRepository_stub::find_all()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ImplementationDef );
 
-  CORBA::StaticRequest __req( this, "find_all" );
+  CORBA::StaticRequest __req( this, "find_all", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -1525,7 +1525,7 @@ char* CORBA::POAMediator_stub::create_impl( const char* _par_svid, const char* _
   char* _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "create_impl" );
+  CORBA::StaticRequest __req( this, "create_impl", TRUE );
   __req.add_in_arg( &_sa_svid );
   __req.add_in_arg( &_sa_ior );
   __req.set_result( &__res );
@@ -1577,7 +1577,7 @@ CORBA::POAMediator_stub_clp::create_impl( const char* _par_svid, const char* _pa
 void CORBA::POAMediator_stub::activate_impl( const char* _par_svid )
 {
   CORBA::StaticAny _sa_svid( CORBA::_stc_string, &_par_svid );
-  CORBA::StaticRequest __req( this, "activate_impl" );
+  CORBA::StaticRequest __req( this, "activate_impl", TRUE );
   __req.add_in_arg( &_sa_svid );
 
   __req.invoke();
@@ -1624,7 +1624,7 @@ CORBA::POAMediator_stub_clp::activate_impl( const char* _par_svid )
 void CORBA::POAMediator_stub::deactivate_impl( const char* _par_svid )
 {
   CORBA::StaticAny _sa_svid( CORBA::_stc_string, &_par_svid );
-  CORBA::StaticRequest __req( this, "deactivate_impl" );
+  CORBA::StaticRequest __req( this, "deactivate_impl", TRUE );
   __req.add_in_arg( &_sa_svid );
 
   __req.invoke();
@@ -1674,7 +1674,7 @@ CORBA::Boolean CORBA::POAMediator_stub::force_activation( CORBA::ImplementationD
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "force_activation" );
+  CORBA::StaticRequest __req( this, "force_activation", TRUE );
   __req.add_in_arg( &_sa_impl );
   __req.set_result( &__res );
 
@@ -1728,7 +1728,7 @@ CORBA::Boolean CORBA::POAMediator_stub::hold( CORBA::ImplementationDef_ptr _par_
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "hold" );
+  CORBA::StaticRequest __req( this, "hold", TRUE );
   __req.add_in_arg( &_sa_impl );
   __req.set_result( &__res );
 
@@ -1782,7 +1782,7 @@ CORBA::Boolean CORBA::POAMediator_stub::stop( CORBA::ImplementationDef_ptr _par_
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "stop" );
+  CORBA::StaticRequest __req( this, "stop", TRUE );
   __req.add_in_arg( &_sa_impl );
   __req.set_result( &__res );
 
@@ -1836,7 +1836,7 @@ CORBA::Boolean CORBA::POAMediator_stub::_cxx_continue( CORBA::ImplementationDef_
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "continue" );
+  CORBA::StaticRequest __req( this, "continue", TRUE );
   __req.add_in_arg( &_sa_impl );
   __req.set_result( &__res );
 
@@ -1886,7 +1886,7 @@ CORBA::POAMediator_stub_clp::_cxx_continue( CORBA::ImplementationDef_ptr _par_im
 
 void CORBA::POAMediator_stub::shutdown_server()
 {
-  CORBA::StaticRequest __req( this, "shutdown_server" );
+  CORBA::StaticRequest __req( this, "shutdown_server", TRUE );
 
   __req.invoke();
 
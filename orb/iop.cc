@@ -162,6 +162,7 @@ MICO::GIOPOutContext::GIOPOutContext (GIOPCodec *codec,
     _delete_buf = TRUE;
     _ec = codec->ec_proto()->clone (_buf, 0, csc ? csc : codec->converter(), 0);
     _delete_ec = TRUE;
+    _stream = 0;
 }
 
 MICO::GIOPOutContext::GIOPOutContext (CORBA::DataEncoder *ec)
@@ -170,6 +171,7 @@ MICO::GIOPOutContext::GIOPOutContext (CORBA::DataEncoder *ec)
     _delete_buf = FALSE;
     _ec = ec;
     _delete_ec = FALSE;
+    _stream = 0;
 }
 
 MICO::GIOPOutContext::~GIOPOutContext ()
@@ -506,25 +508,109 @@ MICO::GIOPCodec::put_target (GIOPOutContext &out, CORBA::Object_ptr obj)
     }
 }
 
+namespace MICO {
+
+/*
+ * sends a message to a connection while it is being marshaled. the
+ * encoder calls flush() whenever its buffer holds more than a fragment;
+ * complete fragments are sent and the rest is kept behind the header
+ * of the next fragment.
+ */
+class GIOPStreamer : public CORBA::DataEncoder::FlushCallback {
+    GIOPCodec *_codec;
+    GIOPConn *_conn;
+    CORBA::Buffer *_hdr;
+    CORBA::ULong _sent;
+public:
+    GIOPStreamer (GIOPCodec *codec, GIOPConn *conn)
+	: _codec (codec), _conn (conn), _hdr (0), _sent (0)
+    {}
+    ~GIOPStreamer ()
+    { delete _hdr; }
+
+    CORBA::Boolean started () const
+    { return _hdr != 0; }
+
+    void flush (CORBA::DataEncoder *);
+};
+
+}
+
+void
+MICO::GIOPStreamer::flush (CORBA::DataEncoder *ec)
+{
+    CORBA::Buffer *b = ec->buffer();
+    CORBA::ULong size = _conn->fragment_size();
+
+    if (b->length() <= size)
+	return;
+    // after the first fragment the buffer starts with a fragment header
+    CORBA::ULong hlen = _hdr ? _hdr->length() : 0;
+    b->rseek_rel (hlen);
+    while (b->length() + hlen > size) {
+	CORBA::Buffer *frag = _codec->get_fragment (b, _hdr, size);
+	if (!frag) {
+	    // message may not be fragmented
+	    ec->flush_callback (0, 0);
+	    return;
+	}
+	_sent += frag->length() - hlen;
+	hlen = _hdr->length();
+	_conn->output (frag);
+    }
+    // keep the rest, aligned as in the unfragmented message
+    CORBA::Buffer rest (b->length());
+    rest.put (b->data(), b->length());
+    b->reset (size + _hdr->length());
+    b->put (_hdr->data(), _hdr->length());
+    b->walign_base ((b->wpos() + 8 - _sent % 8) % 8);
+    b->put (rest.data(), rest.length());
+}
+
 CORBA::Boolean
 MICO::GIOPCodec::put_args (GIOPOutContext &out, CORBA::ORBRequest *req,
-			   CORBA::Boolean inp)
+			   CORBA::Boolean inp, CORBA::ULong &key)
 {
     CORBA::DataEncoder *ec = out.ec();
+    CORBA::Boolean ret = TRUE;
+    Metrics::Stopwatch sw (Metrics::Marshal);
+
+    // large GIOP 1.2 messages go out in fragments while the arguments
+    // are marshaled, so they never have to be kept in memory as a whole
+    GIOPStreamer streamer (this, out.stream());
+#ifndef USE_OLD_INTERCEPTORS
+    // (old interceptors want to see the whole message)
+    if (out.stream() && out.stream()->fragment_size() > 0 &&
+	_giop_ver >= 0x0102)
+	ec->flush_callback (&streamer, out.stream()->fragment_size());
+#endif
 
     ec->struct_begin ();
     {
 	if (inp) {
-	    if (!req->get_in_args (ec))
-		return FALSE;
+	    ret = req->get_in_args (ec);
 	} else {
 	    CORBA::Boolean is_except;
-	    if (!req->get_out_args (ec, is_except))
-		return FALSE;
+	    ret = req->get_out_args (ec, is_except);
 	}
     }
     ec->struct_end ();
-    return TRUE;
+    ec->flush_callback (0, 0);
+
+    if (streamer.started()) {
+	// the buffer holds the last fragment now
+	key = ec->buffer()->rpos() + _size_offset;
+	if (!ret) {
+	    // the peer has got part of the message already, complete it
+	    // so it is discarded there
+	    put_size (out, key);
+	    CORBA::Buffer *b = new CORBA::Buffer (ec->buffer()->length());
+	    b->put (ec->buffer()->data(), ec->buffer()->length());
+	    out.stream()->output (b);
+	    ec->buffer()->reset ();
+	}
+    }
+    return ret;
 }
 
 void
@@ -592,7 +678,7 @@ MICO::GIOPCodec::put_invoke_request (GIOPOutContext &out,
     if (_giop_ver >= 0x0102)
 	ec->buffer()->walign (ec->max_alignment());
 
-    if (!put_args (out, req, TRUE)) {
+    if (!put_args (out, req, TRUE, key)) {
 	ec->byteorder (bo);
 	return FALSE;
     }
@@ -673,7 +759,7 @@ MICO::GIOPCodec::put_invoke_reply (GIOPOutContext &out,
 	if (_giop_ver >= 0x0102) {
 	    ec->buffer()->walign (ec->max_alignment());
 	}
-	if (!put_args (out, req, FALSE)) {
+	if (!put_args (out, req, FALSE, key)) {
 	    ec->byteorder (bo);
 	    return FALSE;
 	}
@@ -926,6 +1012,87 @@ MICO::GIOPCodec::put_error_msg (GIOPOutContext &out)
     return TRUE;
 }
 
+/*
+ * set flags and size in the header of an outgoing fragment. the size
+ * is in the byte order given by the flags.
+ */
+void
+MICO::GIOPCodec::put_fragment_header (CORBA::Octet *hdr, CORBA::Octet flags,
+				      CORBA::ULong sz)
+{
+    hdr[6] = flags;
+    for (int i = 0; i < 4; ++i) {
+	int shift = (flags & GIOP_BYTEORDER_BIT) ? 8*i : 8*(3-i);
+	hdr[_size_offset+i] = (CORBA::Octet)(sz >> shift);
+    }
+}
+
+/*
+ * split the next fragment off the outgoing message msg, whose read
+ * position is advanced past the data taken. no fragment has been split
+ * off yet if hdr is 0: the first fragment is returned if msg is larger
+ * than size and may be fragmented, else 0. hdr then holds the header
+ * for the fragments that follow until msg is empty; the caller has to
+ * delete it. all fragments but the last have a body size that is a
+ * multiple of 8, as required by GIOP 1.2.
+ */
+CORBA::Buffer *
+MICO::GIOPCodec::get_fragment (CORBA::Buffer *msg, CORBA::Buffer *&hdr,
+			       CORBA::ULong size)
+{
+    CORBA::Octet *p = msg->data();
+    CORBA::ULong len = msg->length();
+    CORBA::ULong body = (size - _headerlen) & ~7;
+    CORBA::Buffer *frag;
+
+    if (!hdr) {
+	if (size < GIOP_MIN_FRAGMENT_SIZE || len <= _headerlen + body)
+	    return 0;
+	// GIOP 1.0 knows no fragments
+	if (p[4] != 1 || p[5] < 1 || (p[6] & GIOP_FRAGMENT_BIT))
+	    return 0;
+	switch ((GIOP::MsgType)p[7]) {
+	case GIOP::Request:
+	case GIOP::Reply:
+	    break;
+	case GIOP::LocateRequest:
+	case GIOP::LocateReply:
+	    if (p[5] >= 2)
+		break;
+	default:
+	    return 0;
+	}
+
+	hdr = new CORBA::Buffer (_headerlen + 4);
+	hdr->put (p, _headerlen);
+	// GIOP 1.2 fragments start with the request id ...
+	if (p[5] >= 2)
+	    hdr->put (p + _headerlen, 4);
+	hdr->data()[7] = GIOP::Fragment;
+
+	frag = new CORBA::Buffer (_headerlen + body);
+	frag->put (p, _headerlen + body);
+	put_fragment_header (frag->data(), p[6] | GIOP_FRAGMENT_BIT, body);
+	msg->rseek_rel (_headerlen + body);
+	return frag;
+    }
+
+    CORBA::ULong fraghdrlen = hdr->length() - _headerlen;
+    CORBA::Octet flags = hdr->data()[6] | GIOP_FRAGMENT_BIT;
+    body -= fraghdrlen;
+    if (len <= body) {
+	// last fragment
+	body = len;
+	flags &= ~GIOP_FRAGMENT_BIT;
+    }
+    frag = new CORBA::Buffer (hdr->length() + body);
+    frag->put (hdr->data(), hdr->length());
+    frag->put (p, body);
+    put_fragment_header (frag->data(), flags, fraghdrlen + body);
+    msg->rseek_rel (body);
+    return frag;
+}
+
 #define check(exp) if (!(exp)) return FALSE
 
 CORBA::Boolean
@@ -1468,6 +1635,7 @@ MICO::GIOPCodec::get_invoke_reply2 (GIOPInContext &in,
     case GIOP::NO_EXCEPTION:
 	if (req) {
 	    // may be NULL for a bind()
+	    Metrics::Stopwatch sw (Metrics::Unmarshal);
 	    req->context (&ctx);
 	    return req->set_out_args (dc, FALSE);
 	}
@@ -1744,6 +1912,7 @@ CORBA::Boolean
 MICO::GIOPRequest::get_in_args (CORBA::NVList_ptr iparams,
 				CORBA::Context_ptr &ctx)
 {
+    Metrics::Stopwatch sw (Metrics::Unmarshal);
     _idc->buffer()->rseek_beg (_istart);
 
     if (iparams->count() == 0 && _idc->buffer()->length() == 0)
@@ -1783,6 +1952,7 @@ CORBA::Boolean
 MICO::GIOPRequest::get_in_args (StaticAnyList *iparams,
 				CORBA::Context_ptr &ctx)
 {
+    Metrics::Stopwatch sw (Metrics::Unmarshal);
     _idc->buffer()->rseek_beg (_istart);
 
     if (iparams->size() == 0 && _idc->buffer()->length() == 0)
@@ -2279,13 +2449,20 @@ MICO::GIOPConnReader::_run(void* arg) {
 MICO::GIOPConnWriter::GIOPConnWriter( MICO::GIOPConn *_conn ) {
 
     WorkerThread *kt;
-    PassiveMsgQueue     *mq;
 
     __NAME( name( "GIOPConnWriter" ) );
     conn = _conn;
-    mq = new PassiveMsgQueue();
-    __NAME( mq->name ("GIOPConnWriter") );
-    input_mc = mq;
+    if (MICO::MTManager::channel_type( MsgChannel::passive )
+	== MsgChannel::passive_ring) {
+	PassiveRingMsgQueue *mq = new PassiveRingMsgQueue();
+	__NAME( mq->name ("GIOPConnWriter") );
+	input_mc = mq;
+    }
+    else {
+	PassiveMsgQueue *mq = new PassiveMsgQueue();
+	__NAME( mq->name ("GIOPConnWriter") );
+	input_mc = mq;
+    }
     kt = MICO::MTManager::thread_pool_manager()->get_idle_thread( Operation::Writer );
     assert (kt);
     kt->register_operation( this );
@@ -2367,6 +2544,17 @@ MICO::InputHandler::process( msg_type * msg ) {
     delete msg;
 }
 
+void
+MICO::InputHandler::reject( msg_type * msg ) {
+
+    MICO::GIOPConnMsg *m = (MICO::GIOPConnMsg *)msg->data();
+
+    m->conn->input_rejected( m->b );
+
+    delete m;
+    delete msg;
+}
+
 MICO::Operation *
 MICO::InputHandler::copy() const {
 
@@ -2409,13 +2597,20 @@ MICO::GIOPConn::GIOPConn (CORBA::Dispatcher *disp, CORBA::Transport *transp,
 
     _inbuf = new CORBA::Buffer;
     _inlen = _codec->header_length ();
+    _rabuf = new CORBA::Buffer;
+    _stats = 0;
+    if (Metrics::enabled())
+	_stats = Metrics::open_conn (_transp->peer()->stringify().c_str());
+    _ra_drained = FALSE;
     _inflags = 0;
     _infrag = 0;
     _inbufs = 0;
     _total_fragsize = 0;
+    _frag_size = 0;
 
     _refcnt = 0;
     _idle_tmout = tmout;
+    _last_used = 0;
     _have_tmout = FALSE;
     _have_wselect = FALSE;
 #ifdef HAVE_THREADS
@@ -2516,6 +2711,11 @@ MICO::GIOPConn::terminate ()
     list<CORBA::Buffer *>::iterator i;
     for (i = _outbufs.begin(); i != _outbufs.end(); ++i)
 	delete *i;
+    list<OutFrag>::iterator j;
+    for (j = _outfrags.begin(); j != _outfrags.end(); ++j) {
+	delete (*j).msg;
+	delete (*j).hdr;
+    }
 
     _disp->remove (this, CORBA::Dispatcher::Timer);
 
@@ -2569,8 +2769,11 @@ MICO::GIOPConn::~GIOPConn ()
 
     assert (_refcnt == 0);
 
+    if (_stats)
+	Metrics::close_conn (_stats);
     delete _transp;
     delete _inbuf;
+    delete _rabuf;
     CORBA::release (_codec);
 #ifdef HAVE_THREADS
     if (_M_use_reader_thread) {
@@ -2700,12 +2903,53 @@ MICO::GIOPConn::close_connection()
 #endif
 
 
+/*
+ * append up to len bytes of input to _inbuf. with readahead set, input
+ * is read from the transport in chunks of GIOP_READAHEAD_SIZE bytes, so
+ * a single read usually fetches a complete message or several
+ * pipelined ones. a short read is taken to mean the transport has been
+ * drained, no further reads are done until the next do_read().
+ */
+CORBA::Long
+MICO::GIOPConn::read_input (CORBA::ULong len, CORBA::Boolean readahead)
+{
+    if (_rabuf->length() == 0) {
+	if (!readahead || len >= GIOP_READAHEAD_SIZE) {
+	    CORBA::Long r = _transp->read (*_inbuf, len);
+	    count_in (r);
+	    return r;
+	}
+	if (_ra_drained)
+	    return 0;
+	_rabuf->reset (GIOP_READAHEAD_SIZE);
+	CORBA::Long r = _transp->read (*_rabuf, GIOP_READAHEAD_SIZE);
+	count_in (r);
+	if (r <= 0)
+	    return r;
+	if (r < GIOP_READAHEAD_SIZE)
+	    _ra_drained = TRUE;
+    }
+    CORBA::ULong n = _rabuf->length();
+    if (n > len)
+	n = len;
+    _inbuf->resize (len);
+    _inbuf->put (_rabuf->data(), n);
+    _rabuf->rseek_rel (n);
+    return n;
+}
+
 void
 MICO::GIOPConn::do_read ( const CORBA::Boolean break_after_read )
 {
+    // a blocking read of a whole chunk would wait for more input than
+    // the peer may send, and a caller that stops after one message
+    // must not leave further messages behind in the read-ahead buffer
+    CORBA::Boolean readahead = !break_after_read && !_transp->isblocking();
+    _ra_drained = FALSE;
+
     while (42) {
 	assert (_inlen > 0);
-	CORBA::Long r = _transp->read (*_inbuf, _inlen);
+	CORBA::Long r = read_input (_inlen, readahead);
 #if 1
 	if (r < 0) {
             /*
@@ -2716,7 +2960,7 @@ MICO::GIOPConn::do_read ( const CORBA::Boolean break_after_read )
              *   the next read() instead of beeing able to read
              *   the remaining data until you reach EOF.
              */
-            r = _transp->read (*_inbuf, _inlen);
+            r = read_input (_inlen, readahead);
         }
 #endif
 	if (r < 0 || (r == 0 && _transp->eof())) {
@@ -2996,6 +3240,73 @@ MICO::GIOPConn::do_read ( const CORBA::Boolean break_after_read )
     }
 }
 
+/*
+ * write as many queued messages as possible with one gather write
+ * and drop the ones that have been sent completely.
+ */
+CORBA::Long
+MICO::GIOPConn::write_outbufs ()
+{
+    CORBA::Buffer *bufs[CORBA::Transport::MAX_IOV];
+    CORBA::ULong n = 0;
+
+    for (std::list<CORBA::Buffer *>::iterator i = _outbufs.begin();
+	 i != _outbufs.end() && n < CORBA::Transport::MAX_IOV; ++i)
+	bufs[n++] = *i;
+
+    CORBA::Long r = _transp->write (bufs, n);
+    count_out (r);
+    while (_outbufs.size() > 0 && _outbufs.front()->length() == 0) {
+	// message completely sent
+	delete _outbufs.front();
+	_outbufs.pop_front();
+    }
+    if (_outbufs.size() == 0)
+	next_fragments ();
+    return r;
+}
+
+/*
+ * move messages waiting in _outfrags to _outbufs, up to and including
+ * one fragment of the first message that is too large to go out in
+ * one piece. GIOP 1.2 fragments carry the request id, so a partly sent
+ * message goes to the end of the line and does not hold up the
+ * messages behind it. GIOP 1.1 fragments must follow each other.
+ */
+void
+MICO::GIOPConn::next_fragments ()
+{
+    while (_outfrags.size() > 0 &&
+	   _outbufs.size() < CORBA::Transport::MAX_IOV) {
+	OutFrag f = _outfrags.front();
+	_outfrags.pop_front();
+
+	CORBA::Buffer *frag = _codec->get_fragment (f.msg, f.hdr, _frag_size);
+	if (!frag) {
+	    _outbufs.push_back (f.msg);
+	    continue;
+	}
+	_outbufs.push_back (frag);
+	if (f.msg->length() == 0) {
+	    delete f.msg;
+	    delete f.hdr;
+	} else if (f.hdr->length() > _codec->header_length()) {
+	    _outfrags.push_back (f);
+	} else {
+	    _outfrags.push_front (f);
+	}
+	break;
+    }
+}
+
+void
+MICO::GIOPConn::fragment_size (CORBA::ULong sz)
+{
+    if (sz > 0 && sz < GIOP_MIN_FRAGMENT_SIZE)
+	sz = GIOP_MIN_FRAGMENT_SIZE;
+    _frag_size = sz;
+}
+
 void
 MICO::GIOPConn::do_write ()
 {
@@ -3003,17 +3314,11 @@ MICO::GIOPConn::do_write ()
 
     while (42) {
 	assert (_outbufs.size() > 0);
-	CORBA::Buffer *b = _outbufs.front();
-	CORBA::Long r = _transp->write (*b, b->length());
+	CORBA::Long r = write_outbufs ();
 	if (r > 0) {
-	    if (b->length() == 0) {
-		// message completely sent
-		delete b;
-		_outbufs.pop_front();
-		if (_outbufs.size() == 0) {
-		    check_idle ();
-		    break;
-		}
+	    if (_outbufs.size() == 0) {
+		check_idle ();
+		break;
 	    }
 	} else if (r < 0) {
 	    // connection broken
@@ -3097,7 +3402,7 @@ MICO::GIOPConn::check_busy ()
 CORBA::Boolean
 MICO::GIOPConn::check_events ()
 {
-    if (_transp->isreadable()) {
+    if (_rabuf->length() > 0 || _transp->isreadable()) {
         do_read( _disp->isblocking() );
         return TRUE;
     }
@@ -3163,9 +3468,37 @@ MICO::GIOPConn::output_handler (CORBA::Buffer *b)
 	b->dump ("Out Data", MICO::Logger::Stream (MICO::Logger::Transport));
     }
 
+    if (_frag_size > 0) {
+	// messages take turns, see next_fragments()
+	OutFrag f;
+	f.msg = b;
+	f.hdr = 0;
+	_outfrags.push_back (f);
+	if (_outbufs.size() == 0)
+	    next_fragments ();
+#ifdef HAVE_THREADS
+	if (MICO::MTManager::thread_pool()) {
+	    // busy wait, see below
+	    while (_outbufs.size() > 0) {
+		if (write_outbufs () < 0) {
+		    // connection broken
+		    _transp->rselect (_disp, 0);
+		    _transp->wselect (_disp, 0);
+		    this->close_connection();
+		    break;
+		}
+	    }
+	    return;
+	}
+#endif // HAVE_THREADS
+	do_write ();
+	check_busy ();
+	return;
+    }
+
     // try to write as much as possible immediatly
     if (_outbufs.size() == 0) {
-	_transp->write (*b, b->length());
+	count_out (_transp->write (*b, b->length()));
 	if (b->length() == 0) {
 	    delete b;
 	    return;
@@ -3193,6 +3526,7 @@ MICO::GIOPConn::output_handler (CORBA::Buffer *b)
 	    // to use select instead of busy-wait.
 	    while(b->length() != 0) {
 		CORBA::Long r = _transp->write (*b, b->length());
+		count_out (r);
 		if (r < 0) {
 		    // connection broken
 		    _transp->rselect (_disp, 0);
@@ -3262,10 +3596,17 @@ MICO::GIOPConn::flush ()
     CORBA::Boolean isblock = _transp->isblocking();
     _transp->block (TRUE);
     while (_outbufs.size() > 0) {
-	CORBA::Buffer *b = _outbufs.front();
+	if (write_outbufs () <= 0)
+	    break;
+    }
+    while (_outbufs.size() > 0) {
+	delete _outbufs.front();
 	_outbufs.pop_front();
-	_transp->write (*b, b->length());
-	delete b;
+    }
+    while (_outfrags.size() > 0) {
+	delete _outfrags.front().msg;
+	delete _outfrags.front().hdr;
+	_outfrags.pop_front();
     }
     _transp->block (isblock);
 }
@@ -3314,13 +3655,15 @@ MICO::GIOPConnCallback::send_orb_msg (GIOPConn *conn, ORBMsg::Event ev) {
 
 MICO::IIOPProxy::IIOPProxy (CORBA::ORB_ptr orb,
                             CORBA::UShort giop_ver,
-			    CORBA::ULong max_size)
+			    CORBA::ULong max_size,
+			    CORBA::ULong frag_size)
 {
     /*
      * these are the IOR profile types we can handle.
      */
     _valid_profiles.push_back (CORBA::IORProfile::TAG_INTERNET_IOP);
     _valid_profiles.push_back (CORBA::IORProfile::TAG_UNIX_IOP);
+    _valid_profiles.push_back (CORBA::IORProfile::TAG_SHM_IOP);
     _valid_profiles.push_back (CORBA::IORProfile::TAG_UDP_IOP);
     _valid_profiles.push_back (CORBA::IORProfile::TAG_SSL_INTERNET_IOP);
     _valid_profiles.push_back (CORBA::IORProfile::TAG_SSL_UNIX_IOP);
@@ -3334,9 +3677,12 @@ MICO::IIOPProxy::IIOPProxy (CORBA::ORB_ptr orb,
 #endif
 
     _max_message_size = max_size;
+    _frag_size = frag_size;
     _giop_ver = giop_ver;
     _orb->register_oa (this);
     _reroute = NULL;
+    _conns_per_endpoint = 1;
+    _last_reap = 0;
 }
 
 MICO::IIOPProxy::~IIOPProxy ()
@@ -3568,6 +3914,21 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 	    << "SL3TS: IIOPProxy::make_conn: " << addr->stringify() << endl;
     }
     MICO::GIOPConn *conn;
+    // used if no more connections can be opened
+    MICO::GIOPConn *fallback = 0;
+
+    CORBA::Boolean pooled = _conns_per_endpoint > 1;
+#ifdef USE_SL3
+    // connections with their own credentials are not shared
+    if ((tcpip_creds_id != NULL && *tcpip_creds_id)
+	|| (tls_creds_id != NULL && *tls_creds_id))
+	pooled = FALSE;
+#endif // USE_SL3
+    CORBA::ULong now = 0;
+    if (pooled) {
+	now = OSMisc::gettime().tv_sec;
+	reap_conns (now);
+    }
 
     MICOMT::AutoLock l(_conns);
     // kcg: we can receive version == 0 for other than IIOP and SSL transports
@@ -3575,7 +3936,16 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
       version = _giop_ver;
     }
 
-    MapAddrConn::iterator i = _conns[version].find (addr);
+    MapAddrConn::iterator i = _conns[version].end();
+    if (pooled) {
+	CORBA::Boolean grow;
+	fallback = pick_conn (version, addr, now, grow);
+	if (fallback && (!grow || !docreate))
+	    return fallback;
+    }
+    else {
+	i = _conns[version].find (addr);
+    }
     if (i != _conns[version].end()) {
 	assert(version == (*i).second->codec()->version());
 #if 1
@@ -3656,7 +4026,7 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 	    MICO::Logger::Stream (MICO::Logger::GIOP)
 		<< "connect: out of connections" << endl;
 	}
-	return 0;
+	return fallback;
     }
 #endif
 
@@ -3774,7 +4144,7 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 	    binded = TRUE;
 	}
 	if (!binded)
-	    return NULL;
+	    return fallback;
     }
 #endif // USE_SL3
     if (!t->connect (addr, timeout, timedout)) {
@@ -3788,7 +4158,9 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 #ifdef HAVE_THREADS
       _orb->resource_manager ().release_connection ();
 #endif
-      return 0;
+      if (fallback)
+	  timedout = FALSE;
+      return fallback;
     }
 #ifdef HAVE_THREADS
     CORBA::Boolean __use_reader_thread = TRUE;
@@ -3815,6 +4187,7 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
                                      version),
 		      0L /* no tmout */, _max_message_size);
 #endif
+    conn->fragment_size (_frag_size);
 #ifdef USE_SL3
     if (secman != NULL && secman->security_enabled()) {
 	CORBA::String_var tmp_id = creds->creds_id();
@@ -3851,7 +4224,8 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 	icimpl->notify_establish_context();
     }
 #endif // USE_SL3
-    _conns[version][t->peer()] = conn;
+    conn->last_used (now);
+    _conns[version].insert (MapAddrConn::value_type (t->peer(), conn));
 #ifdef HAVE_THREADS
     conn->start();
     if (conn->active_ref ())
@@ -3863,6 +4237,99 @@ MICO::IIOPProxy::make_conn (const CORBA::Address *addr,
 #endif // HAVE_THREADS
 }
 
+/*
+ * choose the connection to addr with the fewest outstanding requests.
+ * grow is set if another connection should be opened because all
+ * connections are busy and there are less than _conns_per_endpoint.
+ * _conns must be locked by the caller.
+ */
+MICO::GIOPConn *
+MICO::IIOPProxy::pick_conn (CORBA::UShort version,
+			    const CORBA::Address *addr,
+			    CORBA::ULong now,
+			    CORBA::Boolean &grow)
+{
+    GIOPConn *best;
+    CORBA::ULong live;
+
+    MapAddrConn &conns = _conns[version];
+    do {
+	best = 0;
+	live = 0;
+	MapAddrConn::iterator i = conns.lower_bound (addr);
+	MapAddrConn::iterator end = conns.upper_bound (addr);
+	for ( ; i != end; ++i) {
+	    GIOPConn *conn = (*i).second;
+#ifdef HAVE_THREADS
+	    if (conn->state() != MICOMT::StateRefCnt::Active)
+		continue;
+#endif // HAVE_THREADS
+	    ++live;
+	    if (!best || conn->pending() < best->pending())
+		best = conn;
+	}
+	// same workaround as in make_conn() above, check_events() may
+	// close the connection
+    } while (best && best->check_events());
+
+    grow = live < _conns_per_endpoint && (!best || best->pending() > 0);
+    if (best)
+	best->last_used (now);
+    return best;
+}
+
+/*
+ * close pooled connections that had no requests for a while. One
+ * connection per endpoint is always kept.
+ */
+void
+MICO::IIOPProxy::reap_conns (CORBA::ULong now)
+{
+    // seconds a pooled connection may be idle
+    const CORBA::ULong idle_time = 10;
+
+    if (now == _last_reap)
+	return;
+    _last_reap = now;
+
+    vector<GIOPConn *> idle;
+    {
+	MICOMT::AutoLock l(_conns);
+	for (MapVerAddrConn::iterator i = _conns.begin();
+	     i != _conns.end(); ++i) {
+	    MapAddrConn &conns = (*i).second;
+	    MapAddrConn::iterator j = conns.begin();
+	    while (j != conns.end()) {
+		MapAddrConn::iterator end = conns.upper_bound ((*j).first);
+		for (++j; j != end; ) {
+		    GIOPConn *conn = (*j).second;
+		    if (
+#ifdef HAVE_THREADS
+			conn->state() == MICOMT::StateRefCnt::Active &&
+#endif // HAVE_THREADS
+			conn->pending() == 0
+			&& now - conn->last_used() >= idle_time) {
+			idle.push_back (conn);
+			conns.erase (j++);
+		    }
+		    else {
+			++j;
+		    }
+		}
+	    }
+	}
+    }
+    for (mico_vec_size_type k = 0; k < idle.size(); ++k) {
+	if (MICO::Logger::IsLogged (MICO::Logger::IIOP)) {
+	    MICOMT::AutoDebugLock __lock;
+	    MICO::Logger::Stream (MICO::Logger::IIOP)
+		<< "IIOP: closing idle pooled conn to "
+		<< idle[k]->transport()->peer()->stringify() << endl;
+	}
+	close_conn (idle[k], FALSE);
+    }
+}
+
 MICO::GIOPConn *
 MICO::IIOPProxy::make_conn (CORBA::Object_ptr obj, CORBA::Boolean& timedout)
 {
@@ -4024,7 +4491,20 @@ MICO::IIOPProxy::make_conn (CORBA::Object_ptr obj, CORBA::Boolean& timedout)
 	      ||((!CORBA::is_nil(conn_own_creds))
 		 && conn_own_creds->creds_state() == SL3CM::CS_PendingRelease))
 #endif // USE_SL3
-	      return conn;
+	  {
+	      if (_conns_per_endpoint == 1)
+		  return conn;
+	      // choose among all connections to the same endpoint
+	      GIOPConn *pconn = make_conn (conn->transport()->peer(), 0,
+					   timedout, TRUE,
+					   conn->codec()->version()
+#ifdef USE_SL3
+					   , tcpip_creds_id, tls_creds_id
+#endif // USE_SL3
+					   );
+	      if (pconn)
+		  return pconn;
+	  }
       }
 
       /*
@@ -4245,6 +4725,17 @@ MICO::IIOPProxy::kill_conn (GIOPConn *conn, CORBA::Boolean redo)
     if (!found)
 	return;
 
+    close_conn (conn, redo);
+}
+
+/*
+ * shut down a connection that has already been removed from _conns
+ */
+void
+MICO::IIOPProxy::close_conn (GIOPConn *conn, CORBA::Boolean redo)
+{
+    CORBA::Boolean again;
+
     do {
 	again = FALSE;
 #ifdef HAVE_THREADS
@@ -4461,6 +4952,7 @@ MICO::IIOPProxy::invoke (CORBA::ORBMsgId id, CORBA::Object_ptr obj,
     }
 
     GIOPOutContext out (conn->codec(), conn->codec()->converter());
+    out.stream (conn);
     if (!conn->codec()->put_invoke_request (out, __id, response_exp,
 					    obj, req, pr)) {
         CORBA::MARSHAL ex;
@@ -5237,7 +5729,7 @@ IIOPServer_cleanup_idrec_map(void* value)
 #endif // HAVE_THREADS
 
 MICO::IIOPServer::IIOPServer (CORBA::ORB_ptr orb, CORBA::UShort iiop_ver,
-			      CORBA::ULong max_size)
+			      CORBA::ULong max_size, CORBA::ULong frag_size)
 #ifdef HAVE_THREADS
     : _orbids_mutex(FALSE, MICOMT::Mutex::Recursive)
 #endif // HAVE_THREADS
@@ -5259,6 +5751,7 @@ MICO::IIOPServer::IIOPServer (CORBA::ORB_ptr orb, CORBA::UShort iiop_ver,
 
     _iiop_ver = iiop_ver;
     _max_message_size = max_size;
+    _frag_size = frag_size;
 
     // we only register as an OA to be notified of shutdown...
     _orb->register_oa (this);
@@ -5827,7 +6320,8 @@ MICO::IIOPServer::conn_closed (GIOPConn *conn)
 }
 
 CORBA::Boolean
-MICO::IIOPServer::handle_input (GIOPConn *conn, CORBA::Buffer *inp)
+MICO::IIOPServer::handle_input (GIOPConn *conn, CORBA::Buffer *inp,
+				 CORBA::Boolean reject)
 {
     if (MICO::Logger::IsLogged (MICO::Logger::IIOP)) {
       MICOMT::AutoDebugLock __lock;
@@ -5859,7 +6353,7 @@ MICO::IIOPServer::handle_input (GIOPConn *conn, CORBA::Buffer *inp)
 
     switch (mt) {
     case GIOP::Request:
-      return handle_invoke_request (conn, in);
+      return handle_invoke_request (conn, in, reject);
 
     case GIOP::LocateRequest:
       return handle_locate_request (conn, in);
@@ -5947,7 +6441,8 @@ MICO::IIOPServer::exec_invoke_request (GIOPInContext &in,
 }
 
 CORBA::Boolean
-MICO::IIOPServer::handle_invoke_request (GIOPConn *conn, GIOPInContext &in)
+MICO::IIOPServer::handle_invoke_request (GIOPConn *conn, GIOPInContext &in,
+					 CORBA::Boolean reject)
 {
     CORBA::ULong req_id;
     CORBA::Boolean resp;
@@ -6000,6 +6495,38 @@ MICO::IIOPServer::handle_invoke_request (GIOPConn *conn, GIOPInContext &in)
 	<< " with msgid " << req_id << endl;
     }
 
+    if (reject) {
+	/*
+	 * the request queue is full, tell the client to try again
+	 * later without passing the request to the ORB
+	 */
+	if (MICO::Logger::IsLogged (MICO::Logger::GIOP)) {
+	  MICOMT::AutoDebugLock __lock;
+	  MICO::Logger::Stream (MICO::Logger::GIOP)
+	    << "GIOP: request queue full, sending TRANSIENT to "
+	    << conn->transport()->peer()->stringify()
+	    << " for msgid " << req_id << endl;
+	}
+	if (resp) {
+	    CORBA::TRANSIENT ex (1, CORBA::COMPLETED_NO);
+	    req->set_out_args (&ex);
+	    GIOPOutContext out (conn->codec());
+	    out.stream (conn);
+	    conn->codec()->put_invoke_reply (out, req_id,
+					     GIOP::SYSTEM_EXCEPTION,
+					     CORBA::Object::_nil(), req,
+					     GIOP::KeyAddr);
+	    conn->output (out._retn());
+	}
+	CORBA::release (req);
+	CORBA::release (obj);
+	CORBA::release (pr);
+#ifdef HAVE_THREADS
+	conn->active_deref();
+#endif // HAVE_THREADS
+	return TRUE;
+    }
+
     /*
      * code sets are set up in get_contextlist(). GIOPRequest will
      * set up converters for out args, so we dont need to do anything
@@ -6227,6 +6754,7 @@ MICO::IIOPServer::handle_invoke_reply (CORBA::ORBMsgId id)
     }
 
     GIOPOutContext out (rec->conn()->codec());
+    out.stream (rec->conn());
     if (!rec->conn()->codec()->put_invoke_reply (out, rec->reqid(), giop_stat,
 						 obj, req, ad)) {
 	out.reset ();
@@ -6568,6 +7096,14 @@ MICO::IIOPServer::input_callback (GIOPConn *conn, CORBA::Buffer *inp)
     return handle_input( conn, inp );
 }
 
+#ifdef HAVE_THREADS
+CORBA::Boolean
+MICO::IIOPServer::reject_callback (GIOPConn *conn, CORBA::Buffer *inp)
+{
+    return handle_input( conn, inp, TRUE );
+}
+#endif // HAVE_THREADS
+
 CORBA::Boolean
 MICO::IIOPServer::callback (GIOPConn *conn, GIOPConnCallback::Event ev)
 {
@@ -6684,6 +7220,7 @@ MICO::IIOPServer::callback (CORBA::TransportServer *tserv,
 					     _iiop_ver),
 			      0L /* no tmout */, _max_message_size);
 #endif
+	    conn->fragment_size (_frag_size);
 #ifdef USE_SL3
 	    CORBA::Object_var secobj = _orb->resolve_initial_references
 		("TransportSecurity::SecurityManager");
@@ -1398,9 +1398,11 @@ MICO::UIOPProfile::operator< (const CORBA::IORProfile &p) const
 /*************************** UIOPProfileDecoder *************************/
 
 
-MICO::UIOPProfileDecoder::UIOPProfileDecoder (CORBA::IORProfile::ProfileId id)
+MICO::UIOPProfileDecoder::UIOPProfileDecoder (CORBA::IORProfile::ProfileId id,
+					       UnixAddress::Family fam)
 {
     tagid = id;
+    family = fam;
     CORBA::IORProfile::register_decoder (this);
 }
 
@@ -1449,7 +1451,7 @@ MICO::UIOPProfileDecoder::decode (CORBA::DataDecoder &dc, ProfileId,
 	    check (comps.decode (dc));
 
 	ip = new UIOPProfile (objkey, len,
-			      UnixAddress (filename.c_str()),
+			      UnixAddress (filename.c_str(), family),
 			      comps,
 			      version,
 			      tagid, host.c_str());
@@ -1474,10 +1476,14 @@ bad:
 CORBA::Boolean
 MICO::UIOPProfileDecoder::has_id (MICO::UIOPProfile::ProfileId id) const
 {
-    return CORBA::IORProfile::TAG_UNIX_IOP == id;
+    return tagid == id;
 }
 
 static MICO::UIOPProfileDecoder uiop_ior_decoder;
+#ifdef HAVE_SHM_TRANSPORT
+static MICO::UIOPProfileDecoder shmiop_ior_decoder (
+    CORBA::IORProfile::TAG_SHM_IOP, MICO::UnixAddress::SHM);
+#endif
 #endif // HAVE_SYS_UN_H
 
 
@@ -322,7 +322,7 @@ char* CORBA::Contained_stub::id()
   CORBA::RepositoryId _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_id" );
+  CORBA::StaticRequest __req( this, "_get_id", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -372,7 +372,7 @@ CORBA::Contained_stub_clp::id()
 void CORBA::Contained_stub::id( const char* _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_id" );
+  CORBA::StaticRequest __req( this, "_set_id", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -421,7 +421,7 @@ char* CORBA::Contained_stub::name()
   CORBA::Identifier _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_name" );
+  CORBA::StaticRequest __req( this, "_get_name", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -471,7 +471,7 @@ CORBA::Contained_stub_clp::name()
 void CORBA::Contained_stub::name( const char* _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_name" );
+  CORBA::StaticRequest __req( this, "_set_name", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -520,7 +520,7 @@ char* CORBA::Contained_stub::version()
   CORBA::VersionSpec _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_version" );
+  CORBA::StaticRequest __req( this, "_get_version", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -570,7 +570,7 @@ CORBA::Contained_stub_clp::version()
 void CORBA::Contained_stub::version( const char* _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_version" );
+  CORBA::StaticRequest __req( this, "_set_version", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -619,7 +619,7 @@ CORBA::Container_ptr CORBA::Contained_stub::defined_in()
   CORBA::Container_ptr _res = CORBA::Container::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_Container, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_defined_in" );
+  CORBA::StaticRequest __req( this, "_get_defined_in", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -671,7 +671,7 @@ char* CORBA::Contained_stub::absolute_name()
   CORBA::ScopedName _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_absolute_name" );
+  CORBA::StaticRequest __req( this, "_get_absolute_name", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -723,7 +723,7 @@ CORBA::Repository_ptr CORBA::Contained_stub::containing_repository()
   CORBA::Repository_ptr _res = CORBA::Repository::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_Repository, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_containing_repository" );
+  CORBA::StaticRequest __req( this, "_get_containing_repository", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -774,7 +774,7 @@ CORBA::Contained::Description* CORBA::Contained_stub::describe()
 {
   CORBA::StaticAny __res( _marshaller_CORBA_Contained_Description );
 
-  CORBA::StaticRequest __req( this, "describe" );
+  CORBA::StaticRequest __req( this, "describe", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -826,7 +826,7 @@ void CORBA::Contained_stub::move( CORBA::Container_ptr _par_new_container, const
   CORBA::StaticAny _sa_new_container( _marshaller_CORBA_Container, &_par_new_container );
   CORBA::StaticAny _sa_new_name( CORBA::_stc_string, &_par_new_name );
   CORBA::StaticAny _sa_new_version( CORBA::_stc_string, &_par_new_version );
-  CORBA::StaticRequest __req( this, "move" );
+  CORBA::StaticRequest __req( this, "move", TRUE );
   __req.add_in_arg( &_sa_new_container );
   __req.add_in_arg( &_sa_new_name );
   __req.add_in_arg( &_sa_new_version );
@@ -1214,7 +1214,7 @@ CORBA::Contained_ptr CORBA::Container_stub::lookup( const char* _par_search_name
   CORBA::Contained_ptr _res = CORBA::Contained::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_Contained, &_res );
 
-  CORBA::StaticRequest __req( this, "lookup" );
+  CORBA::StaticRequest __req( this, "lookup", TRUE );
   __req.add_in_arg( &_sa_search_name );
   __req.set_result( &__res );
 
@@ -1268,7 +1268,7 @@ CORBA::ContainedSeq* CORBA::Container_stub::contents( CORBA::DefinitionKind _par
   CORBA::StaticAny _sa_exclude_inherited( CORBA::_stc_boolean, &_par_exclude_inherited );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_Contained );
 
-  CORBA::StaticRequest __req( this, "contents" );
+  CORBA::StaticRequest __req( this, "contents", TRUE );
   __req.add_in_arg( &_sa_limit_type );
   __req.add_in_arg( &_sa_exclude_inherited );
   __req.set_result( &__res );
@@ -1325,7 +1325,7 @@ CORBA::ContainedSeq* CORBA::Container_stub::lookup_name( const char* _par_search
   CORBA::StaticAny _sa_exclude_inherited( CORBA::_stc_boolean, &_par_exclude_inherited );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_Contained );
 
-  CORBA::StaticRequest __req( this, "lookup_name" );
+  CORBA::StaticRequest __req( this, "lookup_name", TRUE );
   __req.add_in_arg( &_sa_search_name );
   __req.add_in_arg( &_sa_levels_to_search );
   __req.add_in_arg( &_sa_limit_type );
@@ -1383,7 +1383,7 @@ CORBA::Container::DescriptionSeq* CORBA::Container_stub::describe_contents( CORB
   CORBA::StaticAny _sa_max_returned_objs( CORBA::_stc_long, &_par_max_returned_objs );
   CORBA::StaticAny __res( _marshaller__seq_CORBA_Container_Description );
 
-  CORBA::StaticRequest __req( this, "describe_contents" );
+  CORBA::StaticRequest __req( this, "describe_contents", TRUE );
   __req.add_in_arg( &_sa_limit_type );
   __req.add_in_arg( &_sa_exclude_inherited );
   __req.add_in_arg( &_sa_max_returned_objs );
@@ -1441,7 +1441,7 @@ CORBA::ModuleDef_ptr CORBA::Container_stub::create_module( const char* _par_id,
   CORBA::ModuleDef_ptr _res = CORBA::ModuleDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ModuleDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_module" );
+  CORBA::StaticRequest __req( this, "create_module", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1501,7 +1501,7 @@ CORBA::ConstantDef_ptr CORBA::Container_stub::create_constant( const char* _par_
   CORBA::ConstantDef_ptr _res = CORBA::ConstantDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ConstantDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_constant" );
+  CORBA::StaticRequest __req( this, "create_constant", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1562,7 +1562,7 @@ CORBA::StructDef_ptr CORBA::Container_stub::create_struct( const char* _par_id,
   CORBA::StructDef_ptr _res = CORBA::StructDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_StructDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_struct" );
+  CORBA::StaticRequest __req( this, "create_struct", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1622,7 +1622,7 @@ CORBA::ExceptionDef_ptr CORBA::Container_stub::create_exception( const char* _pa
   CORBA::ExceptionDef_ptr _res = CORBA::ExceptionDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ExceptionDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_exception" );
+  CORBA::StaticRequest __req( this, "create_exception", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1683,7 +1683,7 @@ CORBA::UnionDef_ptr CORBA::Container_stub::create_union( const char* _par_id, co
   CORBA::UnionDef_ptr _res = CORBA::UnionDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_UnionDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_union" );
+  CORBA::StaticRequest __req( this, "create_union", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1744,7 +1744,7 @@ CORBA::EnumDef_ptr CORBA::Container_stub::create_enum( const char* _par_id, cons
   CORBA::EnumDef_ptr _res = CORBA::EnumDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_EnumDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_enum" );
+  CORBA::StaticRequest __req( this, "create_enum", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1804,7 +1804,7 @@ CORBA::AliasDef_ptr CORBA::Container_stub::create_alias( const char* _par_id, co
   CORBA::AliasDef_ptr _res = CORBA::AliasDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_AliasDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_alias" );
+  CORBA::StaticRequest __req( this, "create_alias", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1864,7 +1864,7 @@ CORBA::InterfaceDef_ptr CORBA::Container_stub::create_interface( const char* _pa
   CORBA::InterfaceDef_ptr _res = CORBA::InterfaceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_InterfaceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_interface" );
+  CORBA::StaticRequest __req( this, "create_interface", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1924,7 +1924,7 @@ CORBA::AbstractInterfaceDef_ptr CORBA::Container_stub::create_abstract_interface
   CORBA::AbstractInterfaceDef_ptr _res = CORBA::AbstractInterfaceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_AbstractInterfaceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_abstract_interface" );
+  CORBA::StaticRequest __req( this, "create_abstract_interface", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -1984,7 +1984,7 @@ CORBA::LocalInterfaceDef_ptr CORBA::Container_stub::create_local_interface( cons
   CORBA::LocalInterfaceDef_ptr _res = CORBA::LocalInterfaceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_LocalInterfaceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_local_interface" );
+  CORBA::StaticRequest __req( this, "create_local_interface", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2050,7 +2050,7 @@ CORBA::ValueDef_ptr CORBA::Container_stub::create_value( const char* _par_id, co
   CORBA::ValueDef_ptr _res = CORBA::ValueDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ValueDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_value" );
+  CORBA::StaticRequest __req( this, "create_value", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2122,7 +2122,7 @@ CORBA::ExtValueDef_ptr CORBA::Container_stub::create_ext_value( const char* _par
   CORBA::ExtValueDef_ptr _res = CORBA::ExtValueDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ExtValueDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_ext_value" );
+  CORBA::StaticRequest __req( this, "create_ext_value", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2188,7 +2188,7 @@ CORBA::ValueBoxDef_ptr CORBA::Container_stub::create_value_box( const char* _par
   CORBA::ValueBoxDef_ptr _res = CORBA::ValueBoxDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ValueBoxDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_value_box" );
+  CORBA::StaticRequest __req( this, "create_value_box", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2247,7 +2247,7 @@ CORBA::NativeDef_ptr CORBA::Container_stub::create_native( const char* _par_id,
   CORBA::NativeDef_ptr _res = CORBA::NativeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_NativeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_native" );
+  CORBA::StaticRequest __req( this, "create_native", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -2562,7 +2562,7 @@ CORBA::Contained_ptr CORBA::Repository_stub::lookup_id( const char* _par_search_
   CORBA::Contained_ptr _res = CORBA::Contained::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_Contained, &_res );
 
-  CORBA::StaticRequest __req( this, "lookup_id" );
+  CORBA::StaticRequest __req( this, "lookup_id", TRUE );
   __req.add_in_arg( &_sa_search_id );
   __req.set_result( &__res );
 
@@ -2616,7 +2616,7 @@ CORBA::PrimitiveDef_ptr CORBA::Repository_stub::get_primitive( CORBA::PrimitiveK
   CORBA::PrimitiveDef_ptr _res = CORBA::PrimitiveDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_PrimitiveDef, &_res );
 
-  CORBA::StaticRequest __req( this, "get_primitive" );
+  CORBA::StaticRequest __req( this, "get_primitive", TRUE );
   __req.add_in_arg( &_sa_kind );
   __req.set_result( &__res );
 
@@ -2670,7 +2670,7 @@ CORBA::StringDef_ptr CORBA::Repository_stub::create_string( CORBA::ULong _par_bo
   CORBA::StringDef_ptr _res = CORBA::StringDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_StringDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_string" );
+  CORBA::StaticRequest __req( this, "create_string", TRUE );
   __req.add_in_arg( &_sa_bound );
   __req.set_result( &__res );
 
@@ -2724,7 +2724,7 @@ CORBA::WstringDef_ptr CORBA::Repository_stub::create_wstring( CORBA::ULong _par_
   CORBA::WstringDef_ptr _res = CORBA::WstringDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_WstringDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_wstring" );
+  CORBA::StaticRequest __req( this, "create_wstring", TRUE );
   __req.add_in_arg( &_sa_bound );
   __req.set_result( &__res );
 
@@ -2779,7 +2779,7 @@ CORBA::SequenceDef_ptr CORBA::Repository_stub::create_sequence( CORBA::ULong _pa
   CORBA::SequenceDef_ptr _res = CORBA::SequenceDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_SequenceDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_sequence" );
+  CORBA::StaticRequest __req( this, "create_sequence", TRUE );
   __req.add_in_arg( &_sa_bound );
   __req.add_in_arg( &_sa_element_type );
   __req.set_result( &__res );
@@ -2835,7 +2835,7 @@ CORBA::ArrayDef_ptr CORBA::Repository_stub::create_array( CORBA::ULong _par_leng
   CORBA::ArrayDef_ptr _res = CORBA::ArrayDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ArrayDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_array" );
+  CORBA::StaticRequest __req( this, "create_array", TRUE );
   __req.add_in_arg( &_sa_length );
   __req.add_in_arg( &_sa_element_type );
   __req.set_result( &__res );
@@ -2891,7 +2891,7 @@ CORBA::FixedDef_ptr CORBA::Repository_stub::create_fixed( CORBA::UShort _par_dig
   CORBA::FixedDef_ptr _res = CORBA::FixedDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_FixedDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_fixed" );
+  CORBA::StaticRequest __req( this, "create_fixed", TRUE );
   __req.add_in_arg( &_sa_digits );
   __req.add_in_arg( &_sa_scale );
   __req.set_result( &__res );
@@ -3332,7 +3332,7 @@ CORBA::TypeCode_ptr CORBA::ConstantDef_stub::type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type" );
+  CORBA::StaticRequest __req( this, "_get_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3384,7 +3384,7 @@ CORBA::IDLType_ptr CORBA::ConstantDef_stub::type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type_def" );
+  CORBA::StaticRequest __req( this, "_get_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3434,7 +3434,7 @@ CORBA::ConstantDef_stub_clp::type_def()
 void CORBA::ConstantDef_stub::type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_type_def" );
+  CORBA::StaticRequest __req( this, "_set_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3482,7 +3482,7 @@ CORBA::Any* CORBA::ConstantDef_stub::value()
 {
   CORBA::StaticAny __res( CORBA::_stc_any );
 
-  CORBA::StaticRequest __req( this, "_get_value" );
+  CORBA::StaticRequest __req( this, "_get_value", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -3532,7 +3532,7 @@ CORBA::ConstantDef_stub_clp::value()
 void CORBA::ConstantDef_stub::value( const CORBA::Any& _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_any, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_value" );
+  CORBA::StaticRequest __req( this, "_set_value", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -3976,7 +3976,7 @@ CORBA::StructMemberSeq* CORBA::StructDef_stub::members()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_StructMember );
 
-  CORBA::StaticRequest __req( this, "_get_members" );
+  CORBA::StaticRequest __req( this, "_get_members", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4026,7 +4026,7 @@ CORBA::StructDef_stub_clp::members()
 void CORBA::StructDef_stub::members( const CORBA::StructMemberSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_StructMember, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_members" );
+  CORBA::StaticRequest __req( this, "_set_members", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -4273,7 +4273,7 @@ CORBA::TypeCode_ptr CORBA::ExceptionDef_stub::type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type" );
+  CORBA::StaticRequest __req( this, "_get_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4324,7 +4324,7 @@ CORBA::StructMemberSeq* CORBA::ExceptionDef_stub::members()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_StructMember );
 
-  CORBA::StaticRequest __req( this, "_get_members" );
+  CORBA::StaticRequest __req( this, "_get_members", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4374,7 +4374,7 @@ CORBA::ExceptionDef_stub_clp::members()
 void CORBA::ExceptionDef_stub::members( const CORBA::StructMemberSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_StructMember, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_members" );
+  CORBA::StaticRequest __req( this, "_set_members", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -4621,7 +4621,7 @@ CORBA::TypeCode_ptr CORBA::UnionDef_stub::discriminator_type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_discriminator_type" );
+  CORBA::StaticRequest __req( this, "_get_discriminator_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4673,7 +4673,7 @@ CORBA::IDLType_ptr CORBA::UnionDef_stub::discriminator_type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_discriminator_type_def" );
+  CORBA::StaticRequest __req( this, "_get_discriminator_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4723,7 +4723,7 @@ CORBA::UnionDef_stub_clp::discriminator_type_def()
 void CORBA::UnionDef_stub::discriminator_type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_discriminator_type_def" );
+  CORBA::StaticRequest __req( this, "_set_discriminator_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -4771,7 +4771,7 @@ CORBA::UnionMemberSeq* CORBA::UnionDef_stub::members()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_UnionMember );
 
-  CORBA::StaticRequest __req( this, "_get_members" );
+  CORBA::StaticRequest __req( this, "_get_members", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -4821,7 +4821,7 @@ CORBA::UnionDef_stub_clp::members()
 void CORBA::UnionDef_stub::members( const CORBA::UnionMemberSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_UnionMember, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_members" );
+  CORBA::StaticRequest __req( this, "_set_members", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -5058,7 +5058,7 @@ CORBA::EnumMemberSeq* CORBA::EnumDef_stub::members()
 {
   CORBA::StaticAny __res( CORBA::_stcseq_string );
 
-  CORBA::StaticRequest __req( this, "_get_members" );
+  CORBA::StaticRequest __req( this, "_get_members", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5108,7 +5108,7 @@ CORBA::EnumDef_stub_clp::members()
 void CORBA::EnumDef_stub::members( const CORBA::EnumMemberSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stcseq_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_members" );
+  CORBA::StaticRequest __req( this, "_set_members", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -5346,7 +5346,7 @@ CORBA::IDLType_ptr CORBA::AliasDef_stub::original_type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_original_type_def" );
+  CORBA::StaticRequest __req( this, "_get_original_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -5396,7 +5396,7 @@ CORBA::AliasDef_stub_clp::original_type_def()
 void CORBA::AliasDef_stub::original_type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_original_type_def" );
+  CORBA::StaticRequest __req( this, "_set_original_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -5958,7 +5958,7 @@ CORBA::InterfaceDefSeq* CORBA::InterfaceDef_stub::base_interfaces()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_InterfaceDef );
 
-  CORBA::StaticRequest __req( this, "_get_base_interfaces" );
+  CORBA::StaticRequest __req( this, "_get_base_interfaces", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -6008,7 +6008,7 @@ CORBA::InterfaceDef_stub_clp::base_interfaces()
 void CORBA::InterfaceDef_stub::base_interfaces( const CORBA::InterfaceDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_base_interfaces" );
+  CORBA::StaticRequest __req( this, "_set_base_interfaces", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -6058,7 +6058,7 @@ CORBA::Boolean CORBA::InterfaceDef_stub::is_a( const char* _par_interface_id )
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "is_a" );
+  CORBA::StaticRequest __req( this, "is_a", TRUE );
   __req.add_in_arg( &_sa_interface_id );
   __req.set_result( &__res );
 
@@ -6110,7 +6110,7 @@ CORBA::InterfaceDef::FullInterfaceDescription* CORBA::InterfaceDef_stub::describ
 {
   CORBA::StaticAny __res( _marshaller_CORBA_InterfaceDef_FullInterfaceDescription );
 
-  CORBA::StaticRequest __req( this, "describe_interface" );
+  CORBA::StaticRequest __req( this, "describe_interface", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -6167,7 +6167,7 @@ CORBA::AttributeDef_ptr CORBA::InterfaceDef_stub::create_attribute( const char*
   CORBA::AttributeDef_ptr _res = CORBA::AttributeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_AttributeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_attribute" );
+  CORBA::StaticRequest __req( this, "create_attribute", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -6232,7 +6232,7 @@ CORBA::OperationDef_ptr CORBA::InterfaceDef_stub::create_operation( const char*
   CORBA::OperationDef_ptr _res = CORBA::OperationDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_OperationDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_operation" );
+  CORBA::StaticRequest __req( this, "create_operation", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -7036,7 +7036,7 @@ CORBA::InterfaceDefSeq* CORBA::ValueDef_stub::supported_interfaces()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_InterfaceDef );
 
-  CORBA::StaticRequest __req( this, "_get_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_get_supported_interfaces", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7086,7 +7086,7 @@ CORBA::ValueDef_stub_clp::supported_interfaces()
 void CORBA::ValueDef_stub::supported_interfaces( const CORBA::InterfaceDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_InterfaceDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_supported_interfaces" );
+  CORBA::StaticRequest __req( this, "_set_supported_interfaces", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7134,7 +7134,7 @@ CORBA::InitializerSeq* CORBA::ValueDef_stub::initializers()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_Initializer );
 
-  CORBA::StaticRequest __req( this, "_get_initializers" );
+  CORBA::StaticRequest __req( this, "_get_initializers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7184,7 +7184,7 @@ CORBA::ValueDef_stub_clp::initializers()
 void CORBA::ValueDef_stub::initializers( const CORBA::InitializerSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_Initializer, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_initializers" );
+  CORBA::StaticRequest __req( this, "_set_initializers", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7233,7 +7233,7 @@ CORBA::ValueDef_ptr CORBA::ValueDef_stub::base_value()
   CORBA::ValueDef_ptr _res = CORBA::ValueDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ValueDef, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_base_value" );
+  CORBA::StaticRequest __req( this, "_get_base_value", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7283,7 +7283,7 @@ CORBA::ValueDef_stub_clp::base_value()
 void CORBA::ValueDef_stub::base_value( CORBA::ValueDef_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_ValueDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_base_value" );
+  CORBA::StaticRequest __req( this, "_set_base_value", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7331,7 +7331,7 @@ CORBA::ValueDefSeq* CORBA::ValueDef_stub::abstract_base_values()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ValueDef );
 
-  CORBA::StaticRequest __req( this, "_get_abstract_base_values" );
+  CORBA::StaticRequest __req( this, "_get_abstract_base_values", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7381,7 +7381,7 @@ CORBA::ValueDef_stub_clp::abstract_base_values()
 void CORBA::ValueDef_stub::abstract_base_values( const CORBA::ValueDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ValueDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_abstract_base_values" );
+  CORBA::StaticRequest __req( this, "_set_abstract_base_values", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7430,7 +7430,7 @@ CORBA::Boolean CORBA::ValueDef_stub::is_abstract()
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_is_abstract" );
+  CORBA::StaticRequest __req( this, "_get_is_abstract", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7480,7 +7480,7 @@ CORBA::ValueDef_stub_clp::is_abstract()
 void CORBA::ValueDef_stub::is_abstract( CORBA::Boolean _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_boolean, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_is_abstract" );
+  CORBA::StaticRequest __req( this, "_set_is_abstract", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7529,7 +7529,7 @@ CORBA::Boolean CORBA::ValueDef_stub::is_custom()
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_is_custom" );
+  CORBA::StaticRequest __req( this, "_get_is_custom", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7579,7 +7579,7 @@ CORBA::ValueDef_stub_clp::is_custom()
 void CORBA::ValueDef_stub::is_custom( CORBA::Boolean _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_boolean, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_is_custom" );
+  CORBA::StaticRequest __req( this, "_set_is_custom", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7628,7 +7628,7 @@ CORBA::Boolean CORBA::ValueDef_stub::is_truncatable()
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_is_truncatable" );
+  CORBA::StaticRequest __req( this, "_get_is_truncatable", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7678,7 +7678,7 @@ CORBA::ValueDef_stub_clp::is_truncatable()
 void CORBA::ValueDef_stub::is_truncatable( CORBA::Boolean _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_boolean, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_is_truncatable" );
+  CORBA::StaticRequest __req( this, "_set_is_truncatable", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -7728,7 +7728,7 @@ CORBA::Boolean CORBA::ValueDef_stub::is_a( const char* _par_value_id )
   CORBA::Boolean _res;
   CORBA::StaticAny __res( CORBA::_stc_boolean, &_res );
 
-  CORBA::StaticRequest __req( this, "is_a" );
+  CORBA::StaticRequest __req( this, "is_a", TRUE );
   __req.add_in_arg( &_sa_value_id );
   __req.set_result( &__res );
 
@@ -7780,7 +7780,7 @@ CORBA::ValueDef::FullValueDescription* CORBA::ValueDef_stub::describe_value()
 {
   CORBA::StaticAny __res( _marshaller_CORBA_ValueDef_FullValueDescription );
 
-  CORBA::StaticRequest __req( this, "describe_value" );
+  CORBA::StaticRequest __req( this, "describe_value", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -7837,7 +7837,7 @@ CORBA::ValueMemberDef_ptr CORBA::ValueDef_stub::create_value_member( const char*
   CORBA::ValueMemberDef_ptr _res = CORBA::ValueMemberDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ValueMemberDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_value_member" );
+  CORBA::StaticRequest __req( this, "create_value_member", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -7899,7 +7899,7 @@ CORBA::AttributeDef_ptr CORBA::ValueDef_stub::create_attribute( const char* _par
   CORBA::AttributeDef_ptr _res = CORBA::AttributeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_AttributeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_attribute" );
+  CORBA::StaticRequest __req( this, "create_attribute", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -7964,7 +7964,7 @@ CORBA::OperationDef_ptr CORBA::ValueDef_stub::create_operation( const char* _par
   CORBA::OperationDef_ptr _res = CORBA::OperationDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_OperationDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_operation" );
+  CORBA::StaticRequest __req( this, "create_operation", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -8213,7 +8213,7 @@ CORBA::IDLType_ptr CORBA::ValueBoxDef_stub::original_type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_original_type_def" );
+  CORBA::StaticRequest __req( this, "_get_original_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -8263,7 +8263,7 @@ CORBA::ValueBoxDef_stub_clp::original_type_def()
 void CORBA::ValueBoxDef_stub::original_type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_original_type_def" );
+  CORBA::StaticRequest __req( this, "_set_original_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -8854,7 +8854,7 @@ CORBA::ExtInitializerSeq* CORBA::ExtValueDef_stub::ext_initializers()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ExtInitializer );
 
-  CORBA::StaticRequest __req( this, "_get_ext_initializers" );
+  CORBA::StaticRequest __req( this, "_get_ext_initializers", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -8904,7 +8904,7 @@ CORBA::ExtValueDef_stub_clp::ext_initializers()
 void CORBA::ExtValueDef_stub::ext_initializers( const CORBA::ExtInitializerSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ExtInitializer, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_ext_initializers" );
+  CORBA::StaticRequest __req( this, "_set_ext_initializers", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -8952,7 +8952,7 @@ CORBA::ExtValueDef::ExtFullValueDescription* CORBA::ExtValueDef_stub::describe_e
 {
   CORBA::StaticAny __res( _marshaller_CORBA_ExtValueDef_ExtFullValueDescription );
 
-  CORBA::StaticRequest __req( this, "describe_ext_value" );
+  CORBA::StaticRequest __req( this, "describe_ext_value", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -9011,7 +9011,7 @@ CORBA::ExtAttributeDef_ptr CORBA::ExtValueDef_stub::create_ext_attribute( const
   CORBA::ExtAttributeDef_ptr _res = CORBA::ExtAttributeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ExtAttributeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_ext_attribute" );
+  CORBA::StaticRequest __req( this, "create_ext_attribute", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -9613,7 +9613,7 @@ CORBA::PrimitiveKind CORBA::PrimitiveDef_stub::kind()
   CORBA::PrimitiveKind _res;
   CORBA::StaticAny __res( _marshaller_CORBA_PrimitiveKind, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_kind" );
+  CORBA::StaticRequest __req( this, "_get_kind", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -9854,7 +9854,7 @@ CORBA::ULong CORBA::StringDef_stub::bound()
   CORBA::ULong _res;
   CORBA::StaticAny __res( CORBA::_stc_ulong, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_bound" );
+  CORBA::StaticRequest __req( this, "_get_bound", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -9904,7 +9904,7 @@ CORBA::StringDef_stub_clp::bound()
 void CORBA::StringDef_stub::bound( CORBA::ULong _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_ulong, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_bound" );
+  CORBA::StaticRequest __req( this, "_set_bound", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -10142,7 +10142,7 @@ CORBA::ULong CORBA::WstringDef_stub::bound()
   CORBA::ULong _res;
   CORBA::StaticAny __res( CORBA::_stc_ulong, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_bound" );
+  CORBA::StaticRequest __req( this, "_get_bound", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10192,7 +10192,7 @@ CORBA::WstringDef_stub_clp::bound()
 void CORBA::WstringDef_stub::bound( CORBA::ULong _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_ulong, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_bound" );
+  CORBA::StaticRequest __req( this, "_set_bound", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -10430,7 +10430,7 @@ CORBA::ULong CORBA::SequenceDef_stub::bound()
   CORBA::ULong _res;
   CORBA::StaticAny __res( CORBA::_stc_ulong, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_bound" );
+  CORBA::StaticRequest __req( this, "_get_bound", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10480,7 +10480,7 @@ CORBA::SequenceDef_stub_clp::bound()
 void CORBA::SequenceDef_stub::bound( CORBA::ULong _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_ulong, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_bound" );
+  CORBA::StaticRequest __req( this, "_set_bound", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -10529,7 +10529,7 @@ CORBA::TypeCode_ptr CORBA::SequenceDef_stub::element_type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_element_type" );
+  CORBA::StaticRequest __req( this, "_get_element_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10581,7 +10581,7 @@ CORBA::IDLType_ptr CORBA::SequenceDef_stub::element_type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_element_type_def" );
+  CORBA::StaticRequest __req( this, "_get_element_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10631,7 +10631,7 @@ CORBA::SequenceDef_stub_clp::element_type_def()
 void CORBA::SequenceDef_stub::element_type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_element_type_def" );
+  CORBA::StaticRequest __req( this, "_set_element_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -10869,7 +10869,7 @@ CORBA::ULong CORBA::ArrayDef_stub::length()
   CORBA::ULong _res;
   CORBA::StaticAny __res( CORBA::_stc_ulong, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_length" );
+  CORBA::StaticRequest __req( this, "_get_length", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -10919,7 +10919,7 @@ CORBA::ArrayDef_stub_clp::length()
 void CORBA::ArrayDef_stub::length( CORBA::ULong _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_ulong, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_length" );
+  CORBA::StaticRequest __req( this, "_set_length", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -10968,7 +10968,7 @@ CORBA::TypeCode_ptr CORBA::ArrayDef_stub::element_type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_element_type" );
+  CORBA::StaticRequest __req( this, "_get_element_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -11020,7 +11020,7 @@ CORBA::IDLType_ptr CORBA::ArrayDef_stub::element_type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_element_type_def" );
+  CORBA::StaticRequest __req( this, "_get_element_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -11070,7 +11070,7 @@ CORBA::ArrayDef_stub_clp::element_type_def()
 void CORBA::ArrayDef_stub::element_type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_element_type_def" );
+  CORBA::StaticRequest __req( this, "_set_element_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -11308,7 +11308,7 @@ CORBA::UShort CORBA::FixedDef_stub::digits()
   CORBA::UShort _res;
   CORBA::StaticAny __res( CORBA::_stc_ushort, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_digits" );
+  CORBA::StaticRequest __req( this, "_get_digits", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -11358,7 +11358,7 @@ CORBA::FixedDef_stub_clp::digits()
 void CORBA::FixedDef_stub::digits( CORBA::UShort _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_ushort, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_digits" );
+  CORBA::StaticRequest __req( this, "_set_digits", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -11407,7 +11407,7 @@ CORBA::Short CORBA::FixedDef_stub::scale()
   CORBA::Short _res;
   CORBA::StaticAny __res( CORBA::_stc_short, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_scale" );
+  CORBA::StaticRequest __req( this, "_get_scale", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -11457,7 +11457,7 @@ CORBA::FixedDef_stub_clp::scale()
 void CORBA::FixedDef_stub::scale( CORBA::Short _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_short, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_scale" );
+  CORBA::StaticRequest __req( this, "_set_scale", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -12055,7 +12055,7 @@ CORBA::TypeCode_ptr CORBA::AttributeDef_stub::type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type" );
+  CORBA::StaticRequest __req( this, "_get_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12107,7 +12107,7 @@ CORBA::IDLType_ptr CORBA::AttributeDef_stub::type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type_def" );
+  CORBA::StaticRequest __req( this, "_get_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12157,7 +12157,7 @@ CORBA::AttributeDef_stub_clp::type_def()
 void CORBA::AttributeDef_stub::type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_type_def" );
+  CORBA::StaticRequest __req( this, "_set_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -12206,7 +12206,7 @@ CORBA::AttributeMode CORBA::AttributeDef_stub::mode()
   CORBA::AttributeMode _res;
   CORBA::StaticAny __res( _marshaller_CORBA_AttributeMode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_mode" );
+  CORBA::StaticRequest __req( this, "_get_mode", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12256,7 +12256,7 @@ CORBA::AttributeDef_stub_clp::mode()
 void CORBA::AttributeDef_stub::mode( CORBA::AttributeMode _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_AttributeMode, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_mode" );
+  CORBA::StaticRequest __req( this, "_set_mode", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -12749,7 +12749,7 @@ CORBA::ExceptionDefSeq* CORBA::ExtAttributeDef_stub::get_exceptions()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ExceptionDef );
 
-  CORBA::StaticRequest __req( this, "_get_get_exceptions" );
+  CORBA::StaticRequest __req( this, "_get_get_exceptions", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12799,7 +12799,7 @@ CORBA::ExtAttributeDef_stub_clp::get_exceptions()
 void CORBA::ExtAttributeDef_stub::get_exceptions( const CORBA::ExceptionDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ExceptionDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_get_exceptions" );
+  CORBA::StaticRequest __req( this, "_set_get_exceptions", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -12847,7 +12847,7 @@ CORBA::ExceptionDefSeq* CORBA::ExtAttributeDef_stub::set_exceptions()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ExceptionDef );
 
-  CORBA::StaticRequest __req( this, "_get_set_exceptions" );
+  CORBA::StaticRequest __req( this, "_get_set_exceptions", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -12897,7 +12897,7 @@ CORBA::ExtAttributeDef_stub_clp::set_exceptions()
 void CORBA::ExtAttributeDef_stub::set_exceptions( const CORBA::ExceptionDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ExceptionDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_set_exceptions" );
+  CORBA::StaticRequest __req( this, "_set_set_exceptions", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -12945,7 +12945,7 @@ CORBA::ExtAttributeDescription* CORBA::ExtAttributeDef_stub::describe_attribute(
 {
   CORBA::StaticAny __res( _marshaller_CORBA_ExtAttributeDescription );
 
-  CORBA::StaticRequest __req( this, "describe_attribute" );
+  CORBA::StaticRequest __req( this, "describe_attribute", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13372,7 +13372,7 @@ CORBA::TypeCode_ptr CORBA::OperationDef_stub::result()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_result" );
+  CORBA::StaticRequest __req( this, "_get_result", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13424,7 +13424,7 @@ CORBA::IDLType_ptr CORBA::OperationDef_stub::result_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_result_def" );
+  CORBA::StaticRequest __req( this, "_get_result_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13474,7 +13474,7 @@ CORBA::OperationDef_stub_clp::result_def()
 void CORBA::OperationDef_stub::result_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_result_def" );
+  CORBA::StaticRequest __req( this, "_set_result_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -13522,7 +13522,7 @@ CORBA::ParDescriptionSeq* CORBA::OperationDef_stub::params()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ParameterDescription );
 
-  CORBA::StaticRequest __req( this, "_get_params" );
+  CORBA::StaticRequest __req( this, "_get_params", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13572,7 +13572,7 @@ CORBA::OperationDef_stub_clp::params()
 void CORBA::OperationDef_stub::params( const CORBA::ParDescriptionSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ParameterDescription, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_params" );
+  CORBA::StaticRequest __req( this, "_set_params", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -13621,7 +13621,7 @@ CORBA::OperationMode CORBA::OperationDef_stub::mode()
   CORBA::OperationMode _res;
   CORBA::StaticAny __res( _marshaller_CORBA_OperationMode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_mode" );
+  CORBA::StaticRequest __req( this, "_get_mode", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13671,7 +13671,7 @@ CORBA::OperationDef_stub_clp::mode()
 void CORBA::OperationDef_stub::mode( CORBA::OperationMode _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_OperationMode, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_mode" );
+  CORBA::StaticRequest __req( this, "_set_mode", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -13719,7 +13719,7 @@ CORBA::ContextIdSeq* CORBA::OperationDef_stub::contexts()
 {
   CORBA::StaticAny __res( CORBA::_stcseq_string );
 
-  CORBA::StaticRequest __req( this, "_get_contexts" );
+  CORBA::StaticRequest __req( this, "_get_contexts", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13769,7 +13769,7 @@ CORBA::OperationDef_stub_clp::contexts()
 void CORBA::OperationDef_stub::contexts( const CORBA::ContextIdSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stcseq_string, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_contexts" );
+  CORBA::StaticRequest __req( this, "_set_contexts", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -13817,7 +13817,7 @@ CORBA::ExceptionDefSeq* CORBA::OperationDef_stub::exceptions()
 {
   CORBA::StaticAny __res( _marshaller__seq_CORBA_ExceptionDef );
 
-  CORBA::StaticRequest __req( this, "_get_exceptions" );
+  CORBA::StaticRequest __req( this, "_get_exceptions", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -13867,7 +13867,7 @@ CORBA::OperationDef_stub_clp::exceptions()
 void CORBA::OperationDef_stub::exceptions( const CORBA::ExceptionDefSeq& _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller__seq_CORBA_ExceptionDef, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_exceptions" );
+  CORBA::StaticRequest __req( this, "_set_exceptions", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -14482,7 +14482,7 @@ CORBA::InterfaceAttrExtension::ExtFullInterfaceDescription* CORBA::InterfaceAttr
 {
   CORBA::StaticAny __res( _marshaller_CORBA_InterfaceAttrExtension_ExtFullInterfaceDescription );
 
-  CORBA::StaticRequest __req( this, "describe_ext_interface" );
+  CORBA::StaticRequest __req( this, "describe_ext_interface", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -14541,7 +14541,7 @@ CORBA::ExtAttributeDef_ptr CORBA::InterfaceAttrExtension_stub::create_ext_attrib
   CORBA::ExtAttributeDef_ptr _res = CORBA::ExtAttributeDef::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_ExtAttributeDef, &_res );
 
-  CORBA::StaticRequest __req( this, "create_ext_attribute" );
+  CORBA::StaticRequest __req( this, "create_ext_attribute", TRUE );
   __req.add_in_arg( &_sa_id );
   __req.add_in_arg( &_sa_name );
   __req.add_in_arg( &_sa_version );
@@ -15401,7 +15401,7 @@ CORBA::TypeCode_ptr CORBA::ValueMemberDef_stub::type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type" );
+  CORBA::StaticRequest __req( this, "_get_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -15453,7 +15453,7 @@ CORBA::IDLType_ptr CORBA::ValueMemberDef_stub::type_def()
   CORBA::IDLType_ptr _res = CORBA::IDLType::_nil();
   CORBA::StaticAny __res( _marshaller_CORBA_IDLType, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type_def" );
+  CORBA::StaticRequest __req( this, "_get_type_def", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -15503,7 +15503,7 @@ CORBA::ValueMemberDef_stub_clp::type_def()
 void CORBA::ValueMemberDef_stub::type_def( CORBA::IDLType_ptr _par__value )
 {
   CORBA::StaticAny _sa__value( _marshaller_CORBA_IDLType, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_type_def" );
+  CORBA::StaticRequest __req( this, "_set_type_def", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -15552,7 +15552,7 @@ CORBA::Visibility CORBA::ValueMemberDef_stub::access()
   CORBA::Visibility _res;
   CORBA::StaticAny __res( CORBA::_stc_short, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_access" );
+  CORBA::StaticRequest __req( this, "_get_access", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -15602,7 +15602,7 @@ CORBA::ValueMemberDef_stub_clp::access()
 void CORBA::ValueMemberDef_stub::access( CORBA::Visibility _par__value )
 {
   CORBA::StaticAny _sa__value( CORBA::_stc_short, &_par__value );
-  CORBA::StaticRequest __req( this, "_set_access" );
+  CORBA::StaticRequest __req( this, "_set_access", TRUE );
   __req.add_in_arg( &_sa__value );
 
   __req.invoke();
@@ -284,7 +284,7 @@ CORBA::DefinitionKind CORBA::IRObject_stub::def_kind()
   CORBA::DefinitionKind _res;
   CORBA::StaticAny __res( _marshaller_CORBA_DefinitionKind, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_def_kind" );
+  CORBA::StaticRequest __req( this, "_get_def_kind", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -333,7 +333,7 @@ CORBA::IRObject_stub_clp::def_kind()
 
 void CORBA::IRObject_stub::destroy()
 {
-  CORBA::StaticRequest __req( this, "destroy" );
+  CORBA::StaticRequest __req( this, "destroy", TRUE );
 
   __req.invoke();
 
@@ -570,7 +570,7 @@ CORBA::TypeCode_ptr CORBA::IDLType_stub::type()
   CORBA::TypeCode_ptr _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_TypeCode, &_res );
 
-  CORBA::StaticRequest __req( this, "_get_type" );
+  CORBA::StaticRequest __req( this, "_get_type", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
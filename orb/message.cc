@@ -42,6 +42,60 @@
 
 using namespace std;
 
+#if defined(HAVE_GCC_ATOMICS)
+#define RING_LOCK
+#define RING_CAS(p, o, n)	__sync_bool_compare_and_swap (p, o, n)
+#define RING_FENCE()		__sync_synchronize ()
+#else
+#define RING_LOCK		MICOMT::AutoLock __ring_lock(lock)
+#define RING_CAS(p, o, n)	(*(p) == (o) ? (*(p) = (n), TRUE) : FALSE)
+#define RING_FENCE()
+#endif // HAVE_GCC_ATOMICS
+
+/******************************** msg_type ******************************/
+
+// freed messages, never destroyed because messages may still be
+// deleted by other static destructors
+static MICO::MsgRing &
+free_msgs ()
+{
+    static MICO::MsgRing *ring = new MICO::MsgRing (256);
+    return *ring;
+}
+
+/*!
+ * \param size		The size of the object
+ * \return		Memory for a new message
+ *
+ * Take a message from the pool of freed messages, only allocate
+ * if the pool is empty.
+ */
+void *
+MICO::msg_type::operator new( size_t size )
+{
+    if (size == sizeof (msg_type)) {
+	void *p = free_msgs().pop();
+	if (p)
+	    return p;
+    }
+    return ::operator new (size);
+}
+
+/*!
+ * \param p		The message to free
+ * \param size		The size of the object
+ *
+ * Return the message to the pool unless it is full.
+ */
+void
+MICO::msg_type::operator delete( void *p, size_t size )
+{
+    if (!p)
+	return;
+    if (size != sizeof (msg_type) || !free_msgs().push (p))
+	::operator delete (p);
+}
+
 /****************************** MsgChannel ******************************/
 
 /*!
@@ -69,6 +123,153 @@ MICO::MsgChannel::get_msg( OP_id_type nextOP_id )
     return NULL;
 }
 
+/*!
+ * \param nextOP_id	The operation id
+ * \param msgs		Where to store the messages
+ * \param max		Max number of messages to return
+ * \return		The number of messages returned
+ *
+ * Get at least one and at most max messages, waiting if there
+ * are none. By default this gets a single message.
+ */
+MICO_ULong
+MICO::MsgChannel::get_msgs( OP_id_type nextOP_id, MICO::msg_type **msgs,
+			    MICO_ULong max )
+{
+    assert( max > 0 );
+    msgs[0] = get_msg( nextOP_id );
+    return 1;
+}
+
+/********************************* MsgRing ******************************/
+
+/*!
+ * \param _capacity	The minimum number of slots
+ *
+ * Allocate the ring. The capacity is rounded up to a power of two.
+ */
+MICO::MsgRing::MsgRing( MICO_ULong _capacity )
+    : head( 0 ), tail( 0 )
+{
+    MICO_ULong size = 2;
+    while (size < _capacity)
+	size <<= 1;
+    mask = size - 1;
+    slots = new Slot[size];
+    for (MICO_ULong i = 0; i < size; i++) {
+	slots[i].seq = i;
+	slots[i].data = NULL;
+    }
+}
+
+MICO::MsgRing::~MsgRing()
+{
+    delete[] slots;
+}
+
+/*!
+ * \param data		The pointer to queue
+ * \return		FALSE if the ring is full
+ */
+MICO_Boolean
+MICO::MsgRing::push( void *data )
+{
+    RING_LOCK;
+    Slot *slot;
+    MICO_ULong pos = head;
+
+    for (;;) {
+	slot = &slots[pos & mask];
+	MICO_Long dif = (MICO_Long)(slot->seq - pos);
+	if (dif == 0) {
+	    if (RING_CAS( &head, pos, pos + 1 ))
+		break;
+	    pos = head;
+	}
+	else if (dif < 0) {
+	    // the slot still holds the message of the last round
+	    return FALSE;
+	}
+	else {
+	    pos = head;
+	}
+    }
+    slot->data = data;
+    RING_FENCE();
+    slot->seq = pos + 1;
+    return TRUE;
+}
+
+/*!
+ * \return The oldest pointer in the ring or NULL if it is empty.
+ */
+void *
+MICO::MsgRing::pop()
+{
+    void *data;
+    return pop( &data, 1 ) ? data : NULL;
+}
+
+/*!
+ * \param data		Where to store the pointers
+ * \param max		Max number of pointers to take
+ * \return		The number of pointers taken
+ *
+ * Take up to max consecutive pointers from the ring with a single
+ * update of the tail position.
+ */
+MICO_ULong
+MICO::MsgRing::pop( void **data, MICO_ULong max )
+{
+    RING_LOCK;
+    MICO_ULong pos, n;
+
+    for (;;) {
+	pos = tail;
+	for (n = 0; n < max && n <= mask; n++) {
+	    if (slots[(pos + n) & mask].seq != pos + n + 1)
+		break;
+	}
+	if (n == 0) {
+	    if ((MICO_Long)(slots[pos & mask].seq - (pos + 1)) < 0)
+		return 0;
+	    // another consumer was faster
+	    continue;
+	}
+	if (RING_CAS( &tail, pos, pos + n ))
+	    break;
+    }
+    for (MICO_ULong i = 0; i < n; i++)
+	data[i] = slots[(pos + i) & mask].data;
+    RING_FENCE();
+    for (MICO_ULong i = 0; i < n; i++)
+	slots[(pos + i) & mask].seq = pos + i + mask + 1;
+    return n;
+}
+
+/*!
+ * \return TRUE if there was nothing to pop at the time of the call.
+ */
+MICO_Boolean
+MICO::MsgRing::empty() const
+{
+    RING_LOCK;
+    MICO_ULong pos = tail;
+    return (MICO_Long)(slots[pos & mask].seq - (pos + 1)) < 0;
+}
+
+/*!
+ * \return TRUE if there was no room to push at the time of the call.
+ */
+MICO_Boolean
+MICO::MsgRing::full() const
+{
+    RING_LOCK;
+    MICO_ULong pos = head;
+    // the slot still holds the message of the last round
+    return (MICO_Long)(slots[pos & mask].seq - pos) < 0;
+}
+
 /********************************* ActiveMsgQueue **************************************/
 
 /*!
@@ -353,6 +554,261 @@ MICO::PassiveMsgQueue::put_msg( MICO::OP_id_type nextOP_id, MICO::msg_type *msg)
 }
 
 
+/******************************** ActiveRingMsgQueue *************************************/
+
+/*!
+ * \param capacity	The size of the ring
+ */
+MICO::ActiveRingMsgQueue::ActiveRingMsgQueue( MICO_ULong capacity )
+    : ring( capacity ), overflowed( 0 )
+{
+    if (MICO::Logger::IsLogged (MICO::Logger::Thread)) {
+	MICOMT::AutoDebugLock __lock;
+	MICO::Logger::Stream (MICO::Logger::Thread)
+	    << "ActiveRingMsgQueue::ActiveRingMsgQueue(): ("
+	    << this << ")" << endl;
+    }
+#ifdef DEBUG_NAMES
+    NamedObject::name ("UnNamed ActiveRingMsgQueue");
+#endif
+}
+
+/*!
+ * The destructor deletes all messages that were not processed.
+ */
+MICO::ActiveRingMsgQueue::~ActiveRingMsgQueue()
+{
+    msg_type *msg;
+    while ((msg = pop()) != NULL)
+	delete msg;
+}
+
+#ifdef DEBUG_NAMES
+const char *
+MICO::ActiveRingMsgQueue::name (const char *new_name) {
+
+    return NamedObject::name (new_name);
+}
+#endif
+
+/*!
+ * \return The next message or NULL.
+ */
+MICO::msg_type *
+MICO::ActiveRingMsgQueue::pop()
+{
+    msg_type *msg = (msg_type *)ring.pop();
+    if (msg || overflowed == 0)
+	return msg;
+
+    MICOMT::AutoLock l(overflow_lock);
+    if (overflow.empty())
+	return NULL;
+    msg = overflow.front();
+    overflow.pop();
+    overflowed = overflow.size();
+    return msg;
+}
+
+/*!
+ * \param kt		The worker thread asking for work or NULL
+ * \return		TRUE if a message was handed to a thread
+ *
+ * Give the next message to kt, or to an idle thread if kt is NULL.
+ */
+MICO_Boolean
+MICO::ActiveRingMsgQueue::check_msg( MICO::WorkerThread *kt )
+{
+    MICO_Boolean wake = FALSE;
+    msg_type *msg;
+
+    if (!kt) {
+	if (ring.empty() && overflowed == 0)
+	    return FALSE;
+	kt = tp->get_idle_thread();
+	if (!kt)
+	    return FALSE;
+	msg = pop();
+	if (!msg) {
+	    // somebody else was faster
+	    tp->mark_idle( kt );
+	    return FALSE;
+	}
+	wake = TRUE;
+    }
+    else {
+	msg = pop();
+	if (!msg)
+	    return FALSE;
+    }
+#ifdef MTDEBUG
+    msg->pop_time = OSMisc::timestamp();
+#endif
+    kt->put_msg( msg );
+    kt->mark_busy();
+    if (wake)
+	kt->post_state_change();
+    return TRUE;
+}
+
+/*!
+ * \param nextOP_id	The next operation id
+ * \param msg		The message
+ *
+ * Hand the message to an idle thread or queue it. As a thread may
+ * have become idle after get_idle_thread() failed, queued messages
+ * are offered to the idle threads again.
+ */
+void
+MICO::ActiveRingMsgQueue::put_msg( MICO::OP_id_type nextOP_id,
+				   MICO::msg_type *msg )
+{
+    assert( msg );
+#ifdef MTDEBUG
+    msg->push_time = OSMisc::timestamp();
+#endif
+    MICO::WorkerThread *kt = tp->get_idle_thread();
+    if (kt) {
+	kt->put_msg( msg );
+	kt->mark_busy();
+	kt->post_state_change();
+	return;
+    }
+    if (overflowed > 0 || !ring.push( msg )) {
+	MICOMT::AutoLock l(overflow_lock);
+	overflow.push( msg );
+	overflowed = overflow.size();
+    }
+    check_msg( 0 );
+}
+
+
+/******************************** PassiveRingMsgQueue *************************************/
+
+/*!
+ * \param capacity	The size of the ring
+ */
+MICO::PassiveRingMsgQueue::PassiveRingMsgQueue( MICO_ULong capacity )
+    : ring( capacity ), not_empty( &wait_lock ), not_full( &wait_lock ),
+      consumers( 0 ), producers( 0 )
+{
+    if (MICO::Logger::IsLogged (MICO::Logger::Thread)) {
+	MICOMT::AutoDebugLock __lock;
+	MICO::Logger::Stream (MICO::Logger::Thread)
+	    << "PassiveRingMsgQueue::PassiveRingMsgQueue(): ("
+	    << this << ")" << endl;
+    }
+#ifdef DEBUG_NAMES
+    NamedObject::name ("UnNamed PassiveRingMsgQueue");
+#endif
+}
+
+MICO::PassiveRingMsgQueue::~PassiveRingMsgQueue()
+{
+    msg_type *msg;
+    while ((msg = (msg_type *)ring.pop()) != NULL)
+	delete msg;
+}
+
+#ifdef DEBUG_NAMES
+const char *
+MICO::PassiveRingMsgQueue::name (const char *new_name) {
+
+    return NamedObject::name (new_name);
+}
+#endif
+
+/*!
+ * \param waiting	Number of threads sleeping on cond
+ * \param cond		The condition to signal
+ *
+ * Wake up one sleeping thread, if there is any. Sleepers count
+ * themselves before they look at the ring and we look at the
+ * count after changing the ring, so no wakeup can get lost.
+ */
+void
+MICO::PassiveRingMsgQueue::wake( volatile MICO_Long &waiting,
+				 MICOMT::CondVar &cond )
+{
+#if defined(HAVE_GCC_ATOMICS)
+    __sync_synchronize ();
+    if (waiting == 0)
+	return;
+#endif // HAVE_GCC_ATOMICS
+    MICOMT::AutoLock l(wait_lock);
+    if (waiting > 0)
+	cond.signal();
+}
+
+MICO::msg_type *
+MICO::PassiveRingMsgQueue::get_msg( MICO::OP_id_type nextOP_id )
+{
+    msg_type *msg;
+    get_msgs( nextOP_id, &msg, 1 );
+    return msg;
+}
+
+/*!
+ * \param nextOP_id	The operation id
+ * \param msgs		Where to store the messages
+ * \param max		Max number of messages to return
+ * \return		The number of messages returned
+ *
+ * Take all queued messages up to max at once, sleep if there
+ * are none.
+ */
+MICO_ULong
+MICO::PassiveRingMsgQueue::get_msgs( MICO::OP_id_type nextOP_id,
+				     MICO::msg_type **msgs, MICO_ULong max )
+{
+    assert( max > 0 );
+    for (;;) {
+	MICO_ULong n = ring.pop( (void **)msgs, max );
+	if (n > 0) {
+	    wake( producers, not_full );
+	    return n;
+	}
+	MICOMT::AutoLock l(wait_lock);
+#if defined(HAVE_GCC_ATOMICS)
+	__sync_add_and_fetch( &consumers, 1 );
+#else
+	consumers++;
+#endif // HAVE_GCC_ATOMICS
+	while (ring.empty())
+	    not_empty.wait();
+	consumers--;
+    }
+}
+
+/*!
+ * \param nextOP_id	The next operation id
+ * \param msg		The message to queue
+ *
+ * Queue the message, sleep while the ring is full.
+ */
+void
+MICO::PassiveRingMsgQueue::put_msg( MICO::OP_id_type nextOP_id,
+				    MICO::msg_type *msg )
+{
+    assert( msg );
+#ifdef MTDEBUG
+    msg->push_time = OSMisc::timestamp();
+#endif
+    while (!ring.push( msg )) {
+	MICOMT::AutoLock l(wait_lock);
+#if defined(HAVE_GCC_ATOMICS)
+	__sync_add_and_fetch( &producers, 1 );
+#else
+	producers++;
+#endif // HAVE_GCC_ATOMICS
+	while (ring.full())
+	    not_full.wait();
+	producers--;
+    }
+    wake( consumers, not_empty );
+}
+
+
 /******************************** DirectMsgConnector *************************************/
 
 /*!
@@ -0,0 +1,795 @@
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2006 by The Mico Team
+ *
+ *  This file was automatically generated. DO NOT EDIT!
+ */
+
+#include <CORBA.h>
+#include <mico/throw.h>
+#include <mico/template_impl.h>
+
+
+using namespace std;
+
+//--------------------------------------------------------
+//  Implementation of stubs
+//--------------------------------------------------------
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_Counter;
+}
+
+#ifdef HAVE_EXPLICIT_STRUCT_OPS
+MICOMetrics::Counter::Counter()
+{
+}
+
+MICOMetrics::Counter::Counter( const Counter& _s )
+{
+  name = ((Counter&)_s).name;
+  value = ((Counter&)_s).value;
+}
+
+MICOMetrics::Counter::~Counter()
+{
+}
+
+MICOMetrics::Counter&
+MICOMetrics::Counter::operator=( const Counter& _s )
+{
+  name = ((Counter&)_s).name;
+  value = ((Counter&)_s).value;
+  return *this;
+}
+#endif
+
+class _Marshaller_MICOMetrics_Counter : public ::CORBA::StaticTypeInfo {
+    typedef MICOMetrics::Counter _MICO_T;
+  public:
+    ~_Marshaller_MICOMetrics_Counter();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller_MICOMetrics_Counter::~_Marshaller_MICOMetrics_Counter()
+{
+}
+
+::CORBA::StaticValueType _Marshaller_MICOMetrics_Counter::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller_MICOMetrics_Counter::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller_MICOMetrics_Counter::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller_MICOMetrics_Counter::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  return
+    dc.struct_begin() &&
+    CORBA::_stc_string->demarshal( dc, &((_MICO_T*)v)->name._for_demarshal() ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->value ) &&
+    dc.struct_end();
+}
+
+void _Marshaller_MICOMetrics_Counter::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ec.struct_begin();
+  CORBA::_stc_string->marshal( ec, &((_MICO_T*)v)->name.inout() );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->value );
+  ec.struct_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller_MICOMetrics_Counter::typecode()
+{
+  return MICOMetrics::_tc_Counter;
+}
+
+::CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Counter;
+
+void operator<<=( CORBA::Any &_a, const MICOMetrics::Counter &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Counter, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, MICOMetrics::Counter *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, MICOMetrics::Counter &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Counter, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const MICOMetrics::Counter *&_s )
+{
+  return _a.to_static_any (_marshaller_MICOMetrics_Counter, (void *&)_s);
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_CounterSeq;
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_Histogram;
+}
+
+#ifdef HAVE_EXPLICIT_STRUCT_OPS
+MICOMetrics::Histogram::Histogram()
+{
+}
+
+MICOMetrics::Histogram::Histogram( const Histogram& _s )
+{
+  name = ((Histogram&)_s).name;
+  count = ((Histogram&)_s).count;
+  total = ((Histogram&)_s).total;
+  min = ((Histogram&)_s).min;
+  max = ((Histogram&)_s).max;
+  p50 = ((Histogram&)_s).p50;
+  p90 = ((Histogram&)_s).p90;
+  p99 = ((Histogram&)_s).p99;
+  p999 = ((Histogram&)_s).p999;
+}
+
+MICOMetrics::Histogram::~Histogram()
+{
+}
+
+MICOMetrics::Histogram&
+MICOMetrics::Histogram::operator=( const Histogram& _s )
+{
+  name = ((Histogram&)_s).name;
+  count = ((Histogram&)_s).count;
+  total = ((Histogram&)_s).total;
+  min = ((Histogram&)_s).min;
+  max = ((Histogram&)_s).max;
+  p50 = ((Histogram&)_s).p50;
+  p90 = ((Histogram&)_s).p90;
+  p99 = ((Histogram&)_s).p99;
+  p999 = ((Histogram&)_s).p999;
+  return *this;
+}
+#endif
+
+class _Marshaller_MICOMetrics_Histogram : public ::CORBA::StaticTypeInfo {
+    typedef MICOMetrics::Histogram _MICO_T;
+  public:
+    ~_Marshaller_MICOMetrics_Histogram();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller_MICOMetrics_Histogram::~_Marshaller_MICOMetrics_Histogram()
+{
+}
+
+::CORBA::StaticValueType _Marshaller_MICOMetrics_Histogram::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller_MICOMetrics_Histogram::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller_MICOMetrics_Histogram::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller_MICOMetrics_Histogram::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  return
+    dc.struct_begin() &&
+    CORBA::_stc_string->demarshal( dc, &((_MICO_T*)v)->name._for_demarshal() ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->count ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->total ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->min ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->max ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->p50 ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->p90 ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->p99 ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->p999 ) &&
+    dc.struct_end();
+}
+
+void _Marshaller_MICOMetrics_Histogram::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ec.struct_begin();
+  CORBA::_stc_string->marshal( ec, &((_MICO_T*)v)->name.inout() );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->count );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->total );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->min );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->max );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->p50 );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->p90 );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->p99 );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->p999 );
+  ec.struct_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller_MICOMetrics_Histogram::typecode()
+{
+  return MICOMetrics::_tc_Histogram;
+}
+
+::CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Histogram;
+
+void operator<<=( CORBA::Any &_a, const MICOMetrics::Histogram &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Histogram, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, MICOMetrics::Histogram *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, MICOMetrics::Histogram &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Histogram, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const MICOMetrics::Histogram *&_s )
+{
+  return _a.to_static_any (_marshaller_MICOMetrics_Histogram, (void *&)_s);
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_HistogramSeq;
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_Connection;
+}
+
+#ifdef HAVE_EXPLICIT_STRUCT_OPS
+MICOMetrics::Connection::Connection()
+{
+}
+
+MICOMetrics::Connection::Connection( const Connection& _s )
+{
+  peer = ((Connection&)_s).peer;
+  bytes_in = ((Connection&)_s).bytes_in;
+  bytes_out = ((Connection&)_s).bytes_out;
+}
+
+MICOMetrics::Connection::~Connection()
+{
+}
+
+MICOMetrics::Connection&
+MICOMetrics::Connection::operator=( const Connection& _s )
+{
+  peer = ((Connection&)_s).peer;
+  bytes_in = ((Connection&)_s).bytes_in;
+  bytes_out = ((Connection&)_s).bytes_out;
+  return *this;
+}
+#endif
+
+class _Marshaller_MICOMetrics_Connection : public ::CORBA::StaticTypeInfo {
+    typedef MICOMetrics::Connection _MICO_T;
+  public:
+    ~_Marshaller_MICOMetrics_Connection();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller_MICOMetrics_Connection::~_Marshaller_MICOMetrics_Connection()
+{
+}
+
+::CORBA::StaticValueType _Marshaller_MICOMetrics_Connection::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller_MICOMetrics_Connection::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller_MICOMetrics_Connection::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller_MICOMetrics_Connection::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  return
+    dc.struct_begin() &&
+    CORBA::_stc_string->demarshal( dc, &((_MICO_T*)v)->peer._for_demarshal() ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->bytes_in ) &&
+    CORBA::_stc_ulonglong->demarshal( dc, &((_MICO_T*)v)->bytes_out ) &&
+    dc.struct_end();
+}
+
+void _Marshaller_MICOMetrics_Connection::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ec.struct_begin();
+  CORBA::_stc_string->marshal( ec, &((_MICO_T*)v)->peer.inout() );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->bytes_in );
+  CORBA::_stc_ulonglong->marshal( ec, &((_MICO_T*)v)->bytes_out );
+  ec.struct_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller_MICOMetrics_Connection::typecode()
+{
+  return MICOMetrics::_tc_Connection;
+}
+
+::CORBA::StaticTypeInfo *_marshaller_MICOMetrics_Connection;
+
+void operator<<=( CORBA::Any &_a, const MICOMetrics::Connection &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Connection, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, MICOMetrics::Connection *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, MICOMetrics::Connection &_s )
+{
+  CORBA::StaticAny _sa (_marshaller_MICOMetrics_Connection, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const MICOMetrics::Connection *&_s )
+{
+  return _a.to_static_any (_marshaller_MICOMetrics_Connection, (void *&)_s);
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_ConnectionSeq;
+}
+
+
+/*
+ * Base interface for class Registry
+ */
+
+MICOMetrics::Registry::~Registry()
+{
+}
+
+void *
+MICOMetrics::Registry::_narrow_helper( const char *_repoid )
+{
+  if( strcmp( _repoid, "IDL:MICOMetrics/Registry:1.0" ) == 0 )
+    return (void *)this;
+  return NULL;
+}
+
+MICOMetrics::Registry_ptr
+MICOMetrics::Registry::_narrow( CORBA::Object_ptr _obj )
+{
+  if( !CORBA::is_nil( _obj ) ) {
+    void *_p;
+    if( (_p = _obj->_narrow_helper( "IDL:MICOMetrics/Registry:1.0" )))
+      return _duplicate( (MICOMetrics::Registry_ptr) _p );
+  }
+  return _nil();
+}
+
+MICOMetrics::Registry_ptr
+MICOMetrics::Registry::_narrow( CORBA::AbstractBase_ptr _obj )
+{
+  return _narrow (_obj->_to_object());
+}
+
+namespace MICOMetrics
+{
+CORBA::TypeCodeConst _tc_Registry;
+}
+
+class _Marshaller__seq_MICOMetrics_Counter : public ::CORBA::StaticTypeInfo {
+    typedef SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> _MICO_T;
+    static ::CORBA::TypeCode_ptr _tc;
+  public:
+    ~_Marshaller__seq_MICOMetrics_Counter();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller__seq_MICOMetrics_Counter::~_Marshaller__seq_MICOMetrics_Counter()
+{
+  if (_tc)
+    delete _tc;
+}
+
+::CORBA::StaticValueType _Marshaller__seq_MICOMetrics_Counter::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller__seq_MICOMetrics_Counter::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller__seq_MICOMetrics_Counter::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller__seq_MICOMetrics_Counter::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  ::CORBA::ULong len;
+  if( !dc.seq_begin( len ) )
+    return FALSE;
+  ((_MICO_T *) v)->length( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ ) {
+    if( !_marshaller_MICOMetrics_Counter->demarshal( dc, &(*(_MICO_T*)v)[i] ) )
+      return FALSE;
+  }
+  return dc.seq_end();
+}
+
+void _Marshaller__seq_MICOMetrics_Counter::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ::CORBA::ULong len = ((_MICO_T *) v)->length();
+  ec.seq_begin( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ )
+    _marshaller_MICOMetrics_Counter->marshal( ec, &(*(_MICO_T*)v)[i] );
+  ec.seq_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Counter::typecode()
+{
+  if (!_tc)
+    _tc = (new ::CORBA::TypeCode (
+    "010000001300000068000000010000000f00000058000000010000001c00"
+    "000049444c3a4d49434f4d6574726963732f436f756e7465723a312e3000"
+    "08000000436f756e7465720002000000050000006e616d65000000001200"
+    "0000000000000600000076616c75650000001800000000000000"))->mk_constant();
+  return _tc;
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Counter::_tc = 0;
+::CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Counter;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Counter, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Counter, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Counter,MICO_TID_DEF> *&_s )
+{
+  return _a.to_static_any (_marshaller__seq_MICOMetrics_Counter, (void *&)_s);
+}
+
+
+class _Marshaller__seq_MICOMetrics_Histogram : public ::CORBA::StaticTypeInfo {
+    typedef SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> _MICO_T;
+    static ::CORBA::TypeCode_ptr _tc;
+  public:
+    ~_Marshaller__seq_MICOMetrics_Histogram();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller__seq_MICOMetrics_Histogram::~_Marshaller__seq_MICOMetrics_Histogram()
+{
+  if (_tc)
+    delete _tc;
+}
+
+::CORBA::StaticValueType _Marshaller__seq_MICOMetrics_Histogram::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller__seq_MICOMetrics_Histogram::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller__seq_MICOMetrics_Histogram::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller__seq_MICOMetrics_Histogram::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  ::CORBA::ULong len;
+  if( !dc.seq_begin( len ) )
+    return FALSE;
+  ((_MICO_T *) v)->length( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ ) {
+    if( !_marshaller_MICOMetrics_Histogram->demarshal( dc, &(*(_MICO_T*)v)[i] ) )
+      return FALSE;
+  }
+  return dc.seq_end();
+}
+
+void _Marshaller__seq_MICOMetrics_Histogram::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ::CORBA::ULong len = ((_MICO_T *) v)->length();
+  ec.seq_begin( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ )
+    _marshaller_MICOMetrics_Histogram->marshal( ec, &(*(_MICO_T*)v)[i] );
+  ec.seq_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Histogram::typecode()
+{
+  if (!_tc)
+    _tc = (new ::CORBA::TypeCode (
+    "0100000013000000cc000000010000000f000000bc000000010000001e00"
+    "000049444c3a4d49434f4d6574726963732f486973746f6772616d3a312e"
+    "300000000a000000486973746f6772616d00000009000000050000006e61"
+    "6d6500000000120000000000000006000000636f756e7400000018000000"
+    "06000000746f74616c00000018000000040000006d696e00180000000400"
+    "00006d617800180000000400000070353000180000000400000070393000"
+    "180000000400000070393900180000000500000070393939000000001800"
+    "000000000000"))->mk_constant();
+  return _tc;
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Histogram::_tc = 0;
+::CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Histogram;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Histogram, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Histogram, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Histogram,MICO_TID_DEF> *&_s )
+{
+  return _a.to_static_any (_marshaller__seq_MICOMetrics_Histogram, (void *&)_s);
+}
+
+
+class _Marshaller__seq_MICOMetrics_Connection : public ::CORBA::StaticTypeInfo {
+    typedef SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> _MICO_T;
+    static ::CORBA::TypeCode_ptr _tc;
+  public:
+    ~_Marshaller__seq_MICOMetrics_Connection();
+    StaticValueType create () const;
+    void assign (StaticValueType dst, const StaticValueType src) const;
+    void free (StaticValueType) const;
+    ::CORBA::Boolean demarshal (::CORBA::DataDecoder&, StaticValueType) const;
+    void marshal (::CORBA::DataEncoder &, StaticValueType) const;
+    ::CORBA::TypeCode_ptr typecode ();
+};
+
+
+_Marshaller__seq_MICOMetrics_Connection::~_Marshaller__seq_MICOMetrics_Connection()
+{
+  if (_tc)
+    delete _tc;
+}
+
+::CORBA::StaticValueType _Marshaller__seq_MICOMetrics_Connection::create() const
+{
+  return (StaticValueType) new _MICO_T;
+}
+
+void _Marshaller__seq_MICOMetrics_Connection::assign( StaticValueType d, const StaticValueType s ) const
+{
+  *(_MICO_T*) d = *(_MICO_T*) s;
+}
+
+void _Marshaller__seq_MICOMetrics_Connection::free( StaticValueType v ) const
+{
+  delete (_MICO_T*) v;
+}
+
+::CORBA::Boolean _Marshaller__seq_MICOMetrics_Connection::demarshal( ::CORBA::DataDecoder &dc, StaticValueType v ) const
+{
+  ::CORBA::ULong len;
+  if( !dc.seq_begin( len ) )
+    return FALSE;
+  ((_MICO_T *) v)->length( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ ) {
+    if( !_marshaller_MICOMetrics_Connection->demarshal( dc, &(*(_MICO_T*)v)[i] ) )
+      return FALSE;
+  }
+  return dc.seq_end();
+}
+
+void _Marshaller__seq_MICOMetrics_Connection::marshal( ::CORBA::DataEncoder &ec, StaticValueType v ) const
+{
+  ::CORBA::ULong len = ((_MICO_T *) v)->length();
+  ec.seq_begin( len );
+  for( ::CORBA::ULong i = 0; i < len; i++ )
+    _marshaller_MICOMetrics_Connection->marshal( ec, &(*(_MICO_T*)v)[i] );
+  ec.seq_end();
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Connection::typecode()
+{
+  if (!_tc)
+    _tc = (new ::CORBA::TypeCode (
+    "010000001300000088000000010000000f00000078000000010000001f00"
+    "000049444c3a4d49434f4d6574726963732f436f6e6e656374696f6e3a31"
+    "2e3000000b000000436f6e6e656374696f6e000003000000050000007065"
+    "65720000000012000000000000000900000062797465735f696e00000000"
+    "180000000a00000062797465735f6f75740000001800000000000000"))->mk_constant();
+  return _tc;
+}
+
+::CORBA::TypeCode_ptr _Marshaller__seq_MICOMetrics_Connection::_tc = 0;
+::CORBA::StaticTypeInfo *_marshaller__seq_MICOMetrics_Connection;
+
+void operator<<=( CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Connection, &_s);
+  _a.from_static_any (_sa);
+}
+
+void operator<<=( CORBA::Any &_a, SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> *_s )
+{
+  _a <<= *_s;
+  delete _s;
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> &_s )
+{
+  CORBA::StaticAny _sa (_marshaller__seq_MICOMetrics_Connection, &_s);
+  return _a.to_static_any (_sa);
+}
+
+CORBA::Boolean operator>>=( const CORBA::Any &_a, const SequenceTmpl< MICOMetrics::Connection,MICO_TID_DEF> *&_s )
+{
+  return _a.to_static_any (_marshaller__seq_MICOMetrics_Connection, (void *&)_s);
+}
+
+
+struct __tc_init_METRICS {
+  __tc_init_METRICS()
+  {
+    MICOMetrics::_tc_Counter = 
+    "010000000f00000058000000010000001c00000049444c3a4d49434f4d65"
+    "74726963732f436f756e7465723a312e300008000000436f756e74657200"
+    "02000000050000006e616d65000000001200000000000000060000007661"
+    "6c756500000018000000";
+    _marshaller_MICOMetrics_Counter = new _Marshaller_MICOMetrics_Counter;
+    MICOMetrics::_tc_CounterSeq = 
+    "0100000015000000a8000000010000001f00000049444c3a4d49434f4d65"
+    "74726963732f436f756e7465725365713a312e3000000b000000436f756e"
+    "74657253657100001300000068000000010000000f000000580000000100"
+    "00001c00000049444c3a4d49434f4d6574726963732f436f756e7465723a"
+    "312e300008000000436f756e7465720002000000050000006e616d650000"
+    "000012000000000000000600000076616c75650000001800000000000000"
+    ;
+    MICOMetrics::_tc_Histogram = 
+    "010000000f000000bc000000010000001e00000049444c3a4d49434f4d65"
+    "74726963732f486973746f6772616d3a312e300000000a00000048697374"
+    "6f6772616d00000009000000050000006e616d6500000000120000000000"
+    "000006000000636f756e740000001800000006000000746f74616c000000"
+    "18000000040000006d696e0018000000040000006d617800180000000400"
+    "000070353000180000000400000070393000180000000400000070393900"
+    "1800000005000000703939390000000018000000";
+    _marshaller_MICOMetrics_Histogram = new _Marshaller_MICOMetrics_Histogram;
+    MICOMetrics::_tc_HistogramSeq = 
+    "010000001500000014010000010000002100000049444c3a4d49434f4d65"
+    "74726963732f486973746f6772616d5365713a312e30000000000d000000"
+    "486973746f6772616d5365710000000013000000cc000000010000000f00"
+    "0000bc000000010000001e00000049444c3a4d49434f4d6574726963732f"
+    "486973746f6772616d3a312e300000000a000000486973746f6772616d00"
+    "000009000000050000006e616d6500000000120000000000000006000000"
+    "636f756e740000001800000006000000746f74616c000000180000000400"
+    "00006d696e0018000000040000006d617800180000000400000070353000"
+    "180000000400000070393000180000000400000070393900180000000500"
+    "000070393939000000001800000000000000";
+    MICOMetrics::_tc_Connection = 
+    "010000000f00000078000000010000001f00000049444c3a4d49434f4d65"
+    "74726963732f436f6e6e656374696f6e3a312e3000000b000000436f6e6e"
+    "656374696f6e000003000000050000007065657200000000120000000000"
+    "00000900000062797465735f696e00000000180000000a00000062797465"
+    "735f6f757400000018000000";
+    _marshaller_MICOMetrics_Connection = new _Marshaller_MICOMetrics_Connection;
+    MICOMetrics::_tc_ConnectionSeq = 
+    "0100000015000000d0000000010000002200000049444c3a4d49434f4d65"
+    "74726963732f436f6e6e656374696f6e5365713a312e300000000e000000"
+    "436f6e6e656374696f6e5365710000001300000088000000010000000f00"
+    "000078000000010000001f00000049444c3a4d49434f4d6574726963732f"
+    "436f6e6e656374696f6e3a312e3000000b000000436f6e6e656374696f6e"
+    "000003000000050000007065657200000000120000000000000009000000"
+    "62797465735f696e00000000180000000a00000062797465735f6f757400"
+    "00001800000000000000";
+    MICOMetrics::_tc_Registry = 
+    "010000000e00000035000000010000001d00000049444c3a4d49434f4d65"
+    "74726963732f52656769737472793a312e30000000000900000052656769"
+    "7374727900";
+    _marshaller__seq_MICOMetrics_Counter = new _Marshaller__seq_MICOMetrics_Counter;
+    _marshaller__seq_MICOMetrics_Histogram = new _Marshaller__seq_MICOMetrics_Histogram;
+    _marshaller__seq_MICOMetrics_Connection = new _Marshaller__seq_MICOMetrics_Connection;
+  }
+
+  ~__tc_init_METRICS()
+  {
+    delete static_cast<_Marshaller_MICOMetrics_Counter*>(_marshaller_MICOMetrics_Counter);
+    delete static_cast<_Marshaller_MICOMetrics_Histogram*>(_marshaller_MICOMetrics_Histogram);
+    delete static_cast<_Marshaller_MICOMetrics_Connection*>(_marshaller_MICOMetrics_Connection);
+    delete static_cast<_Marshaller__seq_MICOMetrics_Counter*>(_marshaller__seq_MICOMetrics_Counter);
+    delete static_cast<_Marshaller__seq_MICOMetrics_Histogram*>(_marshaller__seq_MICOMetrics_Histogram);
+    delete static_cast<_Marshaller__seq_MICOMetrics_Connection*>(_marshaller__seq_MICOMetrics_Connection);
+  }
+};
+
+static __tc_init_METRICS __init_METRICS;
+
+//--------------------------------------------------------
+//  Implementation of skeletons
+//--------------------------------------------------------
@@ -0,0 +1,651 @@
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2007 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#ifdef FAST_PCH
+#include "orb_pch.h"
+#endif // FAST_PCH
+#ifdef __COMO__
+#pragma hdrstop
+#endif // __COMO__
+
+#ifndef FAST_PCH
+
+#include <CORBA.h>
+#include <string.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include <mico/impl.h>
+#include <mico/throw.h>
+#include <mico/util.h>
+
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <fstream>
+#else
+#include <fstream.h>
+#endif
+
+#endif // FAST_PCH
+
+
+using namespace std;
+
+static const char *metrics_counter_names[] = {
+    "giop.bytes_in",
+    "giop.bytes_out",
+    "giop.connections_opened",
+    "giop.connections_closed"
+};
+
+static const char *metrics_histogram_names[] = {
+    "giop.marshal",
+    "giop.unmarshal",
+    "threadpool.queue_wait"
+};
+
+CORBA::Boolean MICO::Metrics::_enabled = FALSE;
+MICOMT::Mutex MICO::Metrics::_lock;
+list<MICO::Metrics::Shard *> MICO::Metrics::_shards;
+MICO::Metrics::Shard *MICO::Metrics::_retired = 0;
+map<string, MICO::Metrics::Id> MICO::Metrics::_counter_ids;
+map<string, MICO::Metrics::Id> MICO::Metrics::_histogram_ids;
+vector<string> MICO::Metrics::_counter_names;
+vector<string> MICO::Metrics::_histogram_names;
+list<MICO::Metrics::ConnStats *> MICO::Metrics::_conns;
+#ifdef HAVE_THREADS
+MICOMT::Thread::ThreadKey MICO::Metrics::_key;
+static CORBA::Boolean metrics_have_key = FALSE;
+#endif
+
+
+/**************************** Histogram *****************************/
+
+
+static inline CORBA::ULong
+metrics_msb (CORBA::ULongLong v)
+{
+#ifdef __GNUC__
+    return 63 - __builtin_clzll (v);
+#else
+    CORBA::ULong e = 0;
+    while (v >>= 1)
+	++e;
+    return e;
+#endif
+}
+
+MICO::Metrics::Histogram::Histogram ()
+{
+    reset ();
+}
+
+void
+MICO::Metrics::Histogram::reset ()
+{
+    count = total = max = 0;
+    min = ~(CORBA::ULongLong)0;
+    memset (buckets, 0, sizeof (buckets));
+}
+
+CORBA::ULong
+MICO::Metrics::Histogram::index (CORBA::ULongLong v)
+{
+    if (v >> MaxBits)
+	v = ((CORBA::ULongLong)1 << MaxBits) - 1;
+    if (v < (1 << SubBits))
+	return (CORBA::ULong)v;
+    // the top SubBits+1 bits of the value select the bucket
+    CORBA::ULong e = metrics_msb (v);
+    return ((e - SubBits + 1) << SubBits) +
+	(CORBA::ULong)((v >> (e - SubBits)) & ((1 << SubBits) - 1));
+}
+
+CORBA::ULongLong
+MICO::Metrics::Histogram::upper (CORBA::ULong idx)
+{
+    if (idx < (1 << SubBits))
+	return idx;
+    CORBA::ULong e = (idx >> SubBits) + SubBits - 1;
+    CORBA::ULongLong low = (CORBA::ULongLong)((1 << SubBits) +
+	(idx & ((1 << SubBits) - 1))) << (e - SubBits);
+    return low + ((CORBA::ULongLong)1 << (e - SubBits)) - 1;
+}
+
+void
+MICO::Metrics::Histogram::record (CORBA::ULongLong v)
+{
+    ++count;
+    total += v;
+    if (v < min)
+	min = v;
+    if (v > max)
+	max = v;
+    ++buckets[index (v)];
+}
+
+void
+MICO::Metrics::Histogram::add (const Histogram &h)
+{
+    count += h.count;
+    total += h.total;
+    if (h.min < min)
+	min = h.min;
+    if (h.max > max)
+	max = h.max;
+    for (CORBA::ULong i = 0; i < Buckets; ++i)
+	buckets[i] += h.buckets[i];
+}
+
+/*
+ * the upper bound of the bucket that holds the given fraction of
+ * the values
+ */
+CORBA::ULongLong
+MICO::Metrics::Histogram::percentile (double p) const
+{
+    if (count == 0)
+	return 0;
+    CORBA::ULongLong want = (CORBA::ULongLong)(p * count + 0.5);
+    if (want == 0)
+	want = 1;
+    CORBA::ULongLong seen = 0;
+    for (CORBA::ULong i = 0; i < Buckets; ++i) {
+	seen += buckets[i];
+	if (seen >= want) {
+	    CORBA::ULongLong v = upper (i);
+	    return v > max ? max : (v < min ? min : v);
+	}
+    }
+    return max;
+}
+
+
+/****************************** Shard *******************************/
+
+
+MICO::Metrics::Shard::Shard ()
+{
+    memset (counters, 0, sizeof (counters));
+    memset (histograms, 0, sizeof (histograms));
+}
+
+MICO::Metrics::Shard::~Shard ()
+{
+    for (CORBA::ULong i = 0; i < MaxChunks; ++i) {
+	delete[] counters[i];
+	if (histograms[i]) {
+	    for (CORBA::ULong j = 0; j < ChunkSize; ++j)
+		delete histograms[i][j];
+	    delete[] histograms[i];
+	}
+    }
+}
+
+/*
+ * chunks and histograms are created under the lock, so the registry
+ * never sees one half done. the owner thread does not need the lock
+ * to update them.
+ */
+CORBA::ULongLong *
+MICO::Metrics::Shard::new_counters (Id id)
+{
+    MICOMT::AutoLock l (_lock);
+    CORBA::ULongLong *c = new CORBA::ULongLong[ChunkSize];
+    memset (c, 0, ChunkSize * sizeof (CORBA::ULongLong));
+    counters[id >> ChunkBits] = c;
+    return c;
+}
+
+MICO::Metrics::Histogram &
+MICO::Metrics::Shard::new_histogram (Id id)
+{
+    MICOMT::AutoLock l (_lock);
+    Histogram **h = histograms[id >> ChunkBits];
+    if (!h) {
+	h = new Histogram *[ChunkSize];
+	memset (h, 0, ChunkSize * sizeof (Histogram *));
+	histograms[id >> ChunkBits] = h;
+    }
+    Histogram *hist = new Histogram;
+    h[id & (ChunkSize-1)] = hist;
+    return *hist;
+}
+
+// called with the lock held
+void
+MICO::Metrics::Shard::add (const Shard &s)
+{
+    for (CORBA::ULong i = 0; i < MaxChunks; ++i) {
+	if (s.counters[i]) {
+	    if (!counters[i]) {
+		counters[i] = new CORBA::ULongLong[ChunkSize];
+		memset (counters[i], 0, ChunkSize * sizeof (CORBA::ULongLong));
+	    }
+	    for (CORBA::ULong j = 0; j < ChunkSize; ++j)
+		counters[i][j] += s.counters[i][j];
+	}
+	if (s.histograms[i]) {
+	    if (!histograms[i]) {
+		histograms[i] = new Histogram *[ChunkSize];
+		memset (histograms[i], 0, ChunkSize * sizeof (Histogram *));
+	    }
+	    for (CORBA::ULong j = 0; j < ChunkSize; ++j) {
+		if (!s.histograms[i][j])
+		    continue;
+		if (!histograms[i][j])
+		    histograms[i][j] = new Histogram;
+		histograms[i][j]->add (*s.histograms[i][j]);
+	    }
+	}
+    }
+}
+
+// called with the lock held
+void
+MICO::Metrics::Shard::reset ()
+{
+    for (CORBA::ULong i = 0; i < MaxChunks; ++i) {
+	if (counters[i])
+	    memset (counters[i], 0, ChunkSize * sizeof (CORBA::ULongLong));
+	if (histograms[i]) {
+	    for (CORBA::ULong j = 0; j < ChunkSize; ++j) {
+		if (histograms[i][j])
+		    histograms[i][j]->reset ();
+	    }
+	}
+    }
+}
+
+
+/***************************** Metrics ******************************/
+
+
+MICO::Metrics::Shard *
+MICO::Metrics::new_shard ()
+{
+    Shard *s = new Shard;
+    MICOMT::AutoLock l (_lock);
+    _shards.push_back (s);
+#ifdef HAVE_THREADS
+    MICOMT::Thread::set_specific (_key, s);
+#endif
+    return s;
+}
+
+/*
+ * a thread goes away, keep what it has measured
+ */
+void
+MICO::Metrics::retire (void *p)
+{
+    Shard *s = (Shard *)p;
+    MICOMT::AutoLock l (_lock);
+    if (!_retired)
+	_retired = new Shard;
+    _retired->add (*s);
+    _shards.remove (s);
+    delete s;
+}
+
+// called with the lock held
+MICO::Metrics::Id
+MICO::Metrics::lookup (map<string, Id> &ids, vector<string> &names,
+		       const char *name)
+{
+    if (names.empty()) {
+	// the predefined ones come first, in the order of their enums
+	for (CORBA::ULong i = 0; i < NumCounters; ++i) {
+	    _counter_ids[metrics_counter_names[i]] = i;
+	    _counter_names.push_back (metrics_counter_names[i]);
+	}
+	for (CORBA::ULong i = 0; i < NumHistograms; ++i) {
+	    _histogram_ids[metrics_histogram_names[i]] = i;
+	    _histogram_names.push_back (metrics_histogram_names[i]);
+	}
+    }
+    if (!name)
+	return 0;
+
+    map<string, Id>::iterator i = ids.find (name);
+    if (i != ids.end())
+	return (*i).second;
+    if (names.size() >= MaxChunks * ChunkSize - 1) {
+	// the last one takes everything that does not fit
+	name = "overflow";
+	i = ids.find (name);
+	if (i != ids.end())
+	    return (*i).second;
+    }
+    Id id = names.size();
+    names.push_back (name);
+    ids[name] = id;
+    return id;
+}
+
+void
+MICO::Metrics::enable (CORBA::Boolean on)
+{
+    MICOMT::AutoLock l (_lock);
+    lookup (_counter_ids, _counter_names, 0);
+#ifdef HAVE_THREADS
+    if (!metrics_have_key) {
+	MICOMT::Thread::create_key (_key, retire);
+	metrics_have_key = TRUE;
+    }
+#endif
+    _enabled = on;
+}
+
+MICO::Metrics::Id
+MICO::Metrics::counter (const char *name)
+{
+    MICOMT::AutoLock l (_lock);
+    return lookup (_counter_ids, _counter_names, name);
+}
+
+/*
+ * histograms are also looked up per request, so every thread keeps
+ * the ids it has seen
+ */
+MICO::Metrics::Id
+MICO::Metrics::histogram (const char *name)
+{
+    map<string, Id> *cache = 0;
+    if (_enabled) {
+	cache = &shard()->hcache;
+	map<string, Id>::iterator i = cache->find (name);
+	if (i != cache->end())
+	    return (*i).second;
+    }
+    Id id;
+    {
+	MICOMT::AutoLock l (_lock);
+	id = lookup (_histogram_ids, _histogram_names, name);
+    }
+    if (cache)
+	(*cache)[name] = id;
+    return id;
+}
+
+MICO::Metrics::ConnStats *
+MICO::Metrics::open_conn (const char *peer)
+{
+    ConnStats *s = new ConnStats;
+    s->peer = peer;
+    s->bytes_in = s->bytes_out = 0;
+    {
+	MICOMT::AutoLock l (_lock);
+	_conns.push_back (s);
+    }
+    add (ConnOpened);
+    return s;
+}
+
+void
+MICO::Metrics::close_conn (ConnStats *s)
+{
+    {
+	MICOMT::AutoLock l (_lock);
+	_conns.remove (s);
+    }
+    delete s;
+    add (ConnClosed);
+}
+
+void
+MICO::Metrics::counters (vector<pair<string, CORBA::ULongLong> > &res)
+{
+    Shard sum;
+    MICOMT::AutoLock l (_lock);
+    lookup (_counter_ids, _counter_names, 0);
+    for (list<Shard *>::iterator i = _shards.begin(); i != _shards.end(); ++i)
+	sum.add (**i);
+    if (_retired)
+	sum.add (*_retired);
+
+    res.clear ();
+    for (Id id = 0; id < _counter_names.size(); ++id) {
+	CORBA::ULongLong *c = sum.counters[id >> ChunkBits];
+	res.push_back (make_pair (_counter_names[id],
+				  c ? c[id & (ChunkSize-1)] : 0));
+    }
+}
+
+void
+MICO::Metrics::histograms (vector<pair<string, Histogram> > &res)
+{
+    Shard sum;
+    MICOMT::AutoLock l (_lock);
+    lookup (_counter_ids, _counter_names, 0);
+    for (list<Shard *>::iterator i = _shards.begin(); i != _shards.end(); ++i)
+	sum.add (**i);
+    if (_retired)
+	sum.add (*_retired);
+
+    res.clear ();
+    res.reserve (_histogram_names.size());
+    for (Id id = 0; id < _histogram_names.size(); ++id) {
+	Histogram **h = sum.histograms[id >> ChunkBits];
+	res.push_back (make_pair (_histogram_names[id], Histogram()));
+	if (h && h[id & (ChunkSize-1)])
+	    res.back().second.add (*h[id & (ChunkSize-1)]);
+    }
+}
+
+void
+MICO::Metrics::connections (vector<ConnStats> &res)
+{
+    MICOMT::AutoLock l (_lock);
+    res.clear ();
+    for (list<ConnStats *>::iterator i = _conns.begin(); i != _conns.end(); ++i)
+	res.push_back (**i);
+}
+
+void
+MICO::Metrics::reset ()
+{
+    MICOMT::AutoLock l (_lock);
+    for (list<Shard *>::iterator i = _shards.begin(); i != _shards.end(); ++i)
+	(*i)->reset ();
+    if (_retired)
+	_retired->reset ();
+}
+
+
+/************************** Registry_impl ***************************/
+
+
+MICOMetrics::Registry_impl::Registry_impl ()
+{
+    _interval = 0;
+    _disp = 0;
+}
+
+MICOMetrics::Registry_impl::~Registry_impl ()
+{
+    if (_disp)
+	_disp->remove (this, CORBA::Dispatcher::Timer);
+}
+
+CORBA::Boolean
+MICOMetrics::Registry_impl::enabled ()
+{
+    return MICO::Metrics::enabled ();
+}
+
+void
+MICOMetrics::Registry_impl::enabled (CORBA::Boolean on)
+{
+    MICO::Metrics::enable (on);
+}
+
+MICOMetrics::CounterSeq *
+MICOMetrics::Registry_impl::counters ()
+{
+    vector<pair<string, CORBA::ULongLong> > v;
+    MICO::Metrics::counters (v);
+
+    CounterSeq *res = new CounterSeq;
+    res->length (v.size());
+    for (CORBA::ULong i = 0; i < v.size(); ++i) {
+	(*res)[i].name = v[i].first.c_str();
+	(*res)[i].value = v[i].second;
+    }
+    return res;
+}
+
+MICOMetrics::HistogramSeq *
+MICOMetrics::Registry_impl::histograms ()
+{
+    vector<pair<string, MICO::Metrics::Histogram> > v;
+    MICO::Metrics::histograms (v);
+
+    HistogramSeq *res = new HistogramSeq;
+    res->length (v.size());
+    for (CORBA::ULong i = 0; i < v.size(); ++i) {
+	const MICO::Metrics::Histogram &h = v[i].second;
+	Histogram &r = (*res)[i];
+	r.name = v[i].first.c_str();
+	r.count = h.count;
+	r.total = h.total;
+	r.min = h.count ? h.min : 0;
+	r.max = h.max;
+	r.p50 = h.percentile (0.5);
+	r.p90 = h.percentile (0.9);
+	r.p99 = h.percentile (0.99);
+	r.p999 = h.percentile (0.999);
+    }
+    return res;
+}
+
+MICOMetrics::ConnectionSeq *
+MICOMetrics::Registry_impl::connections ()
+{
+    vector<MICO::Metrics::ConnStats> v;
+    MICO::Metrics::connections (v);
+
+    ConnectionSeq *res = new ConnectionSeq;
+    res->length (v.size());
+    for (CORBA::ULong i = 0; i < v.size(); ++i) {
+	(*res)[i].peer = v[i].peer.c_str();
+	(*res)[i].bytes_in = v[i].bytes_in;
+	(*res)[i].bytes_out = v[i].bytes_out;
+    }
+    return res;
+}
+
+void
+MICOMetrics::Registry_impl::reset ()
+{
+    MICO::Metrics::reset ();
+}
+
+/*
+ * one line per counter, histogram and connection. the file is written
+ * under a temporary name first, so readers never see half of it.
+ */
+void
+MICOMetrics::Registry_impl::dump (const char *filename)
+{
+    if (!write (filename))
+	mico_throw (CORBA::BAD_PARAM());
+}
+
+CORBA::Boolean
+MICOMetrics::Registry_impl::write (const char *filename)
+{
+    CounterSeq_var cs = counters ();
+    HistogramSeq_var hs = histograms ();
+    ConnectionSeq_var conns = connections ();
+
+    string tmp = filename;
+    tmp += ".tmp";
+    ofstream out (tmp.c_str());
+    if (!out)
+	return FALSE;
+
+    out << "# MICO metrics at " << OSMisc::timestamp() / 1000
+	<< (MICO::Metrics::enabled() ? "" : " (disabled)") << endl;
+    for (CORBA::ULong i = 0; i < cs->length(); ++i)
+	out << "counter " << cs[i].name.in() << " " << cs[i].value << endl;
+    for (CORBA::ULong i = 0; i < hs->length(); ++i) {
+	const Histogram &h = hs[i];
+	out << "histogram " << h.name.in()
+	    << " count " << h.count << " total " << h.total
+	    << " min " << h.min << " max " << h.max
+	    << " p50 " << h.p50 << " p90 " << h.p90
+	    << " p99 " << h.p99 << " p999 " << h.p999 << endl;
+    }
+    for (CORBA::ULong i = 0; i < conns->length(); ++i)
+	out << "connection " << conns[i].peer.in()
+	    << " in " << conns[i].bytes_in
+	    << " out " << conns[i].bytes_out << endl;
+    out.close ();
+    if (!out)
+	return FALSE;
+    return ::rename (tmp.c_str(), filename) == 0;
+}
+
+void
+MICOMetrics::Registry_impl::dump_periodically (const char *filename,
+					       CORBA::ULong interval)
+{
+    if (_disp) {
+	_disp->remove (this, CORBA::Dispatcher::Timer);
+	_disp = 0;
+    }
+    _file = filename;
+    _interval = interval;
+    if (_interval > 0) {
+	CORBA::ORB_var orb = CORBA::ORB_instance ("mico-local-orb");
+	_disp = orb->dispatcher ();
+	_disp->tm_event (this, _interval * 1000);
+    }
+}
+
+void
+MICOMetrics::Registry_impl::callback (CORBA::Dispatcher *disp,
+				      CORBA::Dispatcher::Event ev)
+{
+    switch (ev) {
+    case CORBA::Dispatcher::Timer:
+	if (!write (_file.c_str())) {
+	    if (MICO::Logger::IsLogged (MICO::Logger::Warning)) {
+		MICO::Logger::Stream (MICO::Logger::Warning)
+		    << "Warning: cannot write metrics to " << _file << endl;
+	    }
+	}
+	disp->tm_event (this, _interval * 1000);
+	break;
+    case CORBA::Dispatcher::Remove:
+	// the ORB goes away, leave the final numbers behind
+	write (_file.c_str());
+	_disp = 0;
+	break;
+    case CORBA::Dispatcher::Moved:
+	_disp = disp;
+	break;
+    default:
+	assert (0);
+    }
+}
@@ -39,6 +39,8 @@
 
 #endif // FAST_PCH
 
+#include <deque>
+
 
 using namespace MICOMT;
 using namespace std;
@@ -246,8 +248,10 @@ MICO::ThreadPool::put_msg( MICO::OP_id_type nextOP_id, MICO::msg_type *msg )
         // shutdown is in progress so we ignore any additional work
         return;
     }
-    if (input_mc)
+    if (input_mc) {
+	msg->enqueued();
 	input_mc->put_msg(nextOP_id, msg);
+    }
 }
 
 
@@ -269,6 +273,304 @@ MICO::ThreadPool::shutdown()
 }
 
 
+/****************************** StealingThreadPool ******************************/
+
+/*!
+ * \ingroup micomt
+ * A thread of the StealingThreadPool. It owns a deque of messages
+ * and a copy of the pool's operation. The thread itself takes
+ * messages from the front of its deque, other threads of the pool
+ * steal from the back.
+ */
+class MICO::StealingThreadPool::Worker: public MICOMT::Thread
+{
+public:
+    Worker( StealingThreadPool *_tp, Operation *_op, unsigned int _index )
+	: tp(_tp), op(_op), index(_index), size(0)
+    {}
+
+    virtual ~Worker()
+    {
+	while (!msgs.empty()) {
+	    delete msgs.front();
+	    msgs.pop_front();
+	}
+	if (op != NULL)
+	    delete op;
+    }
+
+    void push( msg_type *msg )
+    {
+	AutoLock l(lock);
+	msgs.push_back( msg );
+	size = msgs.size();
+    }
+
+    msg_type *pop()
+    {
+	if (size == 0)
+	    return NULL;
+	AutoLock l(lock);
+	if (msgs.empty())
+	    return NULL;
+	msg_type *msg = msgs.front();
+	msgs.pop_front();
+	size = msgs.size();
+	return msg;
+    }
+
+    msg_type *steal()
+    {
+	// unlocked peek, so that idle threads do not lock every deque
+	if (size == 0)
+	    return NULL;
+	AutoLock l(lock);
+	if (msgs.empty())
+	    return NULL;
+	msg_type *msg = msgs.back();
+	msgs.pop_back();
+	size = msgs.size();
+	return msg;
+    }
+
+    virtual void _run( void *arg );
+
+    StealingThreadPool	       *tp;	//!< The thread's pool
+    Operation		       *op;	//!< The thread's operation
+    unsigned int		index;	//!< Position in the pool
+    MICOMT::Mutex		lock;	//!< Protects msgs
+    std::deque<msg_type *>	msgs;	//!< Queued messages
+    volatile CORBA::ULong	size;	//!< Number of queued messages
+};
+
+/*!
+ * \param cpu		The CPU to run on
+ * Bind the calling thread to a CPU. This is only supported
+ * with pthreads on systems that have CPU sets.
+ */
+static void
+bind_to_cpu( unsigned int cpu )
+{
+#if defined(HAVE_PTHREADS) && defined(CPU_SET)
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( cpu, &set );
+    if (pthread_setaffinity_np( pthread_self(), sizeof(set), &set ) != 0) {
+	if (MICO::Logger::IsLogged (MICO::Logger::Warning)) {
+	    AutoDebugLock __lock;
+	    MICO::Logger::Stream (MICO::Logger::Warning)
+		<< "StealingThreadPool: cannot bind thread to CPU "
+		<< cpu << endl;
+	}
+    }
+#endif // HAVE_PTHREADS && CPU_SET
+}
+
+/*!
+ * \param arg		Thread parameters, not used
+ * Process messages until the pool is shut down.
+ */
+void
+MICO::StealingThreadPool::Worker::_run( void *arg )
+{
+    MICOMT::Thread::set_specific( tp->worker_key, this );
+    if (tp->cpus.size() > 0)
+	bind_to_cpu( tp->cpus[index % tp->cpus.size()] );
+
+    msg_type *msg;
+    while ((msg = tp->next_msg( this )) != NULL) {
+	op->put_msg( op->info().get_op_id(), msg );
+	op->_run();
+    }
+}
+
+/*!
+ * \param _max		Number of threads
+ * \param _queue_limit	Max number of queued messages, 0 for no limit
+ * \param _policy	What to do when the limit is reached
+ * \param _cpus		CPUs to bind the threads to, may be empty
+ * Initialize the thread pool. The threads are created by
+ * start_threads().
+ */
+MICO::StealingThreadPool::StealingThreadPool( unsigned int _max,
+					      unsigned int _queue_limit,
+					      OverflowPolicy _policy,
+					      const vector<unsigned int> &_cpus )
+    : ThreadPool( _max, 0, 0 ),
+      cpus( _cpus ),
+      space_cond_( &tp_lock ),
+      queue_limit( _queue_limit ),
+      policy( _policy ),
+      _queued( 0 ),
+      _idle( 0 ),
+      _blocked( 0 ),
+      _next( 0 ),
+      _rejected( 0 )
+{
+    MICOMT::Thread::create_key( worker_key );
+}
+
+/*!
+ * Free the threads together with the messages that were still
+ * queued when the pool was shut down.
+ */
+MICO::StealingThreadPool::~StealingThreadPool()
+{
+    for (unsigned int i = 0; i < workers.size(); i++)
+	delete workers[i];
+    MICOMT::Thread::delete_key( worker_key );
+}
+
+/*!
+ * \param v		The counter
+ * \param d		The value to add
+ * \return		The new value of the counter
+ * Atomically add to one of the counters. The counters are used to
+ * decide whether sleeping threads have to be woken up, so this must
+ * be a full memory barrier.
+ */
+CORBA::Long
+MICO::StealingThreadPool::count( volatile CORBA::Long &v, CORBA::Long d )
+{
+#if defined(HAVE_GCC_ATOMICS)
+    return __sync_add_and_fetch( &v, d );
+#else
+    AutoLock l(count_lock);
+    v += d;
+    return v;
+#endif // HAVE_GCC_ATOMICS
+}
+
+/*!
+ * \param arg		Parameter to the threads, not used
+ * Start all threads of the pool, each with its own copy of
+ * the pool's operation.
+ */
+void
+MICO::StealingThreadPool::start_threads( void *arg )
+{
+    AutoLock l(tp_lock);
+
+    if (workers.size() > 0)
+	return;
+    for (unsigned int i = 0; i < max; i++) {
+	Worker *w = new Worker( this, op ? op->copy() : NULL, i );
+	workers.push_back( w );
+    }
+    cnt_all = max;
+    for (unsigned int i = 0; i < max; i++)
+	workers[i]->start();
+}
+
+/*!
+ * \param w		The calling thread
+ * \return The next message for the thread or NULL on shutdown.
+ * Take a message from the thread's own deque or steal one from
+ * another thread. Sleep if there is nothing to do.
+ */
+MICO::msg_type *
+MICO::StealingThreadPool::next_msg( Worker *w )
+{
+    unsigned int n = workers.size();
+
+    for (;;) {
+	msg_type *msg = w->pop();
+	for (unsigned int i = 1; !msg && i < n; i++)
+	    msg = workers[(w->index + i) % n]->steal();
+
+	if (msg) {
+	    // blocked producers are woken once half of the queue is free
+	    if (count( _queued, -1 ) <= (CORBA::Long)queue_limit / 2
+		&& count( _blocked, 0 ) > 0) {
+		AutoLock l(tp_lock);
+		space_cond_.broadcast();
+	    }
+	    return msg;
+	}
+
+	AutoLock l(tp_lock);
+	if (shutdown_)
+	    return NULL;
+	// put_msg() increments _queued before it looks at _idle
+	count( _idle, 1 );
+	if (count( _queued, 0 ) == 0)
+	    tp_cond_.wait();
+	count( _idle, -1 );
+    }
+}
+
+/*!
+ * \param nextOP_id	The next operation id
+ * \param msg		The message to queue
+ * Queue a message for one of the threads. Messages from the pool's
+ * own threads are queued on the thread's deque and never wait.
+ * Others are spread over the threads in round robin order and are
+ * subject to the queue limit.
+ */
+void
+MICO::StealingThreadPool::put_msg( MICO::OP_id_type nextOP_id,
+				   MICO::msg_type *msg )
+{
+    if (shutdown_) {
+        // shutdown is in progress so we ignore any additional work
+        return;
+    }
+    Worker *w = (Worker *)MICOMT::Thread::get_specific( worker_key );
+
+    if (!w && queue_limit > 0
+	&& count( _queued, 0 ) >= (CORBA::Long)queue_limit) {
+	if (policy == Reject) {
+	    count( _rejected, 1 );
+	    if (MICO::Logger::IsLogged (MICO::Logger::Thread)) {
+		AutoDebugLock __lock;
+		MICO::Logger::Stream (MICO::Logger::Thread)
+		    << "StealingThreadPool::put_msg(): queue limit of "
+		    << queue_limit << " reached, rejecting " << msg << endl;
+	    }
+	    op->reject( msg );
+	    return;
+	}
+	AutoLock l(tp_lock);
+	// next_msg() decrements _queued before it looks at _blocked
+	count( _blocked, 1 );
+	while (!shutdown_ && count( _queued, 0 ) >= (CORBA::Long)queue_limit)
+	    space_cond_.wait();
+	count( _blocked, -1 );
+	if (shutdown_)
+	    return;
+    }
+    if (!w)
+	w = workers[(CORBA::ULong)count( _next, 1 ) % workers.size()];
+
+    msg->enqueued();
+    w->push( msg );
+    count( _queued, 1 );
+    if (count( _idle, 0 ) > 0) {
+	AutoLock l(tp_lock);
+	tp_cond_.signal();
+    }
+}
+
+/*!
+ * Wake up all threads and producers and wait for the threads
+ * to finish. Threads that are still busy are terminated.
+ */
+void
+MICO::StealingThreadPool::shutdown()
+{
+    {
+	AutoLock l(tp_lock);
+	shutdown_ = true;
+	tp_cond_.broadcast();
+	space_cond_.broadcast();
+    }
+    for (unsigned int i = 0; i < workers.size(); i++)
+	workers[i]->terminate();
+    for (unsigned int i = 0; i < workers.size(); i++)
+	workers[i]->wait();
+}
+
+
 /****************************** WorkerThread *******************************/
 
 /*!
@@ -443,9 +745,21 @@ MICO::MTManager::thread_setup(unsigned int conn_limit, unsigned int req_limit)
 
     for (unsigned int i = 0; i < sizeof(tm_init)/sizeof(MICO::tm_init_t); i++) {
 
-	MICO::ThreadPool *tp = new MICO::ThreadPool( tm_init[i].max,
-									tm_init[i].max_idle,
-									tm_init[i].min_idle );
+	MICO::ThreadPool *tp;
+	if (_S_work_stealing && tm_init[i].start) {
+	    // only requests coming in from outside are limited, the
+	    // ORB pool is fed by the DeCode pool and must not reject
+	    tp = new MICO::StealingThreadPool
+		( tm_init[i].max,
+		  tm_init[i].OP_type == MICO::Operation::DeCode
+		  ? _S_request_queue_limit : 0,
+		  _S_request_queue_policy, _S_thread_affinity );
+	}
+	else {
+	    tp = new MICO::ThreadPool( tm_init[i].max,
+				       tm_init[i].max_idle,
+				       tm_init[i].min_idle );
+	}
 	_S_thread_pool_manager->register_tp( tm_init[i].OP_type, *tp );
 
 	switch (tm_init[i].OP_type) {
@@ -461,11 +775,15 @@ MICO::MTManager::thread_setup(unsigned int conn_limit, unsigned int req_limit)
 	    break;
 	}
 	
-	switch ( tm_init[i].mct ) {
+	switch ( channel_type( tm_init[i].mct ) ) {
 	case MICO::MsgChannel::active:
-	    if ( tm_init[i].mc_size )
+	    if ( tm_init[i].mc_size && !_S_work_stealing )
 		tp->register_input_mc( new MICO::ActiveMsgQueue() );
 	    break;
+	case MICO::MsgChannel::active_ring:
+	    if ( tm_init[i].mc_size && !_S_work_stealing )
+		tp->register_input_mc( new MICO::ActiveRingMsgQueue() );
+	    break;
 	case MICO::MsgChannel::direct: {         
 	    MICO::DirectMsgConnector *mq = new MICO::DirectMsgConnector();
 	    mq->set_operation( tp->get_operation() );
@@ -489,6 +807,32 @@ ServerConcurrencyModel MICO::MTManager::_S_server_concurrency_model = THREAD_POO
 ClientConcurrencyModel MICO::MTManager::_S_client_concurrency_model = THREADED;
 MICO::ThreadPoolManager* MICO::MTManager::_S_thread_pool_manager = NULL;
 bool MICO::MTManager::_S_mt_manager_shutdown_ = false;
+bool MICO::MTManager::_S_work_stealing = false;
+unsigned int MICO::MTManager::_S_request_queue_limit = 0;
+MICO::StealingThreadPool::OverflowPolicy MICO::MTManager::_S_request_queue_policy
+    = MICO::StealingThreadPool::Reject;
+vector<unsigned int> MICO::MTManager::_S_thread_affinity;
+bool MICO::MTManager::_S_lockfree_channels = false;
+
+/*!
+ * \ingroup micomt
+ * \param queue_limit	Max number of queued requests, 0 for no limit
+ * \param policy	What to do with requests beyond the limit
+ * \param cpus		CPUs to bind the pool threads to, may be empty
+ * Use work stealing thread pools for the DeCode and ORB operations.
+ * Must be called before thread_setup().
+ */
+void
+MICO::MTManager::work_stealing_setup(unsigned int queue_limit,
+				     MICO::StealingThreadPool::OverflowPolicy policy,
+				     const vector<unsigned int> &cpus)
+{
+    assert(_S_thread_pool_manager == NULL);
+    _S_work_stealing = true;
+    _S_request_queue_limit = queue_limit;
+    _S_request_queue_policy = policy;
+    _S_thread_affinity = cpus;
+}
 
 
 void
@@ -520,6 +864,35 @@ MICO::MTManager::client_concurrency_model()
     return MICO::MTManager::_S_client_concurrency_model;
 }
 
+/*!
+ * \ingroup micomt
+ * \param on		Whether to use lock free message channels
+ * Select the MsgRing based message channels instead of the
+ * mutex protected queues.
+ */
+void
+MICO::MTManager::lockfree_channels(CORBA::Boolean on)
+{
+    _S_lockfree_channels = on;
+}
+
+/*!
+ * \ingroup micomt
+ * \param type		The requested type of message channel
+ * \return		The type of message channel to create
+ */
+MICO::MsgChannel::Types
+MICO::MTManager::channel_type(MICO::MsgChannel::Types type)
+{
+    if (_S_lockfree_channels) {
+	if (type == MICO::MsgChannel::active)
+	    return MICO::MsgChannel::active_ring;
+	if (type == MICO::MsgChannel::passive)
+	    return MICO::MsgChannel::passive_ring;
+    }
+    return type;
+}
+
 CORBA::Boolean
 MICO::MTManager::thread_pool()
 {
@@ -557,6 +930,7 @@ MICO::MTManager::free()
     assert(_S_thread_pool_manager != NULL);
     delete _S_thread_pool_manager;
     _S_thread_pool_manager = NULL;
+    _S_work_stealing = false;
 }
 
 void
@@ -89,6 +89,8 @@ MICO::Operation::Operation() :
 MICO::Operation::Operation(const Operation &op)
     : _info(op._info), _thr(NULL)
 {
+    // the copy shares the node and releases it when deleted
+    _info->_ref();
 }
 
 /*!
@@ -169,6 +171,23 @@ MICO::Operation::process( MICO::msg_type *msg )
     assert( 0 );
 }
 
+/*!
+ * \param msg		The message that was rejected
+ *
+ * Called by a thread pool for a message it has no room for. The
+ * default is to process the message in the calling thread.
+ */
+void
+MICO::Operation::reject( MICO::msg_type *msg )
+{
+    Operation *_myop = this->copy();
+
+    _myop->put_msg( _myop->info().get_op_id(), msg );
+    _myop->_run();
+
+    delete _myop;
+}
+
 /*!
  * Must be implemented in derived classes.
  */
@@ -233,6 +252,7 @@ MICO::PassiveOperation::_run() {
     }
     else {
 	// process everything else
+	_msg->dequeued();
 	process( _msg );
     }
 
@@ -301,7 +321,9 @@ MICO::ActiveOperation::init_shutdown() {
 /*!
  * The run message will take messages from the input
  * queue and process them. If a terminate message is
- * found, the operation will stop running.
+ * found, the operation will stop running. Messages are
+ * taken from the queue in batches of up to 16 if the
+ * input channel supports it.
  *
  * \todo
  * Why is it while (42)?
@@ -309,6 +331,8 @@ MICO::ActiveOperation::init_shutdown() {
 void
 MICO::ActiveOperation::_run() {
 
+    msg_type *msgs[16];
+
     while (42) {
 
         if (MICO::Logger::IsLogged (MICO::Logger::Thread)) {
@@ -317,25 +341,29 @@ MICO::ActiveOperation::_run() {
 		<< __NAME (name () <<) "ActiveOperation::_run(): waiting for a msg"
 		<< endl;
 	}
-        msg_type *msg = this->get_input_mc()->get_msg( this->info().get_op_id() );
+        MICO_ULong n = this->get_input_mc()->get_msgs
+	    ( this->info().get_op_id(), msgs, sizeof(msgs)/sizeof(msgs[0]) );
         //
-        // We are guaranteed that msg is not NULL because get_msg() asserts
-        // this, so don't bother checking it again after the call to get_msg()
-        // above!!!
+        // We are guaranteed that at least one msg is returned because
+        // get_msgs() waits for it, so don't bother checking it again!!!
         //
 
         if (MICO::Logger::IsLogged (MICO::Logger::Thread)) {
 	    MICOMT::AutoDebugLock __lock;
 	    MICO::Logger::Stream (MICO::Logger::Thread) 
-		<< __NAME (name () <<) "ActiveOperation::_run(): recv'd msg"
-		<< endl;
+		<< __NAME (name () <<) "ActiveOperation::_run(): recv'd "
+		<< n << " msgs" << endl;
 	}
-        if (msg->get_type() == msg_type::Terminate) {
-            delete msg;
-	    break;
+        for (MICO_ULong i = 0; i < n; i++) {
+            if (msgs[i]->get_type() == msg_type::Terminate) {
+                // nobody is going to process the rest
+                for (; i < n; i++)
+                    delete msgs[i];
+                return;
+            }
+            msgs[i]->dequeued();
+            process( msgs[i] );
         }
-
-        process( msg );
     }
 }
 
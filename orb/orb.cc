@@ -107,6 +107,11 @@ CORBA::ObjectAdapter::~ObjectAdapter ()
 {
 }
 
+void
+CORBA::ObjectAdapter::get_key_prefixes (vector<string> &) const
+{
+}
+
 CORBA::ORBCallback::~ORBCallback ()
 {
 }
@@ -656,6 +661,138 @@ CORBA::ORBInvokeRec::timedout(Boolean val)
 #endif // USE_MESSAGING
 
 
+/************************* InvokeTable ****************************/
+
+
+MICO::InvokeTable::InvokeTable ()
+{
+    for (int i = 0; i < NSTRIPES; ++i) {
+	_stripes[i].chains.resize (MIN_BUCKETS, 0);
+	_stripes[i].size = 0;
+    }
+}
+
+MICO::InvokeTable::~InvokeTable ()
+{
+    for (int i = 0; i < NSTRIPES; ++i) {
+	Stripe &s = _stripes[i];
+	for (mico_vec_size_type j = 0; j < s.chains.size(); ++j) {
+	    Entry *e = s.chains[j];
+	    while (e) {
+		Entry *n = e->next;
+		CORBA::release (e->rec);
+		delete e;
+		e = n;
+	    }
+	}
+    }
+}
+
+void
+MICO::InvokeTable::grow (Stripe &s)
+{
+    std::vector<Entry *> old;
+    old.swap (s.chains);
+    s.chains.resize (old.size() * 2, 0);
+    for (mico_vec_size_type i = 0; i < old.size(); ++i) {
+	Entry *e = old[i];
+	while (e) {
+	    Entry *n = e->next;
+	    Entry *&c = chain (s, e->id);
+	    e->next = c;
+	    c = e;
+	    e = n;
+	}
+    }
+}
+
+void
+MICO::InvokeTable::add (CORBA::ORBInvokeRec *rec)
+{
+    MsgId id = rec->id();
+    Stripe &s = stripe (id);
+    Entry *e = new Entry;
+    e->id = id;
+    e->rec = CORBA::ORBInvokeRec::_duplicate (rec);
+
+    MICOMT::AutoLock l(s.lock);
+#ifndef NDEBUG
+    // kcg: if this assert ever fails, then we need to implement
+    // new msgid colision checking into ORB::new_msgid method
+    for (Entry *i = chain (s, id); i; i = i->next)
+	assert (i->id != id);
+#endif
+    if (s.size >= s.chains.size())
+	grow (s);
+    Entry *&c = chain (s, id);
+    e->next = c;
+    c = e;
+    ++s.size;
+}
+
+CORBA::ORBInvokeRec *
+MICO::InvokeTable::get (MsgId id)
+{
+    Stripe &s = stripe (id);
+    MICOMT::AutoLock l(s.lock);
+    for (Entry *e = chain (s, id); e; e = e->next) {
+	if (e->id == id)
+	    return CORBA::ORBInvokeRec::_duplicate (e->rec);
+    }
+    return 0;
+}
+
+CORBA::ORBInvokeRec *
+MICO::InvokeTable::find (Predicate pred)
+{
+    for (int i = 0; i < NSTRIPES; ++i) {
+	Stripe &s = _stripes[i];
+	MICOMT::AutoLock l(s.lock);
+	for (mico_vec_size_type j = 0; j < s.chains.size(); ++j) {
+	    for (Entry *e = s.chains[j]; e; e = e->next) {
+		if (pred (e->rec))
+		    return CORBA::ORBInvokeRec::_duplicate (e->rec);
+	    }
+	}
+    }
+    return 0;
+}
+
+void
+MICO::InvokeTable::remove (MsgId id)
+{
+    Stripe &s = stripe (id);
+    Entry *found = 0;
+    {
+	MICOMT::AutoLock l(s.lock);
+	for (Entry **e = &chain (s, id); *e; e = &(*e)->next) {
+	    if ((*e)->id == id) {
+		found = *e;
+		*e = found->next;
+		--s.size;
+		break;
+	    }
+	}
+    }
+    if (found) {
+	// the record may go away here, so do not hold the stripe lock
+	CORBA::release (found->rec);
+	delete found;
+    }
+}
+
+CORBA::ULong
+MICO::InvokeTable::size ()
+{
+    CORBA::ULong n = 0;
+    for (int i = 0; i < NSTRIPES; ++i) {
+	MICOMT::AutoLock l(_stripes[i].lock);
+	n += _stripes[i].size;
+    }
+    return n;
+}
+
+
 /**************************** ORB *********************************/
 
 
@@ -672,13 +809,6 @@ ORB_cleanup_current_invocation_rec(void* value)
         delete invs;
     }
 }
-
-void
-ORB_cleanup_invocation_map(void* value)
-{
-    assert(!CORBA::is_nil(orb_instance));
-    orb_instance->remove_thread_invocations_map(value);
-}
 }
 #endif // HAVE_THREADS
 
@@ -693,7 +823,6 @@ CORBA::ORB::ORB (int &argc, char **argv, const char *rcfile)
 #else // HAVE_THREADS
     MICOMT::Thread::create_key(_current_rec_key, ORB_cleanup_current_invocation_rec);
     threading_initialized_ = FALSE;
-    MICOMT::Thread::create_key(_invokes_key, ORB_cleanup_invocation_map);
 #endif // HAVE_THREADS
     _rcfile = rcfile;
     _wait_for_completion = FALSE;
@@ -708,14 +837,15 @@ CORBA::ORB::ORB (int &argc, char **argv, const char *rcfile)
     _cache_rec = NULL;
 #endif
 #ifdef DEBUG_NAMES
-    _isa_cache.name("ORB._isa_cache");
     _adapters.name("ORB._adapters");
-    _invokes.name("ORB._invokes");
     _theid_lock.name("ORB._theid_lock");
     _init_refs_lock.name("ORB._init_refs_lock");
     _value_facs.name("ORB._value_facs");
 #endif // DEBUG_NAMES
     _tmpl = new IOR;
+    _unindexed_adapters = 0;
+    _isa_cache = new MICO::IsACache (1024);
+    _invokes = new MICO::InvokeTable;
 }
 
 CORBA::ORB::~ORB ()
@@ -727,12 +857,8 @@ CORBA::ORB::~ORB ()
     assert(this->_disp != NULL);
     delete _disp;
     delete _tmpl;
-#ifndef HAVE_THREADS
-    // map<MsgId, ORBInvokeRec *, less<MsgId> >::iterator i;
-    // for (i = _invokes.begin(); i != _invokes.end(); ++i)
-    //     delete (*i).second;
-    _invokes.erase(_invokes.begin(), _invokes.end());
-#endif // HAVE_THREADS
+    delete _isa_cache;
+    delete _invokes;
     if (iiop_proxy_instance != NULL) {
 	delete iiop_proxy_instance;
 	iiop_proxy_instance = NULL;
@@ -745,7 +871,6 @@ CORBA::ORB::~ORB ()
 #ifdef HAVE_THREADS
     MICO::MTManager::free();
     MICOMT::Thread::delete_key(_current_rec_key);
-    MICOMT::Thread::delete_key(_invokes_key);
 
     assert(this->dispatcher_factory_ != NULL);
     delete this->dispatcher_factory_;
@@ -1589,15 +1714,16 @@ CORBA::ORB::get_default_domain_manager (DomainManager_out dm)
 
 	// install default policies ...
 	MICOPolicy::TransportPrefPolicy::ProfileTagSeq prefs;
-	prefs.length (7);
+	prefs.length (8);
 
 	prefs[0] = CORBA::IORProfile::TAG_INTERNET_IOP;
 	prefs[1] = CORBA::IORProfile::TAG_UNIX_IOP;
-	prefs[2] = CORBA::IORProfile::TAG_UDP_IOP;
-	prefs[3] = CORBA::IORProfile::TAG_SSL_INTERNET_IOP;
-	prefs[4] = CORBA::IORProfile::TAG_SSL_UNIX_IOP;
-	prefs[5] = CORBA::IORProfile::TAG_SSL_UDP_IOP;
-	prefs[6] = CORBA::IORProfile::TAG_LTP_IOP;
+	prefs[2] = CORBA::IORProfile::TAG_SHM_IOP;
+	prefs[3] = CORBA::IORProfile::TAG_UDP_IOP;
+	prefs[4] = CORBA::IORProfile::TAG_SSL_INTERNET_IOP;
+	prefs[5] = CORBA::IORProfile::TAG_SSL_UNIX_IOP;
+	prefs[6] = CORBA::IORProfile::TAG_SSL_UDP_IOP;
+	prefs[7] = CORBA::IORProfile::TAG_LTP_IOP;
 
 	MICOPolicy::TransportPrefPolicy_var tpp =
 	    new MICO::TransportPrefPolicy_impl (prefs);
@@ -1659,15 +1785,19 @@ CORBA::ORB::send_multiple_requests_deferred (const RequestSeq &req)
     }
 }
 
+static CORBA::Boolean
+completed_local_request (CORBA::ORBInvokeRec *rec)
+{
+    return rec->request_type() == CORBA::RequestInvoke &&
+	rec->completed() &&
+	!strcmp (rec->request()->type(), "local");
+}
+
 CORBA::Boolean
 CORBA::ORB::poll_next_response ()
 {
     MICO_OBJ_CHECK (this);
 
-    ORBInvokeRec *rec;
-    ORBRequest *orbreq;
-
-#ifndef HAVE_THREADS
 #ifdef USE_ORB_CACHE
     if (_cache_used) {
       if (_cache_rec->request_type() == RequestInvoke &&
@@ -1678,58 +1808,9 @@ CORBA::ORB::poll_next_response ()
     }
 #endif
 
-    for (InvokeMap::iterator i = _invokes.begin(); i != _invokes.end(); ++i) {
-	rec = (*i).second;
-	orbreq = rec->request ();
-	if (rec->request_type() == RequestInvoke &&
-	    rec->completed() &&
-	    !strcmp (orbreq->type(), "local")) {
-	    // found a local request that has completed
-	    return TRUE;
-	}
-    }
-#else // HAVE_THREADS
-    // first try to search thread's own request map
-    MICOMT::Locked<InvokeMap>* map = static_cast<MICOMT::Locked<InvokeMap>*>
-        (MICOMT::Thread::get_specific(_invokes_key));
-    if (map != NULL) {
-        AutoLock l(*map);
-        for (InvokeMap::iterator i = map->begin();
-             i != map->end();
-             i++) {
-            rec = (*i).second;
-            orbreq = rec->request ();
-            if (rec->request_type() == RequestInvoke &&
-                rec->completed() &&
-                !strcmp (orbreq->type(), "local")) {
-                // found a local request that has completed
-                return TRUE;
-            }
-        }
-    }
-    // let's try to search whole global map now
-    {
-        MICOMT::AutoLock l(_invokes);
-        for (ThreadIDInvokeMap::iterator i = _invokes.begin();
-             i != _invokes.end();
-             i++) {
-            MICOMT::Locked<InvokeMap>* map = (*i).second;
-            AutoLock l2(*map);
-            for (InvokeMap::iterator j = map->begin();
-                 j != map->end();
-                 j++) {
-                rec = (*j).second;
-                orbreq = rec->request ();
-                if (rec->request_type() == RequestInvoke &&
-                    rec->completed() &&
-                    !strcmp (orbreq->type(), "local")) {
-                    // found a local request that has completed
-                    return TRUE;
-                }
-            }
-        }
-    }
-#endif // HAVE_THREADS
+    ORBInvokeRec_var rec = _invokes->find (completed_local_request);
+    if (rec.in())
+	return TRUE;
     return FALSE;
 }
 
@@ -1738,10 +1819,6 @@ CORBA::ORB::get_next_response (Request_out req)
 {
     MICO_OBJ_CHECK (this);
 
-    ORBInvokeRec *rec;
-    ORBRequest *orbreq;
-
-#ifndef HAVE_THREADS
 #ifdef USE_ORB_CACHE
     if (_cache_used) {
       if (_cache_rec->request_type() == RequestInvoke &&
@@ -1754,64 +1831,12 @@ CORBA::ORB::get_next_response (Request_out req)
     }
 #endif
 
-    for (InvokeMap::iterator i = _invokes.begin(); i != _invokes.end(); ++i) {
-	rec = (*i).second;
-	orbreq = rec->request ();
-	if (rec->request_type() == RequestInvoke &&
-	    rec->completed() &&
-	    !strcmp (orbreq->type(), "local")) {
-	    // found a local request that has completed
-	    req = Request::_duplicate
-		(((MICO::LocalRequest *)orbreq)->request());
-	    return;
-	}
-    }
-#else // HAVE_THREADS
-    // first try to search thread's own request map
-    MICOMT::Locked<InvokeMap>* map = static_cast<MICOMT::Locked<InvokeMap>*>
-        (MICOMT::Thread::get_specific(_invokes_key));
-    if (map != NULL) {
-        AutoLock l(*map);
-        for (InvokeMap::iterator i = map->begin();
-             i != map->end();
-             i++) {
-            rec = (*i).second;
-            orbreq = rec->request ();
-            if (rec->request_type() == RequestInvoke &&
-                rec->completed() &&
-                !strcmp (orbreq->type(), "local")) {
-                // found a local request that has completed
-                req = Request::_duplicate
-                    (((MICO::LocalRequest *)orbreq)->request());
-                return;
-            }
-        }
-    }
-    // let's try to search whole global map now
-    {
-        MICOMT::AutoLock l(_invokes);
-        for (ThreadIDInvokeMap::iterator i = _invokes.begin();
-             i != _invokes.end();
-             i++) {
-            MICOMT::Locked<InvokeMap>* map = (*i).second;
-            AutoLock l2(*map);
-            for (InvokeMap::iterator j = map->begin();
-                 j != map->end();
-                 j++) {
-                rec = (*j).second;
-                orbreq = rec->request ();
-                if (rec->request_type() == RequestInvoke &&
-                    rec->completed() &&
-                    !strcmp (orbreq->type(), "local")) {
-                    // found a local request that has completed
-                    req = Request::_duplicate
-                        (((MICO::LocalRequest *)orbreq)->request());
-                    return;
-                }
-            }
-        }
+    ORBInvokeRec_var rec = _invokes->find (completed_local_request);
+    if (rec.in()) {
+	req = Request::_duplicate
+	    (((MICO::LocalRequest *)rec->request())->request());
+	return;
     }
-#endif // HAVE_THREADS
     req = Request::_nil();
 }
 
@@ -2053,6 +2078,10 @@ CORBA::ORB::list_initial_services ()
 	idlist->length (j+1);
 	(*idlist)[j++] = (const char *)"PICurrent";
     }
+    if (!_init_refs.count ("MetricsRegistry")) {
+	idlist->length (j+1);
+	(*idlist)[j++] = (const char *)"MetricsRegistry";
+    }
     return idlist;
 }
 
@@ -2105,6 +2134,8 @@ CORBA::ORB::_resolve_initial_references (const char *id)
 	    _init_refs[id] = new PICodec::CodecFactory_impl;
 	} else if (!strcmp (id, "PICurrent")) {
 	    _init_refs[id] = new PInterceptor::Current_impl;
+	} else if (!strcmp (id, "MetricsRegistry")) {
+	    _init_refs[id] = new MICOMetrics::Registry_impl;
         } else if (!strcmp (id, "ORBPolicyManager")) {
             _init_refs[id] = new MICO::PolicyManager_impl;
         } else if (!strcmp (id, "PolicyCurrent")) {
@@ -2381,28 +2412,7 @@ CORBA::ORB::add_invoke (ORBInvokeRec *rec)
 	MICO::Logger::Stream (MICO::Logger::ORB)
 	    << "ORB::add_invoke (MsgId="<< rec->id() << ")" << endl;
     }
-#ifndef HAVE_THREADS
-    // kcg: if this assert ever fails, then we need to implement
-    // new msgid colision checking into ORB::new_msgid method
-    assert(_invokes.count(rec->id()) == 0);
-    _invokes[rec->id()] = ORBInvokeRec::_duplicate(rec);
-#else // HAVE_THREADS
-    MICOMT::Locked<InvokeMap>* map = static_cast<MICOMT::Locked<InvokeMap>*>
-        (MICOMT::Thread::get_specific(_invokes_key));
-    if (map == NULL) {
-        map = new MICOMT::Locked<InvokeMap>();
-        MICOMT::Thread::set_specific(_invokes_key, map);
-        MICOMT::AutoLock lock(_invokes);
-        _invokes[MICOMT::Thread::self()] = map;
-    }
-    {
-        AutoLock l2(*map);
-        // kcg: if this assert ever fails, then we need to implement
-        // new msgid colision checking into ORB::new_msgid method
-        assert(map->count(rec->id()) == 0);
-        (*map)[rec->id()] = ORBInvokeRec::_duplicate(rec);
-    }
-#endif // HAVE_THREADS
+    _invokes->add (rec);
 }
 
 CORBA::ORBInvokeRec *
@@ -2418,39 +2428,7 @@ CORBA::ORB::get_invoke (MsgId id)
 	MICO::Logger::Stream (MICO::Logger::ORB)
 	    << "ORB::get_invoke (MsgId="<< id << ")" << endl;
     }
-#ifndef HAVE_THREADS
-    map<MsgId, ORBInvokeRec_var, less<MsgId> >::iterator i;
-    i = _invokes.find (id);
-    if (i == _invokes.end()) {
-	return NULL;
-    }
-    CORBA::ORBInvokeRec_var rec = CORBA::ORBInvokeRec::_duplicate((*i).second);
-#else // HAVE_THREADS
-    MICOMT::Locked<InvokeMap>* map = static_cast<MICOMT::Locked<InvokeMap>*>
-        (MICOMT::Thread::get_specific(_invokes_key));
-    CORBA::ORBInvokeRec_var rec = CORBA::ORBInvokeRec::_nil();
-    if (map != NULL) {
-        AutoLock l(*map);
-        InvokeMap::iterator i = map->find(id);
-        if (i != map->end()) {
-            rec = CORBA::ORBInvokeRec::_duplicate((*i).second);
-            return rec._retn();
-        }
-    }
-    AutoLock l(_invokes);
-    for (ThreadIDInvokeMap::iterator i = _invokes.begin();
-         i != _invokes.end();
-         i++) {
-        Locked<InvokeMap>* map = (*i).second;
-        AutoLock l2(*map);
-        InvokeMap::iterator it = map->find(id);
-        if (it != map->end()) {
-            rec = CORBA::ORBInvokeRec::_duplicate((*it).second);
-            return rec._retn();
-        }
-    }
-#endif // HAVE_THREADS
-    return rec._retn();
+    return _invokes->get (id);
 }
 
 void
@@ -2469,41 +2447,7 @@ CORBA::ORB::del_invoke (MsgId id)
 	MICO::Logger::Stream (MICO::Logger::ORB)
 	    << "ORB::del_invoke (MsgId="<< id << ")" << endl;
     }
-#ifndef HAVE_THREADS
-    map<MsgId, ORBInvokeRec_var, less<MsgId> >::iterator i;
-    i = _invokes.find (id);
-    if (i != _invokes.end()) {
-	//delete (*i).second;
-	_invokes.erase (i);
-    }
-#else // HAVE_THREADS
-    MICOMT::Locked<InvokeMap>* map = static_cast<MICOMT::Locked<InvokeMap>*>
-        (MICOMT::Thread::get_specific(_invokes_key));
-    if (map != NULL) {
-        AutoLock l(*map);
-        InvokeMap::iterator i = map->find(id);
-        if (i != map->end()) {
-            //delete (*i).second;
-            //cerr << "ORB::del_invoke _refcnt(): " << (*i).second->_refcnt() << endl;
-            map->erase(i);
-            return;
-        }
-    }
-    AutoLock l(_invokes);
-    for (ThreadIDInvokeMap::iterator i = _invokes.begin();
-         i != _invokes.end();
-         i++) {
-        Locked<InvokeMap>* map = (*i).second;
-        AutoLock l2(*map);
-        InvokeMap::iterator it = map->find(id);
-        if (it != map->end()) {
-            //delete (*it).second;
-            //cerr << "ORB::del_invoke2 _refcnt(): " << (*it).second->_refcnt() << endl;
-            map->erase(it);
-            return;
-        }
-    }
-#endif // HAVE_THREADS
+    _invokes->remove (id);
 }
 
 void
@@ -2603,6 +2547,7 @@ CORBA::ORB::register_oa (ObjectAdapter *oa)
   MICOMT::AutoWRLock l(_adapters);
 
   _adapters.push_back (oa);
+  reindex_oas ();
 }
 
 void
@@ -2616,6 +2561,53 @@ CORBA::ORB::unregister_oa (ObjectAdapter *oa)
 	else
 	    ++i;
     }
+    reindex_oas ();
+}
+
+/*
+ * object keys are indexed by their leading part up to the first
+ * slash, which covers the transient "/<pid>/<time>" and the persistent
+ * "<impl name>/" keys of the POA.
+ */
+static inline string
+oa_key_segment (const CORBA::Octet *key, CORBA::Long length)
+{
+    CORBA::Long i = 1;
+    while (i < length && key[i] != '/')
+	++i;
+    return string ((const char *)key, i < length ? i : length);
+}
+
+void
+CORBA::ORB::reindex_oas ()
+{
+    // called with _adapters write locked
+    _oa_index.clear ();
+    _remote_adapters.clear ();
+    _unindexed_adapters = 0;
+
+    for (ULong i = 0; i < _adapters.size(); ++i) {
+	ObjectAdapter *oa = _adapters[i];
+	if (!oa->is_local()) {
+	    _remote_adapters.push_back (oa);
+	    continue;
+	}
+	vector<string> prefixes;
+	oa->get_key_prefixes (prefixes);
+	if (prefixes.size() == 0) {
+	    ++_unindexed_adapters;
+	    continue;
+	}
+	for (mico_vec_size_type j = 0; j < prefixes.size(); ++j) {
+	    if (prefixes[j].length() == 0)
+		continue;
+	    string seg = oa_key_segment (
+		(const Octet *)prefixes[j].data(), prefixes[j].length());
+	    // first registered adapter wins, as with the linear search
+	    if (_oa_index.find (seg) == _oa_index.end())
+		_oa_index[seg] = oa;
+	}
+    }
 }
 
 void
@@ -2681,9 +2673,33 @@ CORBA::ORB::get_oa (Object_ptr o)
 {
   MICOMT::AutoRDLock l(_adapters);
 
-  Boolean local = is_local (o);
+  if (!is_local (o)) {
+    for (ULong i0 = 0; i0 < _remote_adapters.size(); ++i0) {
+      if (_remote_adapters[i0]->has_object (o))
+	return _remote_adapters[i0];
+    }
+    return NULL;
+  }
+
+  IORProfile *prof;
+  if (o->_ior() && (prof = o->_ior()->profile())) {
+    Long length;
+    const Octet *key = prof->objectkey (length);
+    if (key && length >= 0) {
+      OAIndex::iterator i = _oa_index.find (oa_key_segment (key, length));
+      if (i != _oa_index.end() && (*i).second->has_object (o))
+	return (*i).second;
+      /*
+       * when every local adapter has told us its keys, nobody else will
+       * claim this one. unplugged, the POA takes all mobile objects.
+       */
+      if (_unindexed_adapters == 0 && _is_plugged)
+	return NULL;
+    }
+  }
+
   for (ULong i0 = 0; i0 < _adapters.size(); ++i0) {
-    if (_adapters[i0]->is_local() == local && _adapters[i0]->has_object (o))
+    if (_adapters[i0]->is_local() && _adapters[i0]->has_object (o))
       return _adapters[i0];
   }
   return NULL;
@@ -2786,7 +2802,8 @@ CORBA::ORB::invoke_async (Object_ptr obj,
     try {
 	rec->init_invoke (this, obj, req, pr, response_exp, cb, oa);
     } catch (...) {
-	return id;
+	// the caller gets a reference, like below
+	return rec._retn();
     }
 
 #ifdef USE_SL3
@@ -3340,27 +3357,196 @@ CORBA::ORB::get_component (Object_ptr obj)
     return Object::_duplicate (comp);
 }
 
+/************************** IsACache ****************************/
+
+
+MICO::IsACache::IsACache (CORBA::ULong cap)
+{
+    for (int i = 0; i < NSHARDS; ++i) {
+	_shards[i].lru_first = _shards[i].lru_last = 0;
+	_shards[i].size = 0;
+	_shards[i].hits = _shards[i].misses = 0;
+    }
+    _capacity = 0;
+    capacity (cap);
+}
+
+MICO::IsACache::~IsACache ()
+{
+    for (int i = 0; i < NSHARDS; ++i)
+	clear (_shards[i]);
+}
+
+/*
+ * FNV-1a
+ */
+CORBA::ULong
+MICO::IsACache::hash (const char *s)
+{
+    CORBA::ULong h = 2166136261U;
+    for ( ; *s; ++s)
+	h = (h ^ (CORBA::Octet)*s) * 16777619U;
+    return h;
+}
+
+void
+MICO::IsACache::clear (Shard &s)
+{
+    Entry *e = s.lru_first;
+    while (e) {
+	Entry *n = e->lru_next;
+	delete e;
+	e = n;
+    }
+    s.lru_first = s.lru_last = 0;
+    s.size = 0;
+    for (mico_vec_size_type i = 0; i < s.chains.size(); ++i)
+	s.chains[i] = 0;
+}
+
+void
+MICO::IsACache::unlink (Shard &s, Entry *e)
+{
+    if (e->lru_prev)
+	e->lru_prev->lru_next = e->lru_next;
+    else
+	s.lru_first = e->lru_next;
+    if (e->lru_next)
+	e->lru_next->lru_prev = e->lru_prev;
+    else
+	s.lru_last = e->lru_prev;
+    e->lru_prev = e->lru_next = 0;
+}
+
+void
+MICO::IsACache::capacity (CORBA::ULong cap)
+{
+    _capacity = cap;
+
+    CORBA::ULong max = (cap + NSHARDS - 1) / NSHARDS;
+    CORBA::ULong nchains = 4;
+    while (nchains < max)
+	nchains *= 2;
+
+    for (int i = 0; i < NSHARDS; ++i) {
+	MICOMT::AutoLock l(_shards[i].lock);
+	clear (_shards[i]);
+	_shards[i].max = max;
+	_shards[i].chains.assign (nchains, (Entry *)0);
+    }
+}
+
 CORBA::Boolean
-CORBA::ORB::is_a (Object_ptr obj, const char *repo_id)
+MICO::IsACache::lookup (const char *objid, const char *repoid)
 {
-    {
-        MICOMT::AutoLock l(_isa_cache);
-
-        // XXX this assumes RepoIds are globally unique
-        if (*obj->_repoid()) {
-            string key = string(obj->_repoid()) + "$" + repo_id;
-            list<string>::iterator i;
-            for (i = _isa_cache.begin(); i != _isa_cache.end(); ++i) {
-                if (*i == key)
-                    break;
-            }
-            if (i != _isa_cache.end()) {
-                _isa_cache.erase (i);
-                _isa_cache.push_front (key);
-                return TRUE;
-            }
-        }
+    CORBA::ULong oh = hash (objid);
+    CORBA::ULong rh = hash (repoid);
+    CORBA::ULong h = oh * 31 + rh;
+    Shard &s = shard (h);
+
+    MICOMT::AutoLock l(s.lock);
+
+    Entry *e = s.chains[h & (s.chains.size()-1)];
+    for ( ; e; e = e->next) {
+	if (e->objhash == oh && e->repohash == rh &&
+	    e->objid == objid && e->repoid == repoid)
+	    break;
+    }
+    if (!e) {
+	++s.misses;
+	return FALSE;
+    }
+    ++s.hits;
+    if (e != s.lru_first) {
+	unlink (s, e);
+	e->lru_next = s.lru_first;
+	s.lru_first->lru_prev = e;
+	s.lru_first = e;
+    }
+    return TRUE;
+}
+
+void
+MICO::IsACache::insert (const char *objid, const char *repoid)
+{
+    CORBA::ULong oh = hash (objid);
+    CORBA::ULong rh = hash (repoid);
+    CORBA::ULong h = oh * 31 + rh;
+    Shard &s = shard (h);
+
+    MICOMT::AutoLock l(s.lock);
+
+    if (s.max == 0)
+	return;
+
+    Entry **chain = &s.chains[h & (s.chains.size()-1)];
+    for (Entry *e = *chain; e; e = e->next) {
+	if (e->objhash == oh && e->repohash == rh &&
+	    e->objid == objid && e->repoid == repoid)
+	    return;
     }
+
+    if (s.size >= s.max) {
+	// drop the least recently used entry
+	Entry *old = s.lru_last;
+	CORBA::ULong oldh = old->objhash * 31 + old->repohash;
+	Entry **p = &s.chains[oldh & (s.chains.size()-1)];
+	while (*p != old)
+	    p = &(*p)->next;
+	*p = old->next;
+	unlink (s, old);
+	delete old;
+	--s.size;
+    }
+
+    Entry *e = new Entry;
+    e->objhash = oh;
+    e->repohash = rh;
+    e->objid = objid;
+    e->repoid = repoid;
+    e->next = *chain;
+    *chain = e;
+    e->lru_prev = 0;
+    e->lru_next = s.lru_first;
+    if (s.lru_first)
+	s.lru_first->lru_prev = e;
+    else
+	s.lru_last = e;
+    s.lru_first = e;
+    ++s.size;
+}
+
+void
+MICO::IsACache::stats (CORBA::ULong &hits, CORBA::ULong &misses)
+{
+    hits = misses = 0;
+    for (int i = 0; i < NSHARDS; ++i) {
+	MICOMT::AutoLock l(_shards[i].lock);
+	hits += _shards[i].hits;
+	misses += _shards[i].misses;
+    }
+}
+
+
+void
+CORBA::ORB::isa_cache_size (ULong size)
+{
+    _isa_cache->capacity (size);
+}
+
+void
+CORBA::ORB::isa_cache_stats (ULong &hits, ULong &misses)
+{
+    _isa_cache->stats (hits, misses);
+}
+
+CORBA::Boolean
+CORBA::ORB::is_a (Object_ptr obj, const char *repo_id)
+{
+    // XXX this assumes RepoIds are globally unique
+    if (*obj->_repoid() && _isa_cache->lookup (obj->_repoid(), repo_id))
+        return TRUE;
+
     // [12-17]
     Request_var req = obj->_request ("_is_a");
     req->add_in_arg ("logical_type_id") <<= repo_id;
@@ -3377,12 +3563,7 @@ CORBA::ORB::is_a (Object_ptr obj, const char *repo_id)
 	obj->_ior()->objid (repo_id);
       }
       else {
-        MICOMT::AutoLock l(_isa_cache);
-	string key = string(obj->_repoid()) + "$" + repo_id;
-        _isa_cache.push_front (key);
-        // XXX CACHE size = 50
-        if (_isa_cache.size() > 50)
-	  _isa_cache.pop_back();
+        _isa_cache->insert (obj->_repoid(), repo_id);
       }
     }
     return res;
@@ -3472,27 +3653,6 @@ CORBA::ORB::validate_connection
 }
 
 
-#ifdef HAVE_THREADS
-CORBA::Boolean
-CORBA::ORB::remove_thread_invocations_map(void* thrmap)
-{
-    // kcg: removes just one empty invocation map
-    // it is intended to be called by thread cleanup
-    // method
-    MICOMT::AutoLock l(_invokes);
-    for (ThreadIDInvokeMap::iterator i = _invokes.begin();
-         i != _invokes.end();
-         i++) {
-        if ((*i).second == thrmap) {
-            delete (*i).second;
-            _invokes.erase(i);
-            return TRUE;
-        }
-    }
-    return FALSE;
-}
-#endif // HAVE_THREADS
-
 /************************** PrincipalCurrent *************************/
 
 
@@ -3531,6 +3691,67 @@ CORBA::ORB_instance (const char *id, Boolean create)
 
 void __mtdebug_init();
 
+// parse a size given in bytes with an optional k or m suffix
+static CORBA::ULong
+ORB_parse_size (const string &str, const char *what)
+{
+    CORBA::ULong size = 0;
+    const char *p = str.c_str();
+    while (*p) {
+      switch (*p) {
+      case '0': case '1': case '2': case '3': case '4':
+      case '5': case '6': case '7': case '8': case '9':
+	size = 10*size + (int) (*p - '0');
+	break;
+      case 'k': case 'K':
+	size *= 1024;
+	break;
+      case 'm': case 'M':
+	size *= 1024*1024;
+	break;
+      default:
+	if (MICO::Logger::IsLogged (MICO::Logger::Error)) {
+	  MICOMT::AutoDebugLock lock;  
+	  MICO::Logger::Stream (MICO::Logger::Error)
+	    << "Error: ORB_init(): illegal " << what << " "
+	    << str << endl;
+	}
+	mico_throw (CORBA::INITIALIZE());
+      }
+      p++;
+    }
+    return size;
+}
+
+#ifdef HAVE_THREADS
+// parse a list of CPU numbers and ranges like 0-3,6
+static void
+ORB_parse_cpus (const string &str, vector<unsigned int> &cpus)
+{
+    const char *p = str.c_str();
+    while (*p) {
+      char *end;
+      unsigned long first = strtoul (p, &end, 10);
+      unsigned long last = first;
+      if (end != p && *end == '-') {
+	p = end + 1;
+	last = strtoul (p, &end, 10);
+      }
+      if (end == p || last < first || (*end && *end != ',')) {
+	if (MICO::Logger::IsLogged (MICO::Logger::Error)) {
+	  MICOMT::AutoDebugLock lock;
+	  MICO::Logger::Stream (MICO::Logger::Error)
+	    << "Error: ORB_init(): illegal CPU list " << str << endl;
+	}
+	mico_throw (CORBA::INITIALIZE());
+      }
+      for (unsigned long cpu = first; cpu <= last; ++cpu)
+	cpus.push_back (cpu);
+      p = *end ? end + 1 : end;
+    }
+}
+#endif // HAVE_THREADS
+
 CORBA::ORB_ptr
 CORBA::ORB_init (int &argc, char **argv, const char *_id)
 {
@@ -3545,6 +3766,8 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     OSNet::sock_init();
 
     Exception::_init ();
+    Buffer::_init ();
+    TypeCode::_init ();
     Codeset::_init ();
     MICOPOA::_init ();
 #ifdef HAVE_SSL
@@ -3607,9 +3830,23 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     string giop_ver_str = "1.0";
     string iiop_ver_str = "1.0";
     string max_message_size_str;
+    string fragment_size_str;
+    string buffer_pool_limit_str;
+    Long tc_cache_entries = -1;
+    string tc_cache_limit_str;
+    string tc_cache_policy;
+    Long isa_cache_size = -1;
+    ULong conns_per_endpoint = 1;
+    Boolean metrics = FALSE;
+    string metrics_file;
+    ULong metrics_interval = 60;
 #ifdef HAVE_POLL_H
     Boolean use_poll = FALSE;
 #endif // HAVE_POLL_H
+#ifdef HAVE_SYS_EPOLL_H
+    Boolean use_epoll = FALSE;
+    Boolean epoll_et = FALSE;
+#endif // HAVE_SYS_EPOLL_H
 #ifdef HAVE_THREADS
     // Connection checking is disabled by default
     // for default thread-pool concurrency model
@@ -3619,6 +3856,12 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     ULong request_limit = 128; // kind of sane value for 2008
     Boolean thread_pool = FALSE;
     Boolean thread_per_connection = TRUE;
+    Boolean work_stealing = FALSE;
+    Boolean lockfree_channels = FALSE;
+    ULong request_queue_limit = 1024;
+    MICO::StealingThreadPool::OverflowPolicy request_queue_policy
+	= MICO::StealingThreadPool::Reject;
+    vector<unsigned int> thread_affinity;
     ClientConcurrencyModel client_concurrency_model = THREADED;
     Boolean use_current_inv_stack = TRUE;
 #endif // HAVE_THREADS
@@ -3681,9 +3924,22 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     opts["-ORBIIOPProxy"]     = "arg-expected";
     opts["-ORBIIOPBlocking"]  = "";
     opts["-ORBGIOPMaxSize"]   = "arg-expected";
+    opts["-ORBGIOPFragmentSize"] = "arg-expected";
+    opts["-ORBBufferPoolLimit"] = "arg-expected";
+    opts["-ORBTypeCodeCache"] = "arg-expected";
+    opts["-ORBTypeCodeCacheLimit"] = "arg-expected";
+    opts["-ORBTypeCodeCachePolicy"] = "arg-expected";
+    opts["-ORBIsACacheSize"]  = "arg-expected";
     opts["-ORBId"]            = "arg-expected";
     opts["-ORBConnLimit"]     = "arg-expected";
+    opts["-ORBConnectionsPerEndpoint"] = "arg-expected";
+#ifdef HAVE_SHM_TRANSPORT
+    opts["-ORBShmRingSize"]   = "arg-expected";
+#endif
     opts["-ORBRequestLimit"]  = "arg-expected";
+    opts["-ORBMetrics"]       = "";
+    opts["-ORBMetricsFile"]   = "arg-expected";
+    opts["-ORBMetricsInterval"] = "arg-expected";
     opts["-ORBImplRepoIOR"]   = "arg-expected";
     opts["-ORBImplRepoAddr"]  = "arg-expected";
     opts["-ORBIfaceRepoIOR"]  = "arg-expected";
@@ -3704,6 +3960,11 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     opts["-ORBNoResolve"]     = "";
     opts["-ORBThreadPool"]    = "";
     opts["-ORBThreadPerConnection"] = "";
+    opts["-ORBWorkStealing"]  = "";
+    opts["-ORBRequestQueueLimit"] = "arg-expected";
+    opts["-ORBRequestQueuePolicy"] = "arg-expected";
+    opts["-ORBThreadAffinity"] = "arg-expected";
+    opts["-ORBLockFreeQueues"] = "";
     opts["-ORBClientReactive"] = "";
     opts["-ORBClientThreaded"] = "";
     opts["-ORBClientThreadedBlocking"] = "";
@@ -3711,6 +3972,10 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 #ifdef HAVE_POLL_H
     opts["-ORBUsePoll"]       = "";
 #endif // HAVE_POLL_H
+#ifdef HAVE_SYS_EPOLL_H
+    opts["-ORBUseEpoll"]      = "";
+    opts["-ORBEpollEdgeTriggered"] = "";
+#endif // HAVE_SYS_EPOLL_H
 #ifdef USE_CSIV2
     opts["-ORBGSSClientUser"] = "arg-expected";
     opts["-ORBGSSServerUser"] = "arg-expected";
@@ -3797,10 +4062,44 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
             iiop_ver_str = val;
 	} else if (arg == "-ORBGIOPMaxSize") {
 	    max_message_size_str = val;
+	} else if (arg == "-ORBGIOPFragmentSize") {
+	    fragment_size_str = val;
+	} else if (arg == "-ORBBufferPoolLimit") {
+	    buffer_pool_limit_str = val;
+	} else if (arg == "-ORBTypeCodeCache") {
+	    tc_cache_entries = atoi (val.c_str ());
+	} else if (arg == "-ORBTypeCodeCacheLimit") {
+	    tc_cache_limit_str = val;
+	} else if (arg == "-ORBTypeCodeCachePolicy") {
+	    tc_cache_policy = val;
+	} else if (arg == "-ORBIsACacheSize") {
+	    isa_cache_size = atoi (val.c_str ());
+	} else if (arg == "-ORBConnectionsPerEndpoint") {
+	    conns_per_endpoint = atoi (val.c_str ());
+	    if (conns_per_endpoint < 1)
+		conns_per_endpoint = 1;
+	} else if (arg == "-ORBMetrics") {
+	    metrics = TRUE;
+	} else if (arg == "-ORBMetricsFile") {
+	    metrics = TRUE;
+	    metrics_file = val;
+	} else if (arg == "-ORBMetricsInterval") {
+	    metrics_interval = atoi (val.c_str ());
+#ifdef HAVE_SHM_TRANSPORT
+	} else if (arg == "-ORBShmRingSize") {
+	    MICO::ShmTransport::ring_size (atoi (val.c_str ()));
+#endif
 #ifdef HAVE_POLL_H
 	} else if (arg == "-ORBUsePoll") {
 	    use_poll = TRUE;
 #endif // HAVE_POLL_H
+#ifdef HAVE_SYS_EPOLL_H
+	} else if (arg == "-ORBUseEpoll") {
+	    use_epoll = TRUE;
+	} else if (arg == "-ORBEpollEdgeTriggered") {
+	    use_epoll = TRUE;
+	    epoll_et = TRUE;
+#endif // HAVE_SYS_EPOLL_H
 	}
 #ifdef HAVE_THREADS
         else if (arg == "-ORBThreadPool") {
@@ -3817,6 +4116,33 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 	    conn_limit = atoi (val.c_str ());
 	} else if (arg == "-ORBRequestLimit") {
 	    request_limit = atoi (val.c_str ());
+	} else if (arg == "-ORBWorkStealing") {
+	    work_stealing = TRUE;
+	    thread_pool = TRUE;
+	    thread_per_connection = FALSE;
+	    if (conn_limit != 0)
+		conn_limit = 0;
+	} else if (arg == "-ORBRequestQueueLimit") {
+	    request_queue_limit = atoi (val.c_str ());
+	} else if (arg == "-ORBRequestQueuePolicy") {
+	    if (val == "block") {
+		request_queue_policy = MICO::StealingThreadPool::Block;
+	    } else if (val == "transient") {
+		request_queue_policy = MICO::StealingThreadPool::Reject;
+	    } else {
+		if (MICO::Logger::IsLogged (MICO::Logger::Error)) {
+		    MICOMT::AutoDebugLock lock;
+		    MICO::Logger::Stream (MICO::Logger::Error)
+			<< "Error: ORB_init(): unknown request queue policy "
+			<< val << endl;
+		}
+		mico_throw (CORBA::INITIALIZE());
+	    }
+	} else if (arg == "-ORBThreadAffinity") {
+	    thread_affinity.clear ();
+	    ORB_parse_cpus (val, thread_affinity);
+	} else if (arg == "-ORBLockFreeQueues") {
+	    lockfree_channels = TRUE;
 	} else if (arg == "-ORBClientReactive") {
             client_concurrency_model = REACTIVE;
 	} else if (arg == "-ORBClientThreaded") {
@@ -3934,17 +4260,23 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
     // create ORB
     orb_instance = new ORB (argc, argv, rcfile.c_str());
 
-    // use poll dispatcher?
+    // use epoll or poll dispatcher?
+#ifdef HAVE_SYS_EPOLL_H
+    if (use_epoll) {
+        orb_instance->dispatcher_factory
+            (new MICO::EpollDispatcherFactory(epoll_et));
+    }
+    else
+#endif // HAVE_SYS_EPOLL_H
 #ifdef HAVE_POLL_H
     if (use_poll) {
         orb_instance->dispatcher_factory(new MICO::PollDispatcherFactory);
     }
-    else {
+    else
 #endif // HAVE_POLL_H
+    {
         orb_instance->dispatcher_factory(new MICO::SelectDispatcherFactory);
-#ifdef HAVE_POLL_H
     }
-#endif // HAVE_POLL_H
 
     orb_instance->dispatcher(orb_instance->create_dispatcher());
 
@@ -3967,14 +4299,17 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 	// this is a hack because MICO::SelectDispatcher::_isblocking
         // is private static and method block is not static
         CORBA::Dispatcher* disp;
-#ifdef HAVE_POLL_H
-        if (!use_poll)
-#endif // HAVE_POLL_H
-            disp = new MICO::SelectDispatcher;
-#ifdef HAVE_POLL_H
+#ifdef HAVE_SYS_EPOLL_H
+        if (use_epoll)
+            disp = new MICO::EpollDispatcher;
         else
+#endif // HAVE_SYS_EPOLL_H
+#ifdef HAVE_POLL_H
+        if (use_poll)
             disp = new MICO::PollDispatcher; 
+        else
 #endif // HAVE_POLL_H
+            disp = new MICO::SelectDispatcher;
         disp->block(TRUE);
         delete disp;
 	if (thread_per_connection) {
@@ -4011,6 +4346,11 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
         }
     }
     MICO::MTManager::client_concurrency_model(client_concurrency_model);
+    MICO::MTManager::lockfree_channels(lockfree_channels);
+    if (thread_pool && work_stealing)
+	MICO::MTManager::work_stealing_setup (request_queue_limit,
+					      request_queue_policy,
+					      thread_affinity);
     MICO::MTManager::thread_setup (conn_limit, request_limit);
     orb_instance->set_use_current_inv_stack(use_current_inv_stack);
 #endif
@@ -4219,32 +4559,53 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 
     CORBA::ULong max_message_size = 0;
     if (max_message_size_str.length() > 0) {
-      const char *p = max_message_size_str.c_str();
-      while (*p) {
-	switch (*p) {
-	case '0': case '1': case '2': case '3': case '4':
-	case '5': case '6': case '7': case '8': case '9':
-	  max_message_size = 10*max_message_size + (int) (*p - '0');
-	  break;
-	case 'k': case 'K':
-	  max_message_size *= 1024;
-	  break;
-	case 'm': case 'M':
-	  max_message_size *= 1024*1024;
-	  break;
-	default:
-	  if (MICO::Logger::IsLogged (MICO::Logger::Error)) {
-	    MICOMT::AutoDebugLock lock;  
-	    MICO::Logger::Stream (MICO::Logger::Error)
-	      << "Error: ORB_init(): illegal maximum message size "
-	      << max_message_size_str << endl;
-	  }
-	  mico_throw (CORBA::INITIALIZE());
+      max_message_size = ORB_parse_size (max_message_size_str,
+					 "maximum message size");
+    }
+
+    // set size of outgoing GIOP fragments, 0 sends messages in one piece
+
+    CORBA::ULong fragment_size = 0;
+    if (fragment_size_str.length() > 0) {
+      fragment_size = ORB_parse_size (fragment_size_str,
+				      "fragment size");
+    }
+
+    // set memory limit of the per thread buffer pools
+    if (buffer_pool_limit_str.length() > 0) {
+      CORBA::Buffer::pool_limit (ORB_parse_size (buffer_pool_limit_str,
+						 "buffer pool limit"));
+    }
+
+    // limits of the cache of decoded typecodes
+    if (tc_cache_entries >= 0 || tc_cache_limit_str.length() > 0 ||
+	tc_cache_policy.length() > 0) {
+      CORBA::TypeCode::CacheStats st;
+      CORBA::TypeCode::cache_stats (st);
+      CORBA::ULong entries = st.max_entries, bytes = st.max_bytes;
+      if (tc_cache_entries >= 0)
+	entries = tc_cache_entries;
+      if (tc_cache_limit_str.length() > 0)
+	bytes = ORB_parse_size (tc_cache_limit_str, "typecode cache limit");
+      if (tc_cache_policy.length() > 0 && tc_cache_policy != "lru" &&
+	  tc_cache_policy != "keep") {
+	if (MICO::Logger::IsLogged (MICO::Logger::Error)) {
+	  MICOMT::AutoDebugLock lock;
+	  MICO::Logger::Stream (MICO::Logger::Error)
+	    << "Error: ORB_init(): illegal typecode cache policy "
+	    << tc_cache_policy << endl;
 	}
-	p++;
+	mico_throw (CORBA::INITIALIZE());
       }
+      CORBA::Boolean lru = st.lru;
+      if (tc_cache_policy.length() > 0)
+	lru = (tc_cache_policy == "lru");
+      CORBA::TypeCode::cache_limits (entries, bytes, lru);
     }
 
+    if (isa_cache_size >= 0)
+      orb_instance->isa_cache_size (isa_cache_size);
+
     // set plugging status, terminal identifier, and redirect address
     orb_instance->plugged(plugged);
     if (!terminal_id_str.empty()) {
@@ -4260,11 +4621,26 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 	mtb_addr = CORBA::Address::parse(mtb_addr_str.c_str());
     }
 
+    // metrics, must be enabled before the first connection is made
+    if (metrics) {
+	MICO::Metrics::enable (TRUE);
+	if (metrics_file.length() > 0) {
+	    MICOMetrics::Registry_impl *registry =
+		new MICOMetrics::Registry_impl;
+	    registry->dump_periodically (metrics_file.c_str(),
+					 metrics_interval);
+	    orb_instance->set_initial_reference ("MetricsRegistry", registry);
+	    CORBA::release (registry);
+	}
+    }
+
     // create IIOP client
     orb_instance->dispatcher()->block (iiop_blocking);
     if (run_iiop_proxy) {
 	iiop_proxy_instance = new MICO::IIOPProxy (orb_instance, giop_ver,
-						   max_message_size);
+						   max_message_size,
+						   fragment_size);
+	iiop_proxy_instance->conns_per_endpoint (conns_per_endpoint);
 	if (!orb_instance->plugged()) {
 	    iiop_proxy_instance->redirect(mtb_addr);
 	}
@@ -4276,7 +4652,8 @@ CORBA::ORB_init (int &argc, char **argv, const char *_id)
 	    MICO::IIOPServer* iiop_server_instance
 		= new MICO::IIOPServer (orb_instance,
 					iiop_ver,
-					max_message_size);
+					max_message_size,
+					fragment_size);
 	    // server->set_conn_limit(conn_limit);
 	    for (mico_vec_size_type i = 0; i < iiopaddrs.size(); ++i) {
 		Address *addr = Address::parse (iiopaddrs[i].c_str());
@@ -19,6 +19,7 @@
 #include "transport/tcp.cc"
 #include "transport/udp.cc"
 #include "transport/unix.cc"
+#include "transport/shm.cc"
 #include "dispatch.cc"
 #include "typecode.cc"
 #include "util.cc"
@@ -70,6 +71,8 @@
 
 #include "reflection.cc"
 #include "mttypes.cc"
+#include "metrics.cc"
+#include "metrics_impl.cc"
 
 // needed by both CSIv2 and CSL2
 #if (defined(USE_CSL2)) || (defined(USE_CSIV2))
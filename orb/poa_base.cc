@@ -460,6 +460,27 @@ PortableServer::StubBase::_postinvoke ()
   _colocated_poa->postinvoke ();
 }
 
+/*
+ * Invoke a colocated servant for a request whose parameters cannot be
+ * copied by the stub. The arguments go through a CDR buffer, but the
+ * request does not go through the ORB and the object adapter.
+ */
+
+void
+PortableServer::StubBase::_invoke_local (PortableServer::Servant serv,
+					 CORBA::StaticRequest &req)
+{
+  req.local (TRUE);
+  {
+    CORBA::StaticServerRequest svreq (&req, this, CORBA::ORBInvokeRec::_nil(),
+				      0, CORBA::Principal::_nil());
+    // there is no invocation for the object adapter to answer
+    svreq.cancel ();
+    serv->doinvoke (&svreq);
+  }
+  req.local (FALSE);
+}
+
 /*
  * ObjectId to Sting mapping
  */
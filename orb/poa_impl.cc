@@ -450,6 +450,7 @@ MICOPOA::ObjectId::ObjectId ()
   oid = NULL;
   own = true;
   idlength = 0;
+  make_hash ();
 }
 
 MICOPOA::ObjectId::ObjectId (const ObjectId & id, bool copy)
@@ -463,6 +464,7 @@ MICOPOA::ObjectId::ObjectId (const ObjectId & id, bool copy)
   else {
     octets = (char *) id.octets;
   }
+  hashval = id.hashval;
 }
 
 MICOPOA::ObjectId::ObjectId (const PortableServer::ObjectId & id)
@@ -475,6 +477,7 @@ MICOPOA::ObjectId::ObjectId (const PortableServer::ObjectId & id)
   for (CORBA::ULong i=0; i<idlength; i++) {
     octets[i] = (char) id[i];
   }
+  make_hash ();
 }
 
 MICOPOA::ObjectId::ObjectId (const char * id, CORBA::ULong len, bool copy)
@@ -488,6 +491,7 @@ MICOPOA::ObjectId::ObjectId (const char * id, CORBA::ULong len, bool copy)
   else {
     octets = (char *) id;
   }
+  make_hash ();
 }
 
 MICOPOA::ObjectId::~ObjectId ()
@@ -508,15 +512,29 @@ MICOPOA::ObjectId::operator= (const ObjectId & id)
   oid = NULL;
   own = true;
   idlength = id.idlength;
+  hashval = id.hashval;
   octets = CORBA::string_alloc (idlength);
   memcpy (octets, id.octets, idlength);
   return *this;
 }
 
+/*
+ * FNV-1a
+ */
+
+void
+MICOPOA::ObjectId::make_hash ()
+{
+  hashval = 2166136261U;
+  for (CORBA::ULong i=0; i<idlength; i++) {
+    hashval = (hashval ^ (CORBA::Octet) octets[i]) * 16777619U;
+  }
+}
+
 CORBA::Boolean
-MICOPOA::ObjectId::operator== (const ObjectId & o)
+MICOPOA::ObjectId::operator== (const ObjectId & o) const
 {
-  if (idlength != o.idlength) {
+  if (idlength != o.idlength || hashval != o.hashval) {
     return FALSE;
   }
 
@@ -1240,13 +1258,14 @@ MICOPOA::UniqueIdGenerator::state (const char * st)
 
 MICOPOA::ObjectMap::ObjectRecord::ObjectRecord (POAObjectReference * _por,
 						PortableServer::Servant _serv)
-  : por (_por), serv (_serv)
+  : por (_por), serv (_serv), oid (_por->get_id())
 {
   por = _por;
   serv = _serv;
   active = TRUE;
   invoke_cnt = 0;
   delref = 0;
+  sv_prev = sv_next = NULL;
   serv->_add_ref ();
 }
 
@@ -1256,6 +1275,15 @@ MICOPOA::ObjectMap::ObjectRecord::~ObjectRecord ()
   serv->_remove_ref ();
 }
 
+MICOPOA::ObjectMap::ObjectMap ()
+{
+  objs = NULL;
+  nobjs = objcap = 0;
+  popslot = 0;
+  servants = NULL;
+  nservants = servcap = 0;
+}
+
 MICOPOA::ObjectMap::~ObjectMap ()
 {
   clear ();
@@ -1264,58 +1292,215 @@ MICOPOA::ObjectMap::~ObjectMap ()
 bool
 MICOPOA::ObjectMap::empty () const
 {
-  return objs.empty ();
+  return nobjs == 0;
 }
 
 void
 MICOPOA::ObjectMap::clear ()
 {
-  iterator it = objs.begin ();
-
-  while (it != objs.end()) {
-    delete (*it).second;
-    it++;
+  for (CORBA::ULong i=0; i<objcap; i++) {
+    delete objs[i].rec;
   }
 
-  objs.clear ();
-  servants.clear ();
+  delete[] objs;
+  objs = NULL;
+  nobjs = objcap = 0;
+  popslot = 0;
+
+  delete[] servants;
+  servants = NULL;
+  nservants = servcap = 0;
 }
 
 MICOPOA::ObjectMap::iterator
 MICOPOA::ObjectMap::begin ()
 {
-  return objs.begin ();
+  return iterator (objs, objs + objcap);
 }
 
 MICOPOA::ObjectMap::iterator
 MICOPOA::ObjectMap::end ()
 {
-  return objs.end ();
+  return iterator (objs + objcap, objs + objcap);
 }
 
-MICOPOA::ObjectMap::ObjectRecord *
-MICOPOA::ObjectMap::pop ()
+CORBA::ULong
+MICOPOA::ObjectMap::sv_hash (PortableServer::Servant serv)
 {
-  assert (!empty());
-  iterator oit = objs.begin ();
-  ObjectRecord * orec = (*oit).second;
-  objs.erase (oit);
+  CORBA::ULong h = (CORBA::ULong) (((unsigned long) serv >> 3) * 2654435761UL);
+  return h ^ (h >> 15);
+}
+
+/*
+ * Slot of an Object Id or Servant, -1 if it is not in the map
+ */
+
+CORBA::Long
+MICOPOA::ObjectMap::id_slot (const ObjectId & oid)
+{
+  if (nobjs == 0) {
+    return -1;
+  }
 
-  SvMap::iterator sit = servants.find (orec->serv);
-  assert (sit != servants.end());
+  CORBA::ULong mask = objcap - 1;
+  for (CORBA::ULong i = oid.hash() & mask; objs[i].rec; i = (i+1) & mask) {
+    if (objs[i].hash == oid.hash() && objs[i].rec->oid == oid) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+CORBA::Long
+MICOPOA::ObjectMap::sv_slot (PortableServer::Servant serv)
+{
+  if (nservants == 0) {
+    return -1;
+  }
+
+  CORBA::ULong mask = servcap - 1;
+  for (CORBA::ULong i = sv_hash (serv) & mask; servants[i].serv;
+       i = (i+1) & mask) {
+    if (servants[i].serv == serv) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*
+ * The tables are kept at most half full. On removal, the following
+ * entries of the probe sequence are shifted back so that no deleted
+ * markers are needed.
+ */
+
+void
+MICOPOA::ObjectMap::id_grow ()
+{
+  IdSlot * old = objs;
+  CORBA::ULong oldcap = objcap;
+
+  objcap = oldcap ? 2*oldcap : 16;
+  objs = new IdSlot[objcap]();
+  popslot = 0;
+
+  CORBA::ULong mask = objcap - 1;
+  for (CORBA::ULong i=0; i<oldcap; i++) {
+    if (old[i].rec) {
+      CORBA::ULong j = old[i].hash & mask;
+      while (objs[j].rec) {
+	j = (j+1) & mask;
+      }
+      objs[j] = old[i];
+    }
+  }
+  delete[] old;
+}
+
+void
+MICOPOA::ObjectMap::sv_grow ()
+{
+  SvSlot * old = servants;
+  CORBA::ULong oldcap = servcap;
+
+  servcap = oldcap ? 2*oldcap : 16;
+  servants = new SvSlot[servcap]();
+
+  CORBA::ULong mask = servcap - 1;
+  for (CORBA::ULong i=0; i<oldcap; i++) {
+    if (old[i].serv) {
+      CORBA::ULong j = sv_hash (old[i].serv) & mask;
+      while (servants[j].serv) {
+	j = (j+1) & mask;
+      }
+      servants[j] = old[i];
+    }
+  }
+  delete[] old;
+}
 
-  for (vector<ObjectRecord *>::iterator orit = (*sit).second.begin();
-       orit != (*sit).second.end(); orit++) {
-    if ((*orit) == orec) {
-      (*sit).second.erase (orit);
+void
+MICOPOA::ObjectMap::id_remove (CORBA::ULong i)
+{
+  CORBA::ULong mask = objcap - 1;
+  CORBA::ULong j = i;
+
+  for (;;) {
+    j = (j+1) & mask;
+    if (!objs[j].rec) {
+      break;
+    }
+    // the entry can stay if its home slot lies in (i, j]
+    CORBA::ULong k = objs[j].hash & mask;
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) {
+      continue;
+    }
+    objs[i] = objs[j];
+    i = j;
+  }
+  objs[i].rec = NULL;
+  nobjs--;
+}
+
+void
+MICOPOA::ObjectMap::sv_remove (CORBA::ULong i)
+{
+  CORBA::ULong mask = servcap - 1;
+  CORBA::ULong j = i;
+
+  for (;;) {
+    j = (j+1) & mask;
+    if (!servants[j].serv) {
       break;
     }
+    CORBA::ULong k = sv_hash (servants[j].serv) & mask;
+    if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) {
+      continue;
+    }
+    servants[i] = servants[j];
+    i = j;
   }
+  servants[i].serv = NULL;
+  servants[i].recs = NULL;
+  nservants--;
+}
 
-  if ((*sit).second.empty()) {
-    servants.erase (sit);
+/*
+ * remove a record from the list of its servant
+ */
+
+void
+MICOPOA::ObjectMap::unlink (ObjectRecord * orec)
+{
+  if (orec->sv_next) {
+    orec->sv_next->sv_prev = orec->sv_prev;
+  }
+  if (orec->sv_prev) {
+    orec->sv_prev->sv_next = orec->sv_next;
+  }
+  else {
+    CORBA::Long s = sv_slot (orec->serv);
+    assert (s >= 0 && servants[s].recs == orec);
+    if (orec->sv_next) {
+      servants[s].recs = orec->sv_next;
+    }
+    else {
+      sv_remove (s);
+    }
   }
+  orec->sv_prev = orec->sv_next = NULL;
+}
 
+MICOPOA::ObjectMap::ObjectRecord *
+MICOPOA::ObjectMap::pop ()
+{
+  assert (!empty());
+  while (!objs[popslot].rec) {
+    popslot = (popslot+1) & (objcap-1);
+  }
+  ObjectRecord * orec = objs[popslot].rec;
+  id_remove (popslot);
+  unlink (orec);
   return orec;
 }
 
@@ -1324,36 +1509,51 @@ MICOPOA::ObjectMap::add (POAObjectReference * por,
 			 PortableServer::Servant serv)
 {
   ObjectRecord * orec = new ObjectRecord (por, serv);
-  ObjectId oid (por->get_id());
-  assert (objs.find (oid) == objs.end());
+  assert (id_slot (orec->oid) < 0);
+
+  if (2*(nobjs+1) > objcap) {
+    id_grow ();
+  }
+  CORBA::ULong mask = objcap - 1;
+  CORBA::ULong i = orec->oid.hash() & mask;
+  while (objs[i].rec) {
+    i = (i+1) & mask;
+  }
+  objs[i].hash = orec->oid.hash();
+  objs[i].rec = orec;
+  nobjs++;
+
+  CORBA::Long s = sv_slot (serv);
+  if (s < 0) {
+    if (2*(nservants+1) > servcap) {
+      sv_grow ();
+    }
+    mask = servcap - 1;
+    s = sv_hash (serv) & mask;
+    while (servants[s].serv) {
+      s = (s+1) & mask;
+    }
+    servants[s].serv = serv;
+    servants[s].recs = NULL;
+    nservants++;
+  }
+  orec->sv_next = servants[s].recs;
+  if (orec->sv_next) {
+    orec->sv_next->sv_prev = orec;
+  }
+  servants[s].recs = orec;
 
-  objs[oid] = orec;
-  servants[serv].push_back (orec);
   return orec;
 }
 
 MICOPOA::ObjectMap::ObjectRecord *
 MICOPOA::ObjectMap::del (const ObjectId & oid)
 {
-  iterator it = objs.find (oid);
-  assert (it != objs.end());
-  ObjectRecord * orec = (*it).second;
-  SvMap::iterator sit = servants.find (orec->serv);
-  assert (sit != servants.end());
-
-  for (vector<ObjectRecord *>::iterator orit = (*sit).second.begin();
-       orit != (*sit).second.end(); orit++) {
-    if ((*orit) == orec) {
-      (*sit).second.erase (orit);
-      break;
-    }
-  }
-
-  if ((*sit).second.empty()) {
-    servants.erase (sit);
-  }
-
-  objs.erase (it);
+  CORBA::Long i = id_slot (oid);
+  assert (i >= 0);
+  ObjectRecord * orec = objs[i].rec;
+  id_remove (i);
+  unlink (orec);
   return orec;
 }
 
@@ -1366,7 +1566,7 @@ MICOPOA::ObjectMap::del (const PortableServer::ObjectId & id)
 bool
 MICOPOA::ObjectMap::exists (const ObjectId & oid)
 {
-  return (objs.find (oid) != objs.end());
+  return (id_slot (oid) >= 0);
 }
 
 bool
@@ -1380,25 +1580,23 @@ MICOPOA::ObjectMap::exists (const POAObjectReference & por)
 {
   // need to cast constness away
   POAObjectReference * nc = (POAObjectReference *) &por;
-  return (objs.find (nc->get_oid()) != objs.end());
+  return (id_slot (nc->get_oid()) >= 0);
 }
 
 bool
 MICOPOA::ObjectMap::exists (PortableServer::Servant serv)
 {
-  SvMap::iterator sit = servants.find (serv);
-  assert (sit==servants.end() || !(*sit).second.empty());
-  return (sit != servants.end());
+  return (sv_slot (serv) >= 0);
 }
 
 MICOPOA::ObjectMap::ObjectRecord *
 MICOPOA::ObjectMap::find (const ObjectId & oid)
 {
-  iterator it = objs.find (oid);
-  if (it == objs.end()) {
+  CORBA::Long i = id_slot (oid);
+  if (i < 0) {
     return NULL;
   }
-  return (*it).second;
+  return objs[i].rec;
 }
 
 MICOPOA::ObjectMap::ObjectRecord *
@@ -1456,12 +1654,12 @@ MICOPOA::ObjectMap::find (POA_impl * poa, CORBA::Object_ptr obj)
 MICOPOA::ObjectMap::ObjectRecord *
 MICOPOA::ObjectMap::find (PortableServer::Servant serv)
 {
-  SvMap::iterator sit = servants.find (serv);
-  if (sit == servants.end()) {
+  CORBA::Long s = sv_slot (serv);
+  if (s < 0) {
     return NULL;
   }
-  assert ((*sit).second.size() == 1);
-  return (*sit).second[0];
+  assert (!servants[s].recs->sv_next);
+  return servants[s].recs;
 }
 
 /*
@@ -3338,6 +3536,21 @@ MICOPOA::POA_impl::is_local () const
   return TRUE;
 }
 
+/*
+ * the keys has_object() accepts, apart from mobile ones
+ */
+
+void
+MICOPOA::POA_impl::get_key_prefixes (vector<string> &prefixes) const
+{
+  if (oaprefix.size() > 0) {
+    prefixes.push_back (oaprefix);
+  }
+  if (impl_name.size() > 0) {
+    prefixes.push_back (impl_name);
+  }
+}
+
 #ifdef USE_CSL2
 CORBA::Principal_ptr
 MICOPOA::POA_impl::get_principal(CORBA::Object_ptr obj){
@@ -4094,6 +4307,8 @@ MICOPOA::POA_impl::perform_invoke (InvocationRecord_ptr ir)
    */
 
   if (!builtin_invoke (ir, servant)) {
+    CORBA::ULongLong start =
+      MICO::Metrics::enabled() ? MICO::Metrics::now() : 0;
     CORBA::ServerRequestBase_ptr svr = ir->make_req (this, servant);
     if (thread_policy->value() == PortableServer::MAIN_THREAD_MODEL) {
       MICOMT::AutoLock t_lock(S_global_invoke_lock);
@@ -4104,6 +4319,15 @@ MICOPOA::POA_impl::perform_invoke (InvocationRecord_ptr ir)
     } else {
       servant->doinvoke (svr);
     }
+    if (start) {
+      // request latency per POA and operation
+      string hname = "request.";
+      hname += fqn.length() > 0 ? fqn : name;
+      hname += ".";
+      hname += ir->get_or()->op_name();
+      MICO::Metrics::record (MICO::Metrics::histogram (hname.c_str()),
+			     MICO::Metrics::now() - start);
+    }
   }
 
   current->unset ();
@@ -4159,7 +4383,7 @@ MICOPOA::POA_impl::bind (CORBA::ORBMsgId id, const char *repoid,
     for (ObjectMap::iterator it = ActiveObjectMap.begin ();
 	 it != ActiveObjectMap.end ();
 	 it++) {
-      ObjectMap::ObjectRecord * orec = (*it).second;
+      ObjectMap::ObjectRecord * orec = *it;
 
       /*
        * Try _is_a; if that doesn't work (maybe because it's a DSI
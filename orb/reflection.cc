@@ -344,7 +344,7 @@ CORBA::Any* Reflection::IFRProvider_stub::omg_get_ifr_metadata()
 {
   CORBA::StaticAny __res( CORBA::_stc_any );
 
-  CORBA::StaticRequest __req( this, "omg_get_ifr_metadata" );
+  CORBA::StaticRequest __req( this, "omg_get_ifr_metadata", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -397,7 +397,7 @@ char* Reflection::IFRProvider_stub::omg_get_xml_metadata()
   char* _res = NULL;
   CORBA::StaticAny __res( CORBA::_stc_string, &_res );
 
-  CORBA::StaticRequest __req( this, "omg_get_xml_metadata" );
+  CORBA::StaticRequest __req( this, "omg_get_xml_metadata", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -637,7 +637,7 @@ ATLAS::AuthTokenData* ATLAS::AuthTokenDispenser_stub::get_my_authorization_token
 {
   CORBA::StaticAny __res( _marshaller_ATLAS_AuthTokenData );
 
-  CORBA::StaticRequest __req( this, "get_my_authorization_token" );
+  CORBA::StaticRequest __req( this, "get_my_authorization_token", TRUE );
   __req.set_result( &__res );
 
   __req.invoke();
@@ -691,7 +691,7 @@ ATLAS::AuthTokenData* ATLAS::AuthTokenDispenser_stub::translate_authorization_to
   CORBA::StaticAny _sa_the_token( _marshaller__seq_CSI_AuthorizationElement, &_par_the_token );
   CORBA::StaticAny __res( _marshaller_ATLAS_AuthTokenData );
 
-  CORBA::StaticRequest __req( this, "translate_authorization_token" );
+  CORBA::StaticRequest __req( this, "translate_authorization_token", TRUE );
   __req.add_in_arg( &_sa_the_subject );
   __req.add_in_arg( &_sa_the_token );
   __req.set_result( &__res );
@@ -570,8 +570,8 @@ public:
     // XXX calling this multiple times with same v causes mem leaks
     CORBA::Boolean demarshal (CORBA::DataDecoder &dc, StaticValueType v) const
     {
-	*(_MICO_T *)v = new CORBA::TypeCode;
-	return dc.get_typecode (**(_MICO_T *)v);
+	*(_MICO_T *)v = CORBA::TypeCode::decode_shared (dc);
+	return !CORBA::is_nil (*(_MICO_T *)v);
     }
     void marshal (CORBA::DataEncoder &ec, StaticValueType v) const
     {
@@ -1199,6 +1199,11 @@ public:
 	CORBA::ULong len;
 	if (!dc.seq_begin (len))
 	    return FALSE;
+	SequenceLoan *l = dc.loan_chars (len);
+	if (l) {
+	    ((_MICO_T *)v)->_loan (l);
+	    return dc.seq_end();
+	}
 	((_MICO_T *)v)->length (len);
 	if (len > 0) {
 	    if (!dc.get_chars ((CORBA::Char *)&(*(_MICO_T *)v)[0], len))
@@ -1208,10 +1213,12 @@ public:
     }
     void marshal (CORBA::DataEncoder &ec, StaticValueType v) const
     {
-	CORBA::ULong len = ((_MICO_T *)v)->length();
+	// const, so a lent sequence is not copied
+	const _MICO_T *s = (const _MICO_T *)v;
+	CORBA::ULong len = s->length();
 	ec.seq_begin (len);
 	if (len > 0)
-	    ec.put_chars ((CORBA::Char *)&(*(_MICO_T *)v)[0], len);
+	    ec.put_chars (s->get_buffer(), len);
 	ec.seq_end ();
     }
     CORBA::TypeCode_ptr typecode ()
@@ -1382,6 +1389,11 @@ public:
 	CORBA::ULong len;
 	if (!dc.seq_begin (len))
 	    return FALSE;
+	SequenceLoan *l = dc.loan_octets (len);
+	if (l) {
+	    ((_MICO_T *)v)->_loan (l);
+	    return dc.seq_end();
+	}
 	((_MICO_T *)v)->length (len);
 	if (len > 0) {
 	    if (!dc.get_octets ((CORBA::Octet *)&(*(_MICO_T *)v)[0], len))
@@ -1391,10 +1403,12 @@ public:
     }
     void marshal (CORBA::DataEncoder &ec, StaticValueType v) const
     {
-	CORBA::ULong len = ((_MICO_T *)v)->length();
+	// const, so a lent sequence is not copied
+	const _MICO_T *s = (const _MICO_T *)v;
+	CORBA::ULong len = s->length();
 	ec.seq_begin (len);
 	if (len > 0)
-	    ec.put_octets ((CORBA::Octet *)&(*(_MICO_T *)v)[0], len);
+	    ec.put_octets (s->get_buffer(), len);
 	ec.seq_end ();
     }
     CORBA::TypeCode_ptr typecode ()
@@ -1733,14 +1747,22 @@ static struct InitStaticTypeInfo {
 //-----------------
 
 
-CORBA::StaticRequest::StaticRequest (CORBA::Object_ptr obj, const char *opname)
+CORBA::StaticRequest::StaticRequest (CORBA::Object_ptr obj, const char *opname,
+				     CORBA::Boolean static_opname)
 {
     if (!obj->_ior())
 	// locality constrained object
 	mico_throw (NO_IMPLEMENT());
 
     _id = ORBInvokeRec::_nil();
-    _opname = opname;
+    if (static_opname) {
+	_opname = opname;
+    } else {
+	_opname_copy = opname;
+	_opname = _opname_copy.in();
+    }
+    _nargs = 0;
+    _local = FALSE;
     _res = 0;
     _ctx = 0;
     _env = 0;
@@ -1811,20 +1833,77 @@ CORBA::StaticRequest::copy (StaticAnyList *dst, StaticAnyList *src,
     return TRUE;
 }
 
+/*
+ * copy the arguments in src selected by f (and the result sres) to
+ * those in dst (and dres) by marshalling them into a buffer and
+ * demarshalling them from it, like a remote call would.
+ */
+CORBA::Boolean
+CORBA::StaticRequest::copy_cdr (StaticAny *dres, StaticAnyList *dst,
+				StaticAny *sres, StaticAnyList *src,
+				CORBA::Flags f)
+{
+    MICO::CDREncoder ec;
+    MICO::CDRDecoder dc (ec.buffer(), FALSE, ec.byteorder(),
+			 ec.converter(), FALSE);
+
+    // share one state for all arguments
+    CORBA::DataEncoder::ValueState evstate;
+    CORBA::DataDecoder::ValueState dvstate;
+    ec.valuestate (&evstate, FALSE);
+    dc.valuestate (&dvstate, FALSE);
+
+    mico_vec_size_type i;
+    if (sres && !sres->marshal (ec))
+	return FALSE;
+    for (i = 0; i < src->size(); ++i) {
+	if (((*src)[i]->flags() & f) && !(*src)[i]->marshal (ec))
+	    return FALSE;
+    }
+    if (dres && !dres->demarshal (dc))
+	return FALSE;
+    for (i = 0; i < dst->size(); ++i) {
+	if (((*dst)[i]->flags() & f) && !(*dst)[i]->demarshal (dc))
+	    return FALSE;
+    }
+    return dc.buffer()->length() == 0;
+}
+
+CORBA::StaticRequest::StaticAnyList *
+CORBA::StaticRequest::args ()
+{
+    if (_args.empty()) {
+	for (CORBA::ULong i = 0; i < _nargs; ++i)
+	    _args.push_back (_inline[i]);
+    }
+    return &_args;
+}
+
+void
+CORBA::StaticRequest::add_arg (StaticAny *a, CORBA::Flags f)
+{
+    if (_args.empty() && _nargs < INLINE_ARGS) {
+	_inline[_nargs] = a;
+    } else {
+	args()->push_back (a);
+    }
+    ++_nargs;
+    a->flags (f);
+}
+
 CORBA::Boolean
 CORBA::StaticRequest::get_in_args (NVList_ptr iparams, Context_ptr &ctx)
 {
-    if (iparams->count() != _args.size())
+    if (iparams->count() != _nargs)
 	return FALSE;
 
     CORBA::NamedValue_ptr nv;
-    assert(_args.size() < UINT_MAX);
-    for (mico_vec_size_type i0 = 0; i0 < _args.size(); ++i0) {
-        nv = iparams->item ((CORBA::ULong)i0);
-	if (_args[i0]->flags() != nv->flags())
+    for (CORBA::ULong i0 = 0; i0 < _nargs; ++i0) {
+        nv = iparams->item (i0);
+	if (arg(i0)->flags() != nv->flags())
 	    return FALSE;
-	if (_args[i0]->flags() & (CORBA::ARG_IN|CORBA::ARG_INOUT)) {
-	    nv->value()->from_static_any (*_args[i0]);
+	if (arg(i0)->flags() & (CORBA::ARG_IN|CORBA::ARG_INOUT)) {
+	    nv->value()->from_static_any (*arg(i0));
 	}
     }
     ctx = CORBA::Context::_duplicate (_ctx);
@@ -1835,7 +1914,11 @@ CORBA::Boolean
 CORBA::StaticRequest::get_in_args (StaticAnyList *iparams,
 				   CORBA::Context_ptr &ctx)
 {
-    if (!copy (iparams, &_args, CORBA::ARG_IN|CORBA::ARG_INOUT))
+    if (_local) {
+	if (!copy_cdr (0, iparams, 0, args(),
+		       CORBA::ARG_IN|CORBA::ARG_INOUT))
+	    return FALSE;
+    } else if (!copy (iparams, args(), CORBA::ARG_IN|CORBA::ARG_INOUT))
         return FALSE;
     ctx = CORBA::Context::_duplicate (_ctx);
     return TRUE;
@@ -1844,16 +1927,16 @@ CORBA::StaticRequest::get_in_args (StaticAnyList *iparams,
 CORBA::Boolean
 CORBA::StaticRequest::get_in_args (DataEncoder *ec)
 {
-    if (_args.size() == 0 && CORBA::is_nil (_ctx))
+    if (_nargs == 0 && CORBA::is_nil (_ctx))
 	return TRUE;
 
     // share one state for all arguments
     CORBA::DataEncoder::ValueState vstate;
     ec->valuestate (&vstate, FALSE);
 
-    for (mico_vec_size_type i = 0; i < _args.size(); ++i) {
-	if (_args[i]->flags() & (CORBA::ARG_IN|CORBA::ARG_INOUT)) {
-	    if (!_args[i]->marshal (*ec))
+    for (CORBA::ULong i = 0; i < _nargs; ++i) {
+	if (arg(i)->flags() & (CORBA::ARG_IN|CORBA::ARG_INOUT)) {
+	    if (!arg(i)->marshal (*ec))
 		return FALSE;
 	    // Release the memory of inout parameters which are
 	    // managed through a pointer (e.g., string, interface,...)
@@ -1885,7 +1968,7 @@ CORBA::StaticRequest::get_out_args (Any *res, NVList_ptr oparams,
 	return TRUE;
     }
 
-    if (oparams->count() != _args.size())
+    if (oparams->count() != _nargs)
 	return FALSE;
 
     if (res && _res) {
@@ -1893,13 +1976,12 @@ CORBA::StaticRequest::get_out_args (Any *res, NVList_ptr oparams,
     }
 
     CORBA::NamedValue_ptr nv;
-    assert(_args.size() < UINT_MAX);
-    for (mico_vec_size_type i0 = 0; i0 < _args.size(); ++i0) {
-        nv = oparams->item((CORBA::ULong)i0);
-	if (_args[i0]->flags() != nv->flags())
+    for (CORBA::ULong i0 = 0; i0 < _nargs; ++i0) {
+        nv = oparams->item(i0);
+	if (arg(i0)->flags() != nv->flags())
 	    return FALSE;
-	if (_args[i0]->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
-	    nv->value()->from_static_any (*_args[i0]);
+	if (arg(i0)->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
+	    nv->value()->from_static_any (*arg(i0));
 	}
     }
     return TRUE;
@@ -1917,7 +1999,7 @@ CORBA::StaticRequest::get_out_args (CORBA::StaticAny *res,
     }
     if (res && _res)
 	*res = *_res;
-    return copy (oparams, &_args, CORBA::ARG_OUT|CORBA::ARG_INOUT);
+    return copy (oparams, args(), CORBA::ARG_OUT|CORBA::ARG_INOUT);
 }
 
 CORBA::Boolean
@@ -1926,7 +2008,7 @@ CORBA::StaticRequest::get_out_args (DataEncoder *ec, Boolean &is_except)
     is_except = FALSE;
     CORBA::Exception *e = exception();
 
-    if (!e && !_res && _args.size() == 0)
+    if (!e && !_res && _nargs == 0)
 	return TRUE;
 
     // share one state for all arguments
@@ -1943,9 +2025,9 @@ CORBA::StaticRequest::get_out_args (DataEncoder *ec, Boolean &is_except)
 	if (!_res->marshal (*ec))
 	    return FALSE;
     }
-    for (mico_vec_size_type i = 0; i < _args.size(); ++i) {
-	if (_args[i]->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
-	    if (!_args[i]->marshal (*ec))
+    for (CORBA::ULong i = 0; i < _nargs; ++i) {
+	if (arg(i)->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
+	    if (!arg(i)->marshal (*ec))
 		return FALSE;
 	}
     }
@@ -1957,7 +2039,7 @@ CORBA::StaticRequest::get_out_args (DataEncoder *ec, Boolean &is_except)
 CORBA::Boolean
 CORBA::StaticRequest::set_out_args (Any *res, NVList_ptr oparams)
 {
-    if (oparams->count() != _args.size())
+    if (oparams->count() != _nargs)
 	return FALSE;
 
     if (res && _res) {
@@ -1966,13 +2048,12 @@ CORBA::StaticRequest::set_out_args (Any *res, NVList_ptr oparams)
     }
 
     CORBA::NamedValue_ptr nv;
-    assert(_args.size() < UINT_MAX);
-    for (mico_vec_size_type i0 = 0; i0 < _args.size(); ++i0) {
-        nv = oparams->item((CORBA::ULong)i0);
-	if (_args[i0]->flags() != nv->flags())
+    for (CORBA::ULong i0 = 0; i0 < _nargs; ++i0) {
+        nv = oparams->item(i0);
+	if (arg(i0)->flags() != nv->flags())
 	    return FALSE;
-	if (_args[i0]->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
-	    if (!nv->value()->to_static_any (*_args[i0]))
+	if (arg(i0)->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
+	    if (!nv->value()->to_static_any (*arg(i0)))
 		return FALSE;
 	}
     }
@@ -1983,9 +2064,17 @@ CORBA::Boolean
 CORBA::StaticRequest::set_out_args (CORBA::StaticAny *res,
 				    StaticAnyList *oparams)
 {
+    if (_local) {
+	for (CORBA::ULong i = 0; i < _nargs; ++i) {
+	    if (arg(i)->flags() & CORBA::ARG_INOUT)
+		arg(i)->release();
+	}
+	return copy_cdr (res ? _res : 0, args(), _res ? res : 0, oparams,
+			 CORBA::ARG_OUT|CORBA::ARG_INOUT);
+    }
     if (res && _res)
 	*_res = *res;
-    return copy (&_args, oparams, CORBA::ARG_OUT|CORBA::ARG_INOUT);
+    return copy (args(), oparams, CORBA::ARG_OUT|CORBA::ARG_INOUT);
 }
 
 void
@@ -1998,7 +2087,7 @@ CORBA::Boolean
 CORBA::StaticRequest::set_out_args (CORBA::DataDecoder *dc,
 				    CORBA::Boolean is_ex)
 {
-    if (!is_ex && !_res && _args.size() == 0)
+    if (!is_ex && !_res && _nargs == 0)
 	return TRUE;
 
     CORBA::Boolean ret;
@@ -2019,12 +2108,12 @@ CORBA::StaticRequest::set_out_args (CORBA::DataDecoder *dc,
                 return FALSE;
 	    }
 	}
-	for (mico_vec_size_type i = 0; i < _args.size(); ++i) {
-	    if (_args[i]->flags() & CORBA::ARG_INOUT)
-		_args[i]->release();
+	for (CORBA::ULong i = 0; i < _nargs; ++i) {
+	    if (arg(i)->flags() & CORBA::ARG_INOUT)
+		arg(i)->release();
 
-	    if (_args[i]->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
-		ret = _args[i]->demarshal (*dc);
+	    if (arg(i)->flags() & (CORBA::ARG_OUT|CORBA::ARG_INOUT)) {
+		ret = arg(i)->demarshal (*dc);
                 if (!ret) {
 		    dc->valuestate (0);
                     return FALSE;
@@ -2046,7 +2135,7 @@ CORBA::StaticRequest::copy_out_args (ORBRequest *r)
     copy_svc (r);
 
     CORBA::Exception *ex;
-    if (!r->get_out_args (_res, &_args, ex))
+    if (!r->get_out_args (_res, args(), ex))
         return FALSE;
     if (ex)
 	exception (ex);
@@ -2069,22 +2158,19 @@ CORBA::StaticRequest::type ()
 void
 CORBA::StaticRequest::add_in_arg (StaticAny *a)
 {
-    _args.push_back (a);
-    a->flags (CORBA::ARG_IN);
+    add_arg (a, CORBA::ARG_IN);
 }
 
 void
 CORBA::StaticRequest::add_out_arg (StaticAny *a)
 {
-    _args.push_back (a);
-    a->flags (CORBA::ARG_OUT);
+    add_arg (a, CORBA::ARG_OUT);
 }
 
 void
 CORBA::StaticRequest::add_inout_arg (StaticAny *a)
 {
-    _args.push_back (a);
-    a->flags (CORBA::ARG_INOUT);
+    add_arg (a, CORBA::ARG_INOUT);
 }
 
 void
@@ -2146,7 +2232,7 @@ CORBA::StaticRequest::invoke ()
     // because right value of operation_context is computed with help
     // of contexts!
     PInterceptor::PI::_send_request_ip
-	(_cri, CORBA::ORB::get_msgid(id), _args, _ctx_list, _ctx,
+	(_cri, CORBA::ORB::get_msgid(id), pi_args(), _ctx_list, _ctx,
 	 this->context());
 #ifdef USE_OLD_INTERCEPTORS
     if (_iceptreq && !Interceptor::ClientInterceptor::
@@ -2187,8 +2273,6 @@ CORBA::StaticRequest::invoke ()
 	CORBA::InvokeStatus rs = orb->get_invoke_reply (id, obj, dummy, ad);
 //  	CORBA::InvokeStatus rs = orb->get_invoke_reply (msgid, obj, dummy, ad);
 
-	CORBA::Any r;
-
 	switch (rs) {
 	case CORBA::InvokeForward:
 	    // XXX what if _obj is not a stub ???
@@ -2204,7 +2288,7 @@ CORBA::StaticRequest::invoke ()
             //cerr << __FILE__ << ":" << __LINE__ << ": id->_refcnt(): " << (CORBA::is_nil(id) ? -1 : id->_refcnt()) << endl;
 	    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 	    PInterceptor::PI::_send_request_ip
-		(_cri, CORBA::ORB::get_msgid(id), _args, _ctx_list,
+		(_cri, CORBA::ORB::get_msgid(id), pi_args(), _ctx_list,
 		 _ctx, this->context());
 //  	    msgid = orb->invoke_async (_obj, this, Principal::_nil(),
 //  				       TRUE, 0, msgid);
@@ -2222,7 +2306,7 @@ CORBA::StaticRequest::invoke ()
 	    id = orb->new_orbid();
 	    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 	    PInterceptor::PI::_send_request_ip
-		(_cri, CORBA::ORB::get_msgid(id), _args, _ctx_list,
+		(_cri, CORBA::ORB::get_msgid(id), pi_args(), _ctx_list,
 		 _ctx, this->context());
 //  	    msgid = orb->invoke_async (_obj, this, Principal::_nil(),
 //  				       TRUE, 0, msgid);
@@ -2233,18 +2317,22 @@ CORBA::StaticRequest::invoke ()
 	    break;
 
 	case CORBA::InvokeOk:
-	    // receive reply
-	    CORBA::TypeCode_ptr tc;
-	    if (_res && (tc = _res->typecode()) != NULL
-		&& tc->kind() != CORBA::tk_void
-		&& tc->kind() != CORBA::tk_null) {
+	    // receive reply, the result is only needed as an Any
+	    // for the interceptors
+	    if (_cri) {
+		CORBA::Any r;
+		CORBA::TypeCode_ptr tc;
+		if (_res && (tc = _res->typecode()) != NULL
+		    && tc->kind() != CORBA::tk_void
+		    && tc->kind() != CORBA::tk_null) {
 		    r.from_static_any (*_res);
 		    PInterceptor::PI::_receive_reply_ip
-			(_cri, r, _args, dummy->context(), TRUE);
-	    }
-	    else {
-		PInterceptor::PI::_receive_reply_ip
-		    (_cri, r, _args, dummy->context(), FALSE);
+			(_cri, r, pi_args(), dummy->context(), TRUE);
+		}
+		else {
+		    PInterceptor::PI::_receive_reply_ip
+			(_cri, r, pi_args(), dummy->context(), FALSE);
+		}
 	    }
 	    done = TRUE;
 	    break;
@@ -2290,7 +2378,7 @@ CORBA::StaticRequest::invoke ()
 		    id = orb->new_orbid();
 		    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 		    PInterceptor::PI::_send_request_ip
-			(_cri, CORBA::ORB::get_msgid(id), _args,
+			(_cri, CORBA::ORB::get_msgid(id), pi_args(),
 			 _ctx_list, _ctx, this->context());
 //                      msgid = orb->invoke_async
 //  			(_obj, this, Principal::_nil(), TRUE, 0, msgid);
@@ -2306,7 +2394,7 @@ CORBA::StaticRequest::invoke ()
 			id = orb->new_orbid();
 			_cri = PInterceptor::PI::_create_cri(_obj, _opname);
 			PInterceptor::PI::_send_request_ip
-			(_cri, CORBA::ORB::get_msgid(id), _args, _ctx_list,
+			(_cri, CORBA::ORB::get_msgid(id), pi_args(), _ctx_list,
 			 _ctx, this->context());
 			id = orb->invoke_async (_obj, this, Principal::_nil(),
 			     TRUE, 0, id);  
@@ -2341,7 +2429,7 @@ CORBA::StaticRequest::oneway ()
 //      _obj->_orbnc()->invoke_async (_obj, this, CORBA::Principal::_nil(), FALSE);
 
     PInterceptor::PI::_send_request_ip
-	(_cri, 0, _args, _ctx_list, _ctx, this->context(), FALSE);
+	(_cri, 0, pi_args(), _ctx_list, _ctx, this->context(), FALSE);
 
 //      CORBA::ULong msgid = _obj->_orbnc()->invoke_async
 //  	(_obj, this, CORBA::Principal::_nil(), FALSE);
@@ -2384,7 +2472,7 @@ CORBA::StaticRequest::send_deferred ()
 //      CORBA::ULong msgid = orb->new_msgid();
     CORBA::ORBMsgId_var id = orb->new_orbid();
     PInterceptor::PI::_send_request_ip
-	(_cri, CORBA::ORB::get_msgid(id), _args, _ctx_list, _ctx,
+	(_cri, CORBA::ORB::get_msgid(id), pi_args(), _ctx_list, _ctx,
 	 this->context());
 //      _msgid = orb->invoke_async (_obj, this, CORBA::Principal::_nil(),
 //  				TRUE, 0, msgid);
@@ -2434,7 +2522,6 @@ CORBA::StaticRequest::get_response ()
 	CORBA::InvokeStatus rs = orb->get_invoke_reply (_id, obj, dummy, ad);
 //  	CORBA::InvokeStatus rs = orb->get_invoke_reply (_msgid, obj,
 //  							dummy, ad);
-	CORBA::Any r;
 
 	switch (rs) {
 	case CORBA::InvokeForward:
@@ -2449,7 +2536,7 @@ CORBA::StaticRequest::get_response ()
 	    _id = orb->new_orbid();
 	    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 	    PInterceptor::PI::_send_request_ip
-		(_cri, CORBA::ORB::get_msgid(_id), _args, _ctx_list,
+		(_cri, CORBA::ORB::get_msgid(_id), pi_args(), _ctx_list,
 		 _ctx, this->context());
 //  	    _msgid = orb->invoke_async (obj, this, Principal::_nil(),
 //  					TRUE, 0, _msgid);
@@ -2467,7 +2554,7 @@ CORBA::StaticRequest::get_response ()
 	    _id = orb->new_orbid();
 	    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 	    PInterceptor::PI::_send_request_ip
-		(_cri, CORBA::ORB::get_msgid(_id), _args, _ctx_list,
+		(_cri, CORBA::ORB::get_msgid(_id), pi_args(), _ctx_list,
 		 _ctx, this->context());
 //  	    _msgid = orb->invoke_async (_obj, this, Principal::_nil(),
 //  					TRUE, 0, _msgid);
@@ -2478,19 +2565,22 @@ CORBA::StaticRequest::get_response ()
 	    break;
 
 	case CORBA::InvokeOk:
-	    CORBA::TypeCode_ptr tc;
-	    if (_res && (tc = _res->typecode()) != NULL
-		&& tc->kind() != CORBA::tk_void
-		&& tc->kind() != CORBA::tk_null) {
-		r.from_static_any (*_res);
-		PInterceptor::PI::_receive_reply_ip
-		    (_cri, r, _args, _ctx_list, _ctx,
-		     dummy->context(), TRUE);
-	    }
-	    else {
-		PInterceptor::PI::_receive_reply_ip
-		    (_cri, r, _args, _ctx_list, _ctx,
-		     dummy->context(), FALSE);
+	    if (_cri) {
+		CORBA::Any r;
+		CORBA::TypeCode_ptr tc;
+		if (_res && (tc = _res->typecode()) != NULL
+		    && tc->kind() != CORBA::tk_void
+		    && tc->kind() != CORBA::tk_null) {
+		    r.from_static_any (*_res);
+		    PInterceptor::PI::_receive_reply_ip
+			(_cri, r, pi_args(), _ctx_list, _ctx,
+			 dummy->context(), TRUE);
+		}
+		else {
+		    PInterceptor::PI::_receive_reply_ip
+			(_cri, r, pi_args(), _ctx_list, _ctx,
+			 dummy->context(), FALSE);
+		}
 	    }
 	    done = TRUE;
 	    break;
@@ -2536,7 +2626,7 @@ CORBA::StaticRequest::get_response ()
 		    _id = orb->new_orbid();
 		    _cri = PInterceptor::PI::_create_cri(_obj, _opname);
 		    PInterceptor::PI::_send_request_ip
-			(_cri, CORBA::ORB::get_msgid(_id), _args, _ctx_list,
+			(_cri, CORBA::ORB::get_msgid(_id), pi_args(), _ctx_list,
 			 _ctx, this->context());
 //  		    _msgid = orb->invoke_async (_obj, this, Principal::_nil(),
 //  						TRUE, 0, _msgid);
@@ -2553,7 +2643,7 @@ CORBA::StaticRequest::get_response ()
 			_id = orb->new_orbid();
 			_cri = PInterceptor::PI::_create_cri(_obj, _opname);
 			PInterceptor::PI::_send_request_ip
-			(_cri, CORBA::ORB::get_msgid(_id), _args, _ctx_list,
+			(_cri, CORBA::ORB::get_msgid(_id), pi_args(), _ctx_list,
 			 _ctx, this->context());
 			_id = orb->invoke_async (_obj, this, Principal::_nil(),
 			     TRUE, 0, _id);  
@@ -89,6 +89,60 @@ CORBA::Transport::write (Buffer &b, Long len, Boolean eat)
     return r;
 }
 
+/*
+ * write the readable parts of several buffers with a single gather
+ * write. returns the number of bytes written, which are consumed from
+ * the buffers in order if eat is set.
+ */
+CORBA::Long
+CORBA::Transport::write (Buffer **bufs, ULong nbufs, Boolean eat)
+{
+    IOVec iov[MAX_IOV];
+    ULong cnt = 0;
+
+    for (ULong i = 0; i < nbufs && cnt < MAX_IOV; ++i) {
+	if (bufs[i]->length() == 0)
+	    continue;
+	iov[cnt].base = bufs[i]->buffer() + bufs[i]->rpos();
+	iov[cnt].len = bufs[i]->length();
+	++cnt;
+    }
+    if (cnt == 0)
+	return 0;
+
+    Long r = writev (iov, cnt);
+    if (r > 0 && eat) {
+	ULong todo = r;
+	for (ULong i = 0; i < nbufs && todo > 0; ++i) {
+	    ULong n = bufs[i]->length();
+	    if (n > todo)
+		n = todo;
+	    bufs[i]->rseek_rel (n);
+	    todo -= n;
+	}
+    }
+    return r;
+}
+
+/*
+ * default gather write for transports without a vectored write system
+ * call: write the segments one after the other, stop at a short write.
+ */
+CORBA::Long
+CORBA::Transport::writev (const IOVec *iov, ULong cnt)
+{
+    Long total = 0;
+    for (ULong i = 0; i < cnt; ++i) {
+	Long r = write (iov[i].base, iov[i].len);
+	if (r < 0)
+	    return total > 0 ? total : r;
+	total += r;
+	if ((ULong)r < iov[i].len)
+	    break;
+    }
+    return total;
+}
+
 void
 CORBA::Transport::buffering (CORBA::Boolean)
 {
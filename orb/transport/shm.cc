@@ -0,0 +1,935 @@
+/*
+ *  MICO --- an Open Source CORBA implementation
+ *  Copyright (c) 1997-2007 by The Mico Team
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Library General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Library General Public
+ *  License along with this library; if not, write to the Free
+ *  Software Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ *
+ *  For more information, visit the MICO Home Page at
+ *  http://www.mico.org/
+ */
+
+#define MICO_CONF_IMR
+
+#include <CORBA-SMALL.h>
+#include <mico/os-net.h>
+#include <mico/impl.h>
+#ifdef __COMO__
+#pragma hdrstop
+#endif // __COMO__
+
+#ifdef HAVE_SHM_TRANSPORT
+
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
+
+using namespace std;
+
+/*
+ * layout of the shared memory segment: a header, the control blocks
+ * of the two rings and then the data of the two rings. ring 0 goes
+ * from the client to the server, ring 1 back. positions count bytes
+ * and wrap around at 2^32, the offset into the data is the position
+ * modulo the ring length, which is a power of two.
+ */
+
+#define SHM_MAGIC 0x6d53484d // "mSHM"
+
+struct ShmHeader {
+    CORBA::ULong magic;
+    CORBA::ULong ringlen;
+    char pad[56];
+};
+
+// the counters written by different processes live in different cache lines
+struct MICO::ShmTransport::Ring {
+    volatile CORBA::ULong head;   // written by the producer
+    char pad1[60];
+    volatile CORBA::ULong tail;   // written by the consumer
+    char pad2[60];
+    volatile CORBA::ULong rwait;  // consumer sleeps until data arrives
+    volatile CORBA::ULong wwait;  // producer sleeps until there is room
+    char pad3[56];
+};
+
+CORBA::ULong MICO::ShmTransport::_ring_size = 1024*1024;
+
+/*
+ * create an anonymous file to back the segment. it is unlinked right
+ * away, the peer gets the descriptor over the socket.
+ */
+static CORBA::Long
+shm_make_segment ()
+{
+    const char *dirs[] = { "/dev/shm", "/tmp", 0 };
+    for (int i = 0; dirs[i]; ++i) {
+	string path = dirs[i];
+	path += "/mico-shm-XXXXXX";
+	char *name = CORBA::string_dup (path.c_str());
+	CORBA::Long fd = ::mkstemp (name);
+	if (fd >= 0)
+	    ::unlink (name);
+	CORBA::string_free (name);
+	if (fd >= 0)
+	    return fd;
+    }
+    return -1;
+}
+
+static void
+shm_ring (CORBA::Long fd)
+{
+    // a full socket buffer means the peer has enough wakeups pending
+    char c = 0;
+    OSNet::sock_write (fd, &c, 1);
+}
+
+static void
+shm_wait (CORBA::Long fd)
+{
+#ifdef HAVE_POLL_H
+    struct pollfd ps;
+    ps.fd       = fd;
+    ps.events   = POLLIN | POLLERR | POLLHUP;
+
+    ::poll (&ps, 1, -1);
+#else
+    fd_set rset;
+
+    FD_ZERO (&rset);
+    FD_SET (fd, &rset);
+
+    ::select (fd+1, (select_addr_t)&rset, 0, 0, 0);
+#endif // HAVE_POLL_H
+}
+
+
+/************************** ShmTransport ****************************/
+
+
+void
+MICO::ShmTransport::SpaceCallback::callback (CORBA::Dispatcher *disp,
+					     CORBA::Dispatcher::Event ev)
+{
+    _t->space_callback (disp, ev);
+}
+
+MICO::ShmTransport::ShmTransport ()
+{
+    local_addr.family (UnixAddress::SHM);
+    peer_addr.family (UnixAddress::SHM);
+    sfd = -1;
+    seg = 0;
+    seglen = ringlen = 0;
+    rx = tx = 0;
+    rxdata = txdata = 0;
+    space_cb._t = this;
+    wspace = FALSE;
+    kicked = FALSE;
+}
+
+MICO::ShmTransport::~ShmTransport ()
+{
+    close ();
+    unmap ();
+}
+
+void
+MICO::ShmTransport::ring_size (CORBA::ULong sz)
+{
+    CORBA::ULong len = 4096;
+    while (len < sz && len < 0x40000000)
+	len <<= 1;
+    _ring_size = len;
+}
+
+CORBA::ULong
+MICO::ShmTransport::ring_size ()
+{
+    return _ring_size;
+}
+
+CORBA::ULong
+MICO::ShmTransport::segment_length (CORBA::ULong len)
+{
+    return sizeof (ShmHeader) + 2 * sizeof (Ring) + 2 * len;
+}
+
+CORBA::Boolean
+MICO::ShmTransport::map (CORBA::Long segfd, CORBA::Boolean client)
+{
+    CORBA::ULong len;
+    if (client) {
+	len = segment_length (_ring_size);
+	if (::ftruncate (segfd, len) < 0) {
+	    err = xstrerror (errno);
+	    return FALSE;
+	}
+    } else {
+	struct stat st;
+	if (::fstat (segfd, &st) < 0) {
+	    err = xstrerror (errno);
+	    return FALSE;
+	}
+	len = st.st_size;
+	if (len < segment_length (0)) {
+	    err = "shared memory segment too small";
+	    return FALSE;
+	}
+    }
+    void *p = ::mmap (0, len, PROT_READ|PROT_WRITE, MAP_SHARED, segfd, 0);
+    if (p == MAP_FAILED) {
+	err = xstrerror (errno);
+	return FALSE;
+    }
+    seg = (CORBA::Octet *)p;
+    seglen = len;
+
+    ShmHeader *hdr = (ShmHeader *)seg;
+    Ring *rings = (Ring *)(seg + sizeof (ShmHeader));
+    if (client) {
+	// the file is zero filled, both readers start out asleep so
+	// that the first message wakes them up
+	hdr->magic = SHM_MAGIC;
+	hdr->ringlen = ringlen = _ring_size;
+	rings[0].rwait = rings[1].rwait = 1;
+	tx = &rings[0];
+	rx = &rings[1];
+    } else {
+	ringlen = hdr->ringlen;
+	if (hdr->magic != SHM_MAGIC || ringlen == 0 ||
+	    (ringlen & (ringlen - 1)) || ringlen > 0x40000000 ||
+	    segment_length (ringlen) != len) {
+	    unmap ();
+	    err = "bad shared memory segment";
+	    return FALSE;
+	}
+	rx = &rings[0];
+	tx = &rings[1];
+    }
+    CORBA::Octet *data = (CORBA::Octet *)(rings + 2);
+    if (client) {
+	txdata = data;
+	rxdata = data + ringlen;
+    } else {
+	rxdata = data;
+	txdata = data + ringlen;
+    }
+    return TRUE;
+}
+
+void
+MICO::ShmTransport::unmap ()
+{
+    if (seg) {
+	::munmap ((void *)seg, seglen);
+	seg = 0;
+	rx = tx = 0;
+	rxdata = txdata = 0;
+    }
+}
+
+/*
+ * server side: receive the segment and the second socket the client
+ * sent after connecting. returns FALSE if they did not arrive yet or
+ * on error (err or ateof set).
+ */
+CORBA::Boolean
+MICO::ShmTransport::attach ()
+{
+    char c;
+    struct iovec iov;
+    iov.iov_base = &c;
+    iov.iov_len = 1;
+
+    union {
+	struct cmsghdr hdr;
+	char buf[CMSG_SPACE (2 * sizeof (int))];
+    } cbuf;
+
+    struct msghdr msg;
+    memset (&msg, 0, sizeof (msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf.buf;
+    msg.msg_controllen = sizeof (cbuf.buf);
+
+    CORBA::Long r = ::recvmsg (fd, &msg, 0);
+    if (r < 0) {
+	OSNet::set_errno();
+	if (errno != EINTR && errno != EWOULDBLOCK && errno != EAGAIN)
+	    err = xstrerror (errno);
+	return FALSE;
+    } else if (r == 0) {
+	ateof = TRUE;
+	return FALSE;
+    }
+
+    int fds[2] = { -1, -1 };
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR (&msg);
+    if (cmsg && cmsg->cmsg_level == SOL_SOCKET &&
+	cmsg->cmsg_type == SCM_RIGHTS &&
+	cmsg->cmsg_len == CMSG_LEN (2 * sizeof (int)))
+	memcpy (fds, CMSG_DATA (cmsg), sizeof (fds));
+    if (fds[0] < 0 || fds[1] < 0) {
+	err = "shared memory connection without segment";
+	return FALSE;
+    }
+
+    sfd = fds[1];
+    OSNet::sock_block (sfd, FALSE);
+    CORBA::Boolean ret = map (fds[0], FALSE);
+    ::close (fds[0]);
+    return ret;
+}
+
+/*
+ * read what is available from the receive ring, at most len bytes.
+ */
+CORBA::Long
+MICO::ShmTransport::get (CORBA::Octet *b, CORBA::ULong len)
+{
+    CORBA::ULong tail = rx->tail;
+    CORBA::ULong head = rx->head;
+    __sync_synchronize ();
+
+    CORBA::ULong n = head - tail;
+    if (n > ringlen) {
+	err = "shared memory ring corrupted";
+	return -1;
+    }
+    if (n > len)
+	n = len;
+    if (n == 0)
+	return 0;
+
+    CORBA::ULong pos = tail & (ringlen - 1);
+    CORBA::ULong n1 = ringlen - pos;
+    if (n1 > n)
+	n1 = n;
+    memcpy (b, rxdata + pos, n1);
+    if (n > n1)
+	memcpy (b + n1, rxdata, n - n1);
+
+    __sync_synchronize ();
+    rx->tail = tail + n;
+    __sync_synchronize ();
+    if (rx->wwait && __sync_bool_compare_and_swap (&rx->wwait, 1, 0))
+	shm_ring (sfd);
+    return n;
+}
+
+/*
+ * copy as much as fits into the send ring, skipping the first skip
+ * bytes of the segments.
+ */
+CORBA::Long
+MICO::ShmTransport::put (const IOVec *iov, CORBA::ULong cnt,
+			 CORBA::ULong skip)
+{
+    CORBA::ULong head = tx->head;
+    CORBA::ULong tail = tx->tail;
+    __sync_synchronize ();
+
+    if (head - tail > ringlen) {
+	err = "shared memory ring corrupted";
+	return -1;
+    }
+    CORBA::ULong room = ringlen - (head - tail);
+    CORBA::ULong n = 0;
+
+    for (CORBA::ULong i = 0; i < cnt && n < room; ++i) {
+	const CORBA::Octet *p = (const CORBA::Octet *)iov[i].base;
+	CORBA::ULong l = iov[i].len;
+	if (skip >= l) {
+	    skip -= l;
+	    continue;
+	}
+	p += skip;
+	l -= skip;
+	skip = 0;
+	if (l > room - n)
+	    l = room - n;
+
+	CORBA::ULong pos = (head + n) & (ringlen - 1);
+	CORBA::ULong l1 = ringlen - pos;
+	if (l1 > l)
+	    l1 = l;
+	memcpy (txdata + pos, p, l1);
+	if (l > l1)
+	    memcpy (txdata, p + l1, l - l1);
+	n += l;
+    }
+    if (n == 0)
+	return 0;
+
+    __sync_synchronize ();
+    tx->head = head + n;
+    __sync_synchronize ();
+    if (tx->rwait && __sync_bool_compare_and_swap (&tx->rwait, 1, 0))
+	shm_ring (fd);
+    return n;
+}
+
+/*
+ * eat up the wakeups that arrived on one of the sockets. returns
+ * FALSE if the peer has closed the connection or on error.
+ */
+CORBA::Boolean
+MICO::ShmTransport::drain (CORBA::Long thefd)
+{
+    char buf[64];
+
+    while (42) {
+	CORBA::Long r = OSNet::sock_read (thefd, buf, sizeof (buf));
+	if (r > 0) {
+	    if (r < (CORBA::Long)sizeof (buf))
+		return TRUE;
+	    continue;
+	} else if (r == 0) {
+	    return FALSE;
+	}
+	OSNet::set_errno();
+	if (errno == EINTR)
+	    continue;
+	if (errno == 0 || errno == EWOULDBLOCK || errno == EAGAIN)
+	    return TRUE;
+	err = xstrerror (errno);
+	return FALSE;
+    }
+}
+
+/*
+ * check for input before the dispatcher's read callback is run. a
+ * wakeup can be stale, the data it was sent for may have been read
+ * already. with an empty ring the wakeup is armed again.
+ */
+CORBA::Boolean
+MICO::ShmTransport::has_input ()
+{
+    if (!seg || rx->head != rx->tail)
+	return TRUE;
+    if (!drain (fd))
+	return TRUE;
+    rx->rwait = 1;
+    __sync_synchronize ();
+    return rx->head != rx->tail;
+}
+
+/*
+ * unlike a socket the ring does not wake up the dispatcher for data
+ * that is left over after a read(), so make it call us again through
+ * a timer. read() is run from the dispatcher's thread then.
+ */
+void
+MICO::ShmTransport::kick ()
+{
+    if (rdisp && rcb && !kicked) {
+	kicked = TRUE;
+	rdisp->tm_event (this, 0);
+    }
+}
+
+/*
+ * the send ring is full: wait for the peer's wakeup on the second
+ * socket instead of the always writable first one.
+ */
+void
+MICO::ShmTransport::wait_for_space ()
+{
+    if (wcb && wdisp && !wspace) {
+	wdisp->remove (this, CORBA::Dispatcher::Write);
+	wdisp->rd_event (&space_cb, sfd);
+	wspace = TRUE;
+    }
+}
+
+void
+MICO::ShmTransport::space_callback (CORBA::Dispatcher *disp,
+				    CORBA::Dispatcher::Event ev)
+{
+    switch (ev) {
+    case CORBA::Dispatcher::Read:
+	assert (wcb);
+	drain (sfd);
+	wcb->callback (this, CORBA::TransportCallback::Write);
+	break;
+    case CORBA::Dispatcher::Remove:
+	wdisp = 0;
+	wcb = 0;
+	wspace = FALSE;
+	break;
+    case CORBA::Dispatcher::Moved:
+	wdisp = disp;
+	break;
+    default:
+	assert (0);
+    }
+}
+
+CORBA::Boolean
+MICO::ShmTransport::bind (const CORBA::Address *a)
+{
+    assert (state == Open);
+    assert (!strcmp (a->proto(), "shm"));
+    UnixAddress *ua = (UnixAddress *)a;
+
+    // XXX should do that after the socket is destroyed ...
+    ::unlink (ua->filename());
+
+    struct sockaddr_un una = ua->sockaddr();
+    CORBA::Long r = ::bind (fd, (socket_addr_t)&una, sizeof (una));
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+	return FALSE;
+    }
+    return TRUE;
+}
+
+CORBA::Boolean
+MICO::ShmTransport::connect (const CORBA::Address *a, CORBA::ULong timeout, CORBA::Boolean& timedout)
+{
+    assert (state == Open);
+    assert (!strcmp (a->proto(), "shm"));
+    UnixAddress *ua = (UnixAddress *)a;
+
+    struct sockaddr_un una = ua->sockaddr();
+    CORBA::Long r = ::connect (fd, (socket_addr_t)&una, sizeof (una));
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+	return FALSE;
+    }
+
+    int sp[2];
+    if (::socketpair (PF_UNIX, SOCK_STREAM, 0, sp) < 0) {
+	err = xstrerror (errno);
+	return FALSE;
+    }
+    CORBA::Long segfd = shm_make_segment ();
+    if (segfd < 0) {
+	err = xstrerror (errno);
+	::close (sp[0]);
+	::close (sp[1]);
+	return FALSE;
+    }
+    if (!map (segfd, TRUE)) {
+	::close (segfd);
+	::close (sp[0]);
+	::close (sp[1]);
+	return FALSE;
+    }
+
+    // hand the segment and one end of the socket pair to the server
+    char c = 0;
+    struct iovec iov;
+    iov.iov_base = &c;
+    iov.iov_len = 1;
+
+    union {
+	struct cmsghdr hdr;
+	char buf[CMSG_SPACE (2 * sizeof (int))];
+    } cbuf;
+    memset (&cbuf, 0, sizeof (cbuf));
+
+    struct msghdr msg;
+    memset (&msg, 0, sizeof (msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf.buf;
+    msg.msg_controllen = sizeof (cbuf.buf);
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR (&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN (2 * sizeof (int));
+    int fds[2] = { segfd, sp[1] };
+    memcpy (CMSG_DATA (cmsg), fds, sizeof (fds));
+
+    do {
+	r = ::sendmsg (fd, &msg, 0);
+    } while (r < 0 && errno == EINTR);
+    if (r < 0)
+	err = xstrerror (errno);
+    ::close (segfd);
+    ::close (sp[1]);
+    if (r != 1) {
+	::close (sp[0]);
+	unmap ();
+	return FALSE;
+    }
+    sfd = sp[0];
+
+    OSNet::sock_block (fd, FALSE);
+    OSNet::sock_block (sfd, FALSE);
+    return TRUE;
+}
+
+void
+MICO::ShmTransport::open (CORBA::Long thefd)
+{
+    assert (state == Closed);
+
+    if (thefd < 0) {
+	thefd = ::socket (PF_UNIX, SOCK_STREAM, 0);
+	assert (thefd >= 0);
+	// blocks until connect() is done
+	OSNet::sock_block (thefd, TRUE);
+    } else {
+	OSNet::sock_block (thefd, FALSE);
+    }
+
+    SocketTransport::open( thefd );
+
+    // the sockets never block, waiting is done in read() and write()
+    is_blocking = TRUE;
+    state = Open;
+}
+
+void
+MICO::ShmTransport::close ()
+{
+    if (state != Open)
+	return;
+
+    state = Closed;
+
+    if (kicked && rdisp)
+	rdisp->remove (this, CORBA::Dispatcher::Timer);
+    kicked = FALSE;
+    if (wspace && wdisp && wcb) {
+	wdisp->remove (&space_cb, CORBA::Dispatcher::Read);
+	wdisp = 0;
+	wcb = 0;
+    }
+    wspace = FALSE;
+
+    // the segment stays mapped until the transport is deleted, another
+    // thread may still be in read() or write()
+    OSNet::sock_shutdown(fd);
+    OSNet::sock_close (fd);
+    if (sfd >= 0) {
+	OSNet::sock_shutdown(sfd);
+	OSNet::sock_close (sfd);
+	sfd = -1;
+    }
+
+    SocketTransport::close();
+}
+
+void
+MICO::ShmTransport::rselect (CORBA::Dispatcher *disp,
+			     CORBA::TransportCallback *cb)
+{
+    if (kicked && rdisp)
+	rdisp->remove (this, CORBA::Dispatcher::Timer);
+    kicked = FALSE;
+    SocketTransport::rselect (disp, cb);
+}
+
+void
+MICO::ShmTransport::callback (CORBA::Dispatcher *disp,
+			      CORBA::Dispatcher::Event ev)
+{
+    switch (ev) {
+    case CORBA::Dispatcher::Timer:
+	kicked = FALSE;
+	if (rcb && seg && rx->head != rx->tail)
+	    rcb->callback (this, CORBA::TransportCallback::Read);
+	break;
+    case CORBA::Dispatcher::Read:
+	// a blocking read() must not wait for a stale wakeup
+	if (has_input ())
+	    SocketTransport::callback (disp, ev);
+	break;
+    case CORBA::Dispatcher::Remove:
+	kicked = FALSE;
+	// fall through
+    default:
+	SocketTransport::callback (disp, ev);
+    }
+}
+
+void
+MICO::ShmTransport::wselect (CORBA::Dispatcher *disp,
+			     CORBA::TransportCallback *cb)
+{
+    if (wcb && wdisp) {
+	if (wspace)
+	    wdisp->remove (&space_cb, CORBA::Dispatcher::Read);
+	else
+	    wdisp->remove (this, CORBA::Dispatcher::Write);
+	wdisp = 0;
+	wcb = 0;
+    }
+    wspace = FALSE;
+    if (cb) {
+	// the first write() moves over to the second socket if the
+	// ring is full
+	disp->wr_event (this, fd);
+	wdisp = disp;
+	wcb = cb;
+    }
+}
+
+void
+MICO::ShmTransport::block (CORBA::Boolean doblock)
+{
+    is_blocking = doblock;
+}
+
+CORBA::Boolean
+MICO::ShmTransport::isreadable ()
+{
+    if (rx && rx->head != rx->tail)
+	return TRUE;
+    return SocketTransport::isreadable ();
+}
+
+CORBA::Long
+MICO::ShmTransport::read (void *_b, CORBA::Long len)
+{
+    if (state != Open)
+	return -1;
+
+    while (!seg) {
+	if (attach ())
+	    break;
+	if (ateof)
+	    return 0;
+	if (bad() || !is_blocking)
+	    return bad() ? -1 : 0;
+	shm_wait (fd);
+    }
+
+    CORBA::Octet *b = (CORBA::Octet *)_b;
+    CORBA::Long got = 0;
+
+    while (got < len) {
+	CORBA::Long r = get (b + got, len - got);
+	if (r < 0)
+	    return r;
+	if (r > 0) {
+	    got += r;
+	    continue;
+	}
+	// ring empty, have the peer wake us up. old wakeups are eaten
+	// before arming, a wakeup sent after that must stay in the socket
+	if (!drain (fd)) {
+	    if (bad())
+		return got > 0 ? got : -1;
+	    // the peer is gone, but what it wrote before is still there
+	    if (rx->head != rx->tail)
+		continue;
+	    ateof = TRUE;
+	    break;
+	}
+	rx->rwait = 1;
+	__sync_synchronize ();
+	if (rx->head != rx->tail) {
+	    __sync_bool_compare_and_swap (&rx->rwait, 1, 0);
+	    continue;
+	}
+	if (!is_blocking)
+	    break;
+	shm_wait (fd);
+    }
+    if (got > 0) {
+	// data arriving from now on must wake us up, data that is
+	// already there must be read without a wakeup
+	rx->rwait = 1;
+	__sync_synchronize ();
+	if (rx->head != rx->tail)
+	    kick ();
+    }
+    return got;
+}
+
+CORBA::Long
+MICO::ShmTransport::write (const void *b, CORBA::Long len)
+{
+    IOVec iov;
+    iov.base = b;
+    iov.len = len;
+    return writev (&iov, 1);
+}
+
+CORBA::Long
+MICO::ShmTransport::writev (const IOVec *iov, CORBA::ULong cnt)
+{
+    if (state != Open)
+	return -1;
+    if (!seg) {
+	err = "shared memory connection not set up";
+	return -1;
+    }
+
+    CORBA::ULong len = 0;
+    for (CORBA::ULong i = 0; i < cnt; ++i)
+	len += iov[i].len;
+
+    CORBA::ULong done = 0;
+    while (done < len) {
+	CORBA::Long r = put (iov, cnt, done);
+	if (r < 0)
+	    return done > 0 ? (CORBA::Long)done : r;
+	if (r > 0) {
+	    done += r;
+	    continue;
+	}
+	// ring full, have the peer wake us up (same order as in read())
+	if (!drain (sfd)) {
+	    if (!bad())
+		err = xstrerror (EPIPE);
+	    return done > 0 ? (CORBA::Long)done : -1;
+	}
+	tx->wwait = 1;
+	__sync_synchronize ();
+	if (tx->head - tx->tail < ringlen) {
+	    __sync_bool_compare_and_swap (&tx->wwait, 1, 0);
+	    continue;
+	}
+	if (!is_blocking) {
+	    wait_for_space ();
+	    break;
+	}
+	shm_wait (sfd);
+    }
+    return done;
+}
+
+const CORBA::Address *
+MICO::ShmTransport::addr ()
+{
+    struct sockaddr_un una;
+    socket_size_t sz = sizeof (una);
+    CORBA::Long r = ::getsockname (fd, (socket_addr_t)&una, &sz);
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+	return 0;
+    }
+    local_addr.sockaddr (una);
+    return &local_addr;
+}
+
+const CORBA::Address *
+MICO::ShmTransport::peer ()
+{
+    struct sockaddr_un una;
+    socket_size_t sz = sizeof (una);
+    CORBA::Long r = ::getpeername (fd, (socket_addr_t)&una, &sz);
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+        // allow for peer() after disconnect ...
+	//return 0;
+    } else {
+        peer_addr.sockaddr (una);
+    }
+    return &peer_addr;
+}
+
+/************************ ShmTransportServer **************************/
+
+
+MICO::ShmTransportServer::ShmTransportServer ()
+{
+    local_addr.family (UnixAddress::SHM);
+    fd = ::socket (PF_UNIX, SOCK_STREAM, 0);
+    is_blocking = TRUE;
+    assert (fd >= 0);
+}
+
+void
+MICO::ShmTransportServer::listen ()
+{
+    if (!listening) {
+	int r = ::listen (fd, 10);
+	assert (r == 0);
+	listening = TRUE;
+    }
+}
+
+CORBA::Boolean
+MICO::ShmTransportServer::bind (const CORBA::Address *a)
+{
+    assert (!strcmp (a->proto(), "shm"));
+    UnixAddress *ua = (UnixAddress *)a;
+
+    // XXX should do that after the socket is destroyed ...
+    ::unlink (ua->filename());
+
+    struct sockaddr_un una = ua->sockaddr();
+    CORBA::Long r = ::bind (fd, (socket_addr_t)&una, sizeof (una));
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+	return FALSE;
+    }
+    return TRUE;
+}
+
+void
+MICO::ShmTransportServer::close ()
+{
+    OSNet::sock_close (fd);
+    fd = ::socket (PF_UNIX, SOCK_STREAM, 0);
+    is_blocking = TRUE;
+    assert (fd >= 0);
+
+    listening = FALSE;
+    remove_aselect();
+}
+
+CORBA::Transport *
+MICO::ShmTransportServer::accept ()
+{
+    ShmTransport *ret;
+
+    listen ();
+    CORBA::Long newfd = ::accept (fd, 0, 0);
+    if (newfd < 0) {
+        OSNet::set_errno();
+	if (errno != EWOULDBLOCK && errno != EAGAIN)
+	    err = xstrerror (errno);
+	return 0;
+    }
+    ret = new ShmTransport ();
+    ret->open( newfd );
+    return ret;
+}
+
+const CORBA::Address *
+MICO::ShmTransportServer::addr ()
+{
+    struct sockaddr_un una;
+    socket_size_t sz = sizeof (una);
+    CORBA::Long r = ::getsockname (fd, (socket_addr_t)&una, &sz);
+    if (r < 0) {
+        OSNet::set_errno();
+	err = xstrerror (errno);
+	return 0;
+    }
+    local_addr.sockaddr (una);
+    return &local_addr;
+}
+
+#endif // HAVE_SHM_TRANSPORT
@@ -261,6 +261,56 @@ MICO::TCPTransport::write (const void *_b, CORBA::Long len)
     return len - todo;
 }
 
+#ifdef HAVE_SYS_UIO_H
+CORBA::Long
+MICO::TCPTransport::writev (const IOVec *_iov, CORBA::ULong cnt)
+{
+    struct iovec iov[MAX_IOV];
+    CORBA::Long len = 0;
+
+    if (cnt > MAX_IOV)
+	cnt = MAX_IOV;
+    for (CORBA::ULong i = 0; i < cnt; ++i) {
+	iov[i].iov_base = (void *)_iov[i].base;
+	iov[i].iov_len = _iov[i].len;
+	len += _iov[i].len;
+    }
+
+    CORBA::Long todo = len;
+    struct iovec *v = iov;
+
+    while (todo > 0) {
+	CORBA::Long r = OSNet::sock_writev (fd, v, cnt);
+	if (r < 0) {
+            OSNet::set_errno();
+	    if (state != Open)
+		return r;
+	    if (errno == EINTR)
+		continue;
+	    if (errno == 0 || errno == EWOULDBLOCK || errno == EAGAIN ||
+                todo != len)
+		break;
+	    err = xstrerror (errno);
+	    return r;
+	} else if (r == 0) {
+	    break;
+	}
+	todo -= r;
+	// skip the segments written completely, adjust the partial one
+	while (cnt > 0 && (CORBA::ULong)r >= v->iov_len) {
+	    r -= v->iov_len;
+	    ++v;
+	    --cnt;
+	}
+	if (r > 0) {
+	    v->iov_base = (char *)v->iov_base + r;
+	    v->iov_len -= r;
+	}
+    }
+    return len - todo;
+}
+#endif
+
 const CORBA::Address *
 MICO::TCPTransport::addr ()
 {
@@ -524,12 +524,14 @@ CORBA::TypeCode::init ()
     content = TypeCode::_nil ();
     discriminator = TypeCode::_nil ();
     recurse_tc = TypeCode::_nil ();
+    fp_serial = 0;
 }
 
 void
 CORBA::TypeCode::copy (const TypeCode &tc)
 {
     isconst = FALSE;
+    fp_serial = 0;
     tckind = tc.tckind;
     tcname = tc.tcname;
     repoid = tc.repoid;
@@ -594,6 +596,7 @@ CORBA::TypeCode::free ()
     visvec.erase (visvec.begin(), visvec.end());
 
     tckind = tk_null;
+    fp_serial = 0;
 }
 
 CORBA::TCKind
@@ -604,6 +607,237 @@ CORBA::TypeCode::kind () const
     return tckind;
 }
 
+/*
+ * remembers the results of the last comparisons of constructed
+ * typecodes for each thread. typecodes are named by the serial numbers
+ * handed out with their fingerprints, which change whenever a typecode
+ * changes, so stale results are never found.
+ */
+class TypeCodeMemo {
+public:
+    enum { Slots = 256 };
+    // equal() uses modes 0..3 for its flags, equaltype() mode 4
+    enum { EqualType = 4 };
+
+    static void init ();
+    static CORBA::ULongLong next_serial ();
+    static CORBA::Boolean lookup (CORBA::ULongLong a, CORBA::ULongLong b,
+				  CORBA::Octet mode, CORBA::Boolean &res);
+    static void insert (CORBA::ULongLong a, CORBA::ULongLong b,
+			CORBA::Octet mode, CORBA::Boolean res);
+
+private:
+    struct Slot {
+	CORBA::ULongLong a;
+	CORBA::ULongLong b;
+	CORBA::Octet mode;
+	CORBA::Boolean res;
+    };
+
+    static Slot &slot (Slot *, CORBA::ULongLong a, CORBA::ULongLong b,
+		       CORBA::Octet mode);
+    static Slot *slots (CORBA::Boolean create);
+    static void destroy (void *);
+
+    static CORBA::Boolean _initialized;
+    static MICOMT::Mutex _lock;
+    // serials 0 (not computed) and 1 (no fingerprint) are reserved
+    static CORBA::ULongLong _serial;
+#ifdef HAVE_THREADS
+    static MICOMT::Thread::ThreadKey _key;
+#else
+    static Slot *_slots;
+#endif
+};
+
+CORBA::Boolean TypeCodeMemo::_initialized = FALSE;
+MICOMT::Mutex TypeCodeMemo::_lock;
+CORBA::ULongLong TypeCodeMemo::_serial = 1;
+#ifdef HAVE_THREADS
+MICOMT::Thread::ThreadKey TypeCodeMemo::_key;
+#else
+TypeCodeMemo::Slot *TypeCodeMemo::_slots = 0;
+#endif
+
+void
+TypeCodeMemo::init ()
+{
+    if (_initialized)
+	return;
+#ifdef HAVE_THREADS
+    MICOMT::Thread::create_key (_key, TypeCodeMemo::destroy);
+#endif
+    _initialized = TRUE;
+}
+
+CORBA::ULongLong
+TypeCodeMemo::next_serial ()
+{
+    MICOMT::AutoLock l (_lock);
+    return ++_serial;
+}
+
+TypeCodeMemo::Slot *
+TypeCodeMemo::slots (CORBA::Boolean create)
+{
+    if (!_initialized)
+	return 0;
+#ifdef HAVE_THREADS
+    Slot *s = (Slot *)MICOMT::Thread::get_specific (_key);
+    if (!s && create) {
+	s = new Slot[Slots];
+	memset ((void *)s, 0, Slots * sizeof (Slot));
+	MICOMT::Thread::set_specific (_key, s);
+    }
+    return s;
+#else
+    if (!_slots && create) {
+	_slots = new Slot[Slots];
+	memset ((void *)_slots, 0, Slots * sizeof (Slot));
+    }
+    return _slots;
+#endif
+}
+
+void
+TypeCodeMemo::destroy (void *s)
+{
+    delete[] (Slot *)s;
+}
+
+TypeCodeMemo::Slot &
+TypeCodeMemo::slot (Slot *s, CORBA::ULongLong a, CORBA::ULongLong b,
+		    CORBA::Octet mode)
+{
+    CORBA::ULongLong h = a * 0x9e3779b97f4a7c15ULL ^ b * 31 ^ mode;
+    return s[(h ^ (h >> 32)) & (Slots-1)];
+}
+
+CORBA::Boolean
+TypeCodeMemo::lookup (CORBA::ULongLong a, CORBA::ULongLong b,
+		      CORBA::Octet mode, CORBA::Boolean &res)
+{
+    Slot *s = slots (FALSE);
+    if (!s)
+	return FALSE;
+    Slot &e = slot (s, a, b, mode);
+    if (e.a != a || e.b != b || e.mode != mode)
+	return FALSE;
+    res = e.res;
+    return TRUE;
+}
+
+void
+TypeCodeMemo::insert (CORBA::ULongLong a, CORBA::ULongLong b,
+		      CORBA::Octet mode, CORBA::Boolean res)
+{
+    Slot *s = slots (TRUE);
+    if (!s)
+	return;
+    Slot &e = slot (s, a, b, mode);
+    e.a = a;
+    e.b = b;
+    e.mode = mode;
+    e.res = res;
+}
+
+static inline CORBA::ULong
+fp_mix (CORBA::ULong h, CORBA::ULong v)
+{
+    return (h ^ v) * 16777619;
+}
+
+static inline CORBA::ULong
+fp_mix (CORBA::ULong h, const string &s)
+{
+    for (string::size_type i = 0; i < s.length(); ++i)
+	h = fp_mix (h, (CORBA::Octet)s[i]);
+    return fp_mix (h, s.length());
+}
+
+void
+CORBA::TypeCode::_init ()
+{
+    TypeCodeMemo::init ();
+}
+
+/*
+ * the fingerprint is a hash over everything equal() and equaltype()
+ * both look at: it ignores names, aliases, string bounds and the
+ * repository ids of constructed types. so typecodes with different
+ * fingerprints are neither equal nor equivalent. typecodes that
+ * contain recursive types have no fingerprint.
+ */
+CORBA::Boolean
+CORBA::TypeCode::fingerprint (ULong &h, ULongLong &serial) const
+{
+    if (fp_serial == 0) {
+	ULong f = fp_mix (2166136261U, (ULong)tckind);
+	ULong cf;
+	ULongLong cs;
+	Boolean ok = TRUE;
+
+	switch (tckind) {
+	case tk_recursive:
+	    ok = FALSE;
+	    break;
+
+	case tk_alias:
+	    ok = content->fingerprint (f, cs);
+	    break;
+
+	case tk_fixed:
+	    f = fp_mix (fp_mix (f, digits), (ULong)scale);
+	    break;
+
+	case tk_sequence:
+	case tk_array:
+	case tk_value_box:
+	    ok = content->fingerprint (cf, cs);
+	    f = fp_mix (fp_mix (f, len), cf);
+	    break;
+
+	case tk_objref:
+	case tk_abstract_interface:
+	case tk_local_interface:
+	case tk_native:
+	    f = fp_mix (f, repoid);
+	    break;
+
+	case tk_enum:
+	    for (mico_vec_size_type i = 0; i < namevec.size(); ++i)
+		f = fp_mix (f, namevec[i]);
+	    break;
+
+	case tk_union:
+	    ok = discriminator->fingerprint (cf, cs);
+	    f = fp_mix (f, cf);
+	    // fall through
+	case tk_struct:
+	case tk_except:
+	case tk_value:
+	    f = fp_mix (f, tcvec.size());
+	    if (tckind == tk_value)
+		f = fp_mix (f, (ULong)value_mod);
+	    for (mico_vec_size_type i = 0; ok && i < tcvec.size(); ++i) {
+		ok = tcvec[i]->fingerprint (cf, cs);
+		f = fp_mix (f, cf);
+		if (tckind == tk_value)
+		    f = fp_mix (f, (ULong)visvec[i]);
+	    }
+	    break;
+
+	default:
+	    break;
+	}
+	fp = f;
+	fp_serial = ok ? TypeCodeMemo::next_serial () : 1;
+    }
+    h = fp;
+    serial = fp_serial;
+    return serial != 1;
+}
+
 CORBA::Boolean
 CORBA::TypeCode::equal (TypeCode_ptr tc,
 			Boolean remove_aliases,
@@ -611,6 +845,34 @@ CORBA::TypeCode::equal (TypeCode_ptr tc,
 {
     MICO_OBJ_CHECK (this);
 
+    if (this == tc)
+	return TRUE;
+
+    ULong myfp, hisfp;
+    ULongLong me, he;
+    if (!fingerprint (myfp, me) || !tc->fingerprint (hisfp, he))
+	return compare (tc, remove_aliases, ignore_string_bounds);
+    if (myfp != hisfp)
+	return FALSE;
+    if (tcvec.size() == 0 && CORBA::is_nil (content))
+	return compare (tc, remove_aliases, ignore_string_bounds);
+
+    Octet mode = (remove_aliases ? 1 : 0) | (ignore_string_bounds ? 2 : 0);
+    Boolean res;
+    if (!TypeCodeMemo::lookup (me, he, mode, res)) {
+	res = compare (tc, remove_aliases, ignore_string_bounds);
+	TypeCodeMemo::insert (me, he, mode, res);
+    }
+    return res;
+}
+
+CORBA::Boolean
+CORBA::TypeCode::compare (TypeCode_ptr tc,
+			  Boolean remove_aliases,
+			  Boolean ignore_string_bounds) const
+{
+    MICO_OBJ_CHECK (this);
+
     if (this == tc)
 	return TRUE;
 
@@ -757,6 +1019,29 @@ CORBA::TypeCode::equivalent (TypeCode_ptr tc)
 
 CORBA::Boolean
 CORBA::TypeCode::equaltype (TypeCode_ptr tc, SetTC *_cache)
+{
+    if (this == tc)
+	return TRUE;
+
+    ULong myfp, hisfp;
+    ULongLong me, he;
+    if (!fingerprint (myfp, me) || !tc->fingerprint (hisfp, he))
+	return compare_type (tc, _cache);
+    if (myfp != hisfp)
+	return FALSE;
+    if (tcvec.size() == 0 && CORBA::is_nil (content))
+	return compare_type (tc, _cache);
+
+    Boolean res;
+    if (!TypeCodeMemo::lookup (me, he, TypeCodeMemo::EqualType, res)) {
+	res = compare_type (tc, _cache);
+	TypeCodeMemo::insert (me, he, TypeCodeMemo::EqualType, res);
+    }
+    return res;
+}
+
+CORBA::Boolean
+CORBA::TypeCode::compare_type (TypeCode_ptr tc, SetTC *_cache)
 {
     if (this == tc)
 	return TRUE;
@@ -1686,6 +1971,252 @@ bad:
 
 #undef check
 
+
+/*
+ * process wide cache of decoded typecodes for decode_shared(), keyed
+ * by their encoding. the same few typecodes tend to arrive over and
+ * over again in Anys; all of them get the same TypeCode. decoded
+ * typecodes are never changed, so they can be shared.
+ *
+ * only typecodes with an encapsulation are cached. the decoded
+ * typecode depends on the encapsulation, on the kind and on the
+ * code sets its strings were transmitted in.
+ */
+class TypeCodeCache {
+public:
+    static CORBA::ULong max_entries;
+    static CORBA::ULong max_bytes;
+    static CORBA::Boolean lru;
+
+    static CORBA::TypeCode_ptr decode (CORBA::DataDecoder &);
+    static void limits (CORBA::ULong entries, CORBA::ULong bytes,
+			CORBA::Boolean lru);
+    static void stats (CORBA::TypeCode::CacheStats &);
+
+private:
+    struct Key {
+	CORBA::ULong kind;
+	CORBA::ULong tcs_c;
+	CORBA::ULong tcs_w;
+	CORBA::ULong hash;
+	CORBA::ULong len;
+	const CORBA::Octet *data;
+
+	bool operator< (const Key &k) const
+	{
+	    if (hash != k.hash)
+		return hash < k.hash;
+	    if (len != k.len)
+		return len < k.len;
+	    if (kind != k.kind)
+		return kind < k.kind;
+	    if (tcs_c != k.tcs_c)
+		return tcs_c < k.tcs_c;
+	    if (tcs_w != k.tcs_w)
+		return tcs_w < k.tcs_w;
+	    return memcmp (data, k.data, len) < 0;
+	}
+    };
+    struct Entry;
+    typedef map<Key, Entry *> MapKeyEntry;
+    typedef list<Entry *> ListEntry;
+    struct Entry {
+	Key key;
+	CORBA::TypeCode_ptr tc;
+	ListEntry::iterator pos;
+    };
+
+    static CORBA::TypeCode_ptr decode_plain (CORBA::DataDecoder &);
+    static void insert (Entry *);
+    static void evict ();
+
+    static MICOMT::Mutex _lock;
+    static MapKeyEntry _entries;
+    // most recently used first
+    static ListEntry _used;
+    static CORBA::ULong _bytes;
+    static CORBA::ULong _hits;
+    static CORBA::ULong _misses;
+};
+
+CORBA::ULong TypeCodeCache::max_entries = 512;
+CORBA::ULong TypeCodeCache::max_bytes = 1024*1024;
+CORBA::Boolean TypeCodeCache::lru = TRUE;
+MICOMT::Mutex TypeCodeCache::_lock;
+TypeCodeCache::MapKeyEntry TypeCodeCache::_entries;
+TypeCodeCache::ListEntry TypeCodeCache::_used;
+CORBA::ULong TypeCodeCache::_bytes = 0;
+CORBA::ULong TypeCodeCache::_hits = 0;
+CORBA::ULong TypeCodeCache::_misses = 0;
+
+CORBA::TypeCode_ptr
+TypeCodeCache::decode_plain (CORBA::DataDecoder &dc)
+{
+    CORBA::TypeCode_ptr tc = CORBA::TypeCode::create_basic_tc (CORBA::tk_null);
+    if (!dc.get_typecode (*tc)) {
+	CORBA::release (tc);
+	return CORBA::TypeCode::_nil();
+    }
+    return tc;
+}
+
+CORBA::TypeCode_ptr
+TypeCodeCache::decode (CORBA::DataDecoder &dc)
+{
+    CORBA::Buffer *buf = dc.buffer();
+    CORBA::ULong start = buf->rpos();
+    CORBA::ULong k, len;
+
+    // inside chunked values the encapsulation may be split up
+    if (max_entries == 0 || dc.chunking() || strcmp (dc.type(), "cdr"))
+	return decode_plain (dc);
+
+    if (!dc.enumeration (k))
+	return CORBA::TypeCode::_nil();
+
+    switch (k) {
+    case CORBA::tk_objref:
+    case CORBA::tk_struct:
+    case CORBA::tk_union:
+    case CORBA::tk_enum:
+    case CORBA::tk_sequence:
+    case CORBA::tk_array:
+    case CORBA::tk_alias:
+    case CORBA::tk_except:
+    case CORBA::tk_value:
+    case CORBA::tk_value_box:
+    case CORBA::tk_native:
+    case CORBA::tk_abstract_interface:
+    case CORBA::tk_local_interface:
+	if (dc.get_ulong (len) && len <= buf->length() && len <= max_bytes)
+	    break;
+	// fall through
+    default:
+	buf->rseek_beg (start);
+	return decode_plain (dc);
+    }
+
+    Key key;
+    key.kind = k;
+    CORBA::CodeSetCoder *conv = dc.converter();
+    key.tcs_c = conv ? conv->tcs_c() : 0;
+    key.tcs_w = conv ? conv->tcs_w() : 0;
+    key.len = len;
+    key.data = buf->data();
+    // FNV-1a
+    key.hash = 2166136261UL;
+    for (CORBA::ULong i = 0; i < len; ++i)
+	key.hash = (key.hash ^ key.data[i]) * 16777619UL;
+
+    {
+	MICOMT::AutoLock l (_lock);
+	MapKeyEntry::iterator i = _entries.find (key);
+	if (i != _entries.end()) {
+	    ++_hits;
+	    Entry *e = (*i).second;
+	    if (lru)
+		_used.splice (_used.begin(), _used, e->pos);
+	    buf->rseek_rel (len);
+	    return CORBA::TypeCode::_duplicate (e->tc);
+	}
+	++_misses;
+    }
+
+    CORBA::Octet *data = new CORBA::Octet[len];
+    memcpy (data, key.data, len);
+    key.data = data;
+
+    buf->rseek_beg (start);
+    CORBA::TypeCode_ptr tc = decode_plain (dc);
+    if (CORBA::is_nil (tc)) {
+	delete[] data;
+	return tc;
+    }
+
+    Entry *e = new Entry;
+    e->key = key;
+    e->tc = CORBA::TypeCode::_duplicate (tc);
+    insert (e);
+    return tc;
+}
+
+void
+TypeCodeCache::insert (Entry *e)
+{
+    MICOMT::AutoLock l (_lock);
+
+    if (_entries.count (e->key) ||
+	(!lru && (_entries.size() >= max_entries ||
+		  _bytes + e->key.len > max_bytes))) {
+	// decoded by another thread meanwhile, or full
+	CORBA::release (e->tc);
+	delete[] e->key.data;
+	delete e;
+	return;
+    }
+    _entries[e->key] = e;
+    e->pos = _used.insert (_used.begin(), e);
+    _bytes += e->key.len;
+    evict ();
+}
+
+void
+TypeCodeCache::evict ()
+{
+    while (!_used.empty() &&
+	   (_entries.size() > max_entries || _bytes > max_bytes)) {
+	Entry *e = _used.back();
+	_used.pop_back();
+	_entries.erase (e->key);
+	_bytes -= e->key.len;
+	CORBA::release (e->tc);
+	delete[] e->key.data;
+	delete e;
+    }
+}
+
+void
+TypeCodeCache::limits (CORBA::ULong entries, CORBA::ULong bytes,
+		       CORBA::Boolean _lru)
+{
+    MICOMT::AutoLock l (_lock);
+    max_entries = entries;
+    max_bytes = bytes;
+    lru = _lru;
+    evict ();
+}
+
+void
+TypeCodeCache::stats (CORBA::TypeCode::CacheStats &st)
+{
+    MICOMT::AutoLock l (_lock);
+    st.hits = _hits;
+    st.misses = _misses;
+    st.entries = _entries.size();
+    st.bytes = _bytes;
+    st.max_entries = max_entries;
+    st.max_bytes = max_bytes;
+    st.lru = lru;
+}
+
+CORBA::TypeCode_ptr
+CORBA::TypeCode::decode_shared (DataDecoder &dc)
+{
+    return TypeCodeCache::decode (dc);
+}
+
+void
+CORBA::TypeCode::cache_limits (ULong entries, ULong bytes, Boolean lru)
+{
+    TypeCodeCache::limits (entries, bytes, lru);
+}
+
+void
+CORBA::TypeCode::cache_stats (CacheStats &st)
+{
+    TypeCodeCache::stats (st);
+}
+
 void
 CORBA::TypeCode::encode (DataEncoder &ec, MapTCPos *_omap) const
 {
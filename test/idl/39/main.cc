@@ -0,0 +1,271 @@
+//
+// Test for the bulk marshalling of sequences and arrays of structs.
+//
+// Every sequence is encoded in big and little endian byte order, once
+// with the sequence marshaller and once element by element, and both
+// encodings must be the same. The sequence marshaller must decode the
+// data again and must refuse truncated data. With -bench <n> the time
+// to marshal n Point3Ds in bulk and one by one is measured.
+//
+
+#include "bulk.h"
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static const CORBA::ULong N = 17;
+
+static CORBA::Boolean
+eq (const Point3D &a, const Point3D &b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+static CORBA::Boolean
+eq (const SlowPoint &a, const SlowPoint &b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+static CORBA::Boolean
+eq (const Sample &a, const Sample &b)
+{
+    return a.id == b.id && a.value == b.value &&
+	a.s[0] == b.s[0] && a.s[1] == b.s[1];
+}
+
+static CORBA::Boolean
+eq (const Padded &a, const Padded &b)
+{
+    return a.d == b.d && a.l == b.l;
+}
+
+static CORBA::Boolean
+eq (const Flags &a, const Flags &b)
+{
+    return a.a == b.a && a.b == b.b && a.c == b.c && a.s == b.s;
+}
+
+static CORBA::Boolean
+eq (const Nested &a, const Nested &b)
+{
+    return eq (a.p, b.p) && a.w[0] == b.w[0] && a.w[1] == b.w[1];
+}
+
+static void
+fill (Point3D &p, CORBA::ULong i)
+{
+    p.x = i + 0.5;
+    p.y = -(double)i;
+    p.z = i * 1e10;
+}
+
+static void
+fill (SlowPoint &p, CORBA::ULong i)
+{
+    p.x = i + 0.5;
+    p.y = -(double)i;
+    p.z = i * 1e10;
+}
+
+static void
+fill (Sample &s, CORBA::ULong i)
+{
+    s.id = 1000 + i;
+    s.value = i / 4.0f;
+    s.s[0] = -(CORBA::Short)i;
+    s.s[1] = (CORBA::Short)(i * 257);
+}
+
+static void
+fill (Padded &p, CORBA::ULong i)
+{
+    p.d = i * 0.25;
+    p.l = -7 * (CORBA::Long)i;
+}
+
+static void
+fill (Flags &f, CORBA::ULong i)
+{
+    f.a = 0x01020304 + i;
+    f.b = (i & 1) != 0;
+    f.c = (CORBA::Char)('a' + i);
+    f.s = (CORBA::Short)(i * 3);
+}
+
+static void
+fill (Nested &n, CORBA::ULong i)
+{
+    fill (n.p, i);
+    n.w[0] = i * 2.0;
+    n.w[1] = i * -3.0;
+}
+
+/*
+ * both encodings start with an octet, so the data needs alignment.
+ */
+template<class S>
+static CORBA::Boolean
+check (S &, CORBA::StaticTypeInfo *seq, CORBA::StaticTypeInfo *elem,
+       CORBA::ByteOrder bo)
+{
+    CORBA::Boolean ok = TRUE;
+    S s;
+    s.length (N);
+    for (CORBA::ULong i = 0; i < N; ++i)
+	fill (s[i], i);
+
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo);
+    ec.put_octet (1);
+    seq->marshal (ec, &s);
+
+    MICO::CDREncoder ref (new CORBA::Buffer, TRUE, bo);
+    ref.put_octet (1);
+    ref.put_ulong (N);
+    for (CORBA::ULong i = 0; i < N; ++i)
+	elem->marshal (ref, &s[i]);
+
+    CORBA::Buffer *b = ec.buffer();
+    CORBA::Buffer *r = ref.buffer();
+    if (b->length() != r->length() ||
+	memcmp (b->data(), r->data(), b->length()))
+	ok = FALSE;
+
+    MICO::CDRDecoder dc (b, FALSE, bo);
+    CORBA::Octet o;
+    S t;
+    dc.get_octet (o);
+    if (!seq->demarshal (dc, &t) || t.length() != N || b->length() != 0)
+	ok = FALSE;
+    for (CORBA::ULong i = 0; ok && i < N; ++i) {
+	if (!eq (t[i], s[i]))
+	    ok = FALSE;
+    }
+
+    // the last element is cut short
+    CORBA::Buffer cut;
+    cut.put (r->data(), r->length() - 1);
+    MICO::CDRDecoder cdc (&cut, FALSE, bo);
+    cdc.get_octet (o);
+    if (seq->demarshal (cdc, &t))
+	ok = FALSE;
+    return ok;
+}
+
+static CORBA::Boolean
+check_array (CORBA::ByteOrder bo)
+{
+    CORBA::Boolean ok = TRUE;
+    PointArray a, t;
+    for (CORBA::ULong i = 0; i < 3; ++i)
+	fill (a[i], i);
+
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo);
+    ec.put_octet (1);
+    _marshaller__a3_Point3D->marshal (ec, a);
+
+    MICO::CDREncoder ref (new CORBA::Buffer, TRUE, bo);
+    ref.put_octet (1);
+    for (CORBA::ULong i = 0; i < 3; ++i)
+	_marshaller_Point3D->marshal (ref, &a[i]);
+
+    CORBA::Buffer *b = ec.buffer();
+    CORBA::Buffer *r = ref.buffer();
+    if (b->length() != r->length() ||
+	memcmp (b->data(), r->data(), b->length()))
+	ok = FALSE;
+
+    MICO::CDRDecoder dc (b, FALSE, bo);
+    CORBA::Octet o;
+    dc.get_octet (o);
+    if (!_marshaller__a3_Point3D->demarshal (dc, t) || b->length() != 0)
+	ok = FALSE;
+    for (CORBA::ULong i = 0; ok && i < 3; ++i) {
+	if (!eq (t[i], a[i]))
+	    ok = FALSE;
+    }
+
+    CORBA::Buffer cut;
+    cut.put (r->data(), r->length() - 1);
+    MICO::CDRDecoder cdc (&cut, FALSE, bo);
+    cdc.get_octet (o);
+    if (_marshaller__a3_Point3D->demarshal (cdc, t))
+	ok = FALSE;
+    return ok;
+}
+
+static void
+test (CORBA::ByteOrder bo, const char *name)
+{
+    Points p;
+    SlowPoints sp;
+    Samples s;
+    PaddedSeq ps;
+    FlagsSeq fs;
+    NestedSeq ns;
+
+    cout << name << " Points: "
+	 << !!check (p, _marshaller__seq_Point3D, _marshaller_Point3D, bo)
+	 << endl;
+    cout << name << " SlowPoints: "
+	 << !!check (sp, _marshaller__seq_SlowPoint, _marshaller_SlowPoint, bo)
+	 << endl;
+    cout << name << " PointArray: " << !!check_array (bo) << endl;
+    cout << name << " Samples: "
+	 << !!check (s, _marshaller__seq_Sample, _marshaller_Sample, bo)
+	 << endl;
+    cout << name << " PaddedSeq: "
+	 << !!check (ps, _marshaller__seq_Padded, _marshaller_Padded, bo)
+	 << endl;
+    cout << name << " FlagsSeq: "
+	 << !!check (fs, _marshaller__seq_Flags, _marshaller_Flags, bo)
+	 << endl;
+    cout << name << " NestedSeq: "
+	 << !!check (ns, _marshaller__seq_Nested, _marshaller_Nested, bo)
+	 << endl;
+}
+
+template<class S>
+static void
+bench (CORBA::StaticTypeInfo *seq, CORBA::ULong n, const char *name)
+{
+    S s, t;
+    s.length (n);
+    for (CORBA::ULong i = 0; i < n; ++i)
+	fill (s[i], i);
+
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE);
+    CORBA::ULongLong t0 = OSMisc::nanotime ();
+    seq->marshal (ec, &s);
+    CORBA::ULongLong t1 = OSMisc::nanotime ();
+    MICO::CDRDecoder dc (ec.buffer(), FALSE);
+    seq->demarshal (dc, &t);
+    CORBA::ULongLong t2 = OSMisc::nanotime ();
+
+    cout << name << ": marshal " << (t1 - t0) / 1000 << " us, "
+	 << "demarshal " << (t2 - t1) / 1000 << " us" << endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv, "mico-local-orb");
+
+    if (argc > 2 && !strcmp (argv[1], "-bench")) {
+	CORBA::ULong n = atol (argv[2]);
+	bench<Points> (_marshaller__seq_Point3D, n, "bulk");
+	bench<SlowPoints> (_marshaller__seq_SlowPoint, n, "one by one");
+	return 0;
+    }
+
+    test (CORBA::BigEndian, "big endian");
+    test (CORBA::LittleEndian, "little endian");
+    return 0;
+}
@@ -0,0 +1,166 @@
+//
+// Test for the inline coding of primitive struct members.
+//
+// A struct is encoded in big and little endian byte order with its
+// marshaller, one of these byte orders being native and coded with
+// CORBA::NativeCDR, and member by member through the codec. Both
+// encodings must be the same, must decode again and truncated data
+// must be refused. With -bench <n> the time to marshal n structs in
+// native and in opposite byte order is measured.
+//
+
+#include "native.h"
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static void
+fill (Mixed &m, CORBA::ULong i)
+{
+    m.o = (CORBA::Octet)(0x80 + i);
+    m.id = -(CORBA::Long)(i * 65537);
+    m.c = (CORBA::Char)('a' + i % 26);
+    m.b = (i & 1) != 0;
+    m.us = (CORBA::UShort)(0xfff0 + i);
+    m.name = (const char *)(i & 1 ? "odd" : "");
+    m.ll = -(CORBA::LongLong)i * 1000000007;
+    m.color = (Color)(i % 3);
+    m.f = i / 8.0f;
+    m.inner.s = -(CORBA::Short)i;
+    m.inner.d = i * 1e100;
+    m.ull = (CORBA::ULongLong)i << 40;
+    m.ul = 0x01020304 + i;
+    m.d = -(double)i / 3;
+}
+
+static CORBA::Boolean
+eq (const Mixed &a, const Mixed &b)
+{
+    return a.o == b.o && a.id == b.id && a.c == b.c && a.b == b.b &&
+	a.us == b.us && !strcmp (a.name, b.name) && a.ll == b.ll &&
+	a.color == b.color && a.f == b.f && a.inner.s == b.inner.s &&
+	a.inner.d == b.inner.d && a.ull == b.ull && a.ul == b.ul &&
+	a.d == b.d;
+}
+
+static void
+put (CORBA::DataEncoder &ec, const Mixed &m)
+{
+    ec.put_octet (m.o);
+    ec.put_long (m.id);
+    ec.put_char (m.c);
+    ec.put_boolean (m.b);
+    ec.put_ushort (m.us);
+    ec.put_string (m.name.in());
+    ec.put_longlong (m.ll);
+    ec.enumeration (m.color);
+    ec.put_float (m.f);
+    ec.put_short (m.inner.s);
+    ec.put_double (m.inner.d);
+    ec.put_ulonglong (m.ull);
+    ec.put_ulong (m.ul);
+    ec.put_double (m.d);
+}
+
+static CORBA::Boolean
+check (CORBA::ByteOrder bo)
+{
+    CORBA::Boolean ok = TRUE;
+    MixedSeq s;
+    s.length (5);
+    for (CORBA::ULong i = 0; i < s.length(); ++i)
+	fill (s[i], i);
+
+    // the leading octet makes the codec align the data
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo);
+    ec.put_octet (1);
+    _marshaller__seq_Mixed->marshal (ec, &s);
+
+    MICO::CDREncoder ref (new CORBA::Buffer, TRUE, bo);
+    ref.put_octet (1);
+    ref.put_ulong (s.length());
+    for (CORBA::ULong i = 0; i < s.length(); ++i)
+	put (ref, s[i]);
+
+    CORBA::Buffer *b = ec.buffer();
+    CORBA::Buffer *r = ref.buffer();
+    if (b->length() != r->length() ||
+	memcmp (b->data(), r->data(), b->length()))
+	ok = FALSE;
+
+    MICO::CDRDecoder dc (b, FALSE, bo);
+    CORBA::Octet o;
+    MixedSeq t;
+    dc.get_octet (o);
+    if (!_marshaller__seq_Mixed->demarshal (dc, &t) ||
+	t.length() != s.length() || b->length() != 0)
+	ok = FALSE;
+    for (CORBA::ULong i = 0; ok && i < s.length(); ++i) {
+	if (!eq (t[i], s[i]))
+	    ok = FALSE;
+    }
+
+    // every member of the last struct is cut short once
+    for (CORBA::ULong l = r->length() - 1; l > r->length() - 60; --l) {
+	CORBA::Buffer cut;
+	cut.put (r->data(), l);
+	MICO::CDRDecoder cdc (&cut, FALSE, bo);
+	cdc.get_octet (o);
+	if (_marshaller__seq_Mixed->demarshal (cdc, &t))
+	    ok = FALSE;
+    }
+    return ok;
+}
+
+static void
+bench (CORBA::ULong n, CORBA::ByteOrder bo, const char *name)
+{
+    MixedSeq s, t;
+    s.length (n);
+    for (CORBA::ULong i = 0; i < n; ++i)
+	fill (s[i], i);
+
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo);
+    CORBA::ULongLong t0 = OSMisc::nanotime ();
+    _marshaller__seq_Mixed->marshal (ec, &s);
+    CORBA::ULongLong t1 = OSMisc::nanotime ();
+    MICO::CDRDecoder dc (ec.buffer(), FALSE, bo);
+    _marshaller__seq_Mixed->demarshal (dc, &t);
+    CORBA::ULongLong t2 = OSMisc::nanotime ();
+
+    cout << name << ": marshal " << (t1 - t0) / 1000 << " us, "
+	 << "demarshal " << (t2 - t1) / 1000 << " us" << endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv, "mico-local-orb");
+
+    MICO::CDREncoder ec;
+    CORBA::ByteOrder native = ec.byteorder();
+    CORBA::ByteOrder swapped = native == CORBA::BigEndian
+	? CORBA::LittleEndian : CORBA::BigEndian;
+
+    if (argc > 2 && !strcmp (argv[1], "-bench")) {
+	CORBA::ULong n = atol (argv[2]);
+	bench (n, native, "native");
+	bench (n, swapped, "swapped");
+	return 0;
+    }
+
+    cout << "native_cdr: " << !!ec.native_cdr() << endl;
+    MICO::CDREncoder sec (new CORBA::Buffer, TRUE, swapped);
+    cout << "swapped native_cdr: " << !!sec.native_cdr() << endl;
+
+    cout << "big endian: " << !!check (CORBA::BigEndian) << endl;
+    cout << "little endian: " << !!check (CORBA::LittleEndian) << endl;
+    return 0;
+}
@@ -0,0 +1,175 @@
+//
+// Stress test for the ORB's table of pending invocations.
+//
+// usage: invoke [threads [invocations per thread]]
+//
+// Every thread adds its own invocations, then looks up and removes the
+// invocations of its neighbour, so that each lookup is done by a
+// different thread than the one that added the record. Finally all
+// threads add, look up and remove invocations at the same time while
+// probing for the records of the other threads.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static MICO::InvokeTable *table;
+static CORBA::ULong nthreads;
+static CORBA::ULong num;
+
+static MICOMT::Mutex errors_lock;
+static CORBA::ULong errors = 0;
+
+static void
+error (const char *what, CORBA::ULong id)
+{
+    MICOMT::AutoLock l(errors_lock);
+    if (errors++ < 10)
+	cerr << what << " " << id << endl;
+}
+
+// ids are interleaved between the threads like the ORB's message ids
+static CORBA::ULong
+msgid (CORBA::ULong thread, CORBA::ULong i)
+{
+    return i * nthreads + thread + 1;
+}
+
+static void
+fill (CORBA::ULong t)
+{
+    for (CORBA::ULong i = 0; i < num; ++i) {
+	CORBA::ORBInvokeRec_var rec = new CORBA::ORBInvokeRec (msgid (t, i));
+	table->add (rec);
+    }
+}
+
+static void
+lookup (CORBA::ULong t)
+{
+    CORBA::ULong other = (t + 1) % nthreads;
+    for (CORBA::ULong i = 0; i < num; ++i) {
+	CORBA::ULong id = msgid (other, i);
+	CORBA::ORBInvokeRec_var rec = table->get (id);
+	if (!rec.in() || rec->id() != id)
+	    error ("lookup failed for", id);
+    }
+}
+
+static void
+drain (CORBA::ULong t)
+{
+    CORBA::ULong other = (t + 1) % nthreads;
+    for (CORBA::ULong i = 0; i < num; ++i)
+	table->remove (msgid (other, i));
+}
+
+static void
+churn (CORBA::ULong t)
+{
+    for (CORBA::ULong i = 0; i < num; ++i) {
+	CORBA::ULong id = msgid (t, i);
+	CORBA::ORBInvokeRec_var rec = new CORBA::ORBInvokeRec (id);
+	table->add (rec);
+
+	// may or may not be there, but must not be mixed up
+	CORBA::ULong probe = msgid ((t + 1) % nthreads, i);
+	CORBA::ORBInvokeRec_var other = table->get (probe);
+	if (other.in() && other->id() != probe)
+	    error ("wrong record for", probe);
+
+	CORBA::ORBInvokeRec_var mine = table->get (id);
+	if (mine.in() != rec.in())
+	    error ("lost record", id);
+	table->remove (id);
+	mine = table->get (id);
+	if (mine.in())
+	    error ("record not removed", id);
+    }
+}
+
+typedef void (*Phase) (CORBA::ULong);
+
+#ifdef HAVE_THREADS
+
+class Worker : public virtual MICOMT::Thread {
+    Phase _phase;
+    CORBA::ULong _t;
+public:
+    Worker (Phase p, CORBA::ULong t)
+	: _phase (p), _t (t)
+    {}
+    void _run (void *)
+    {
+	_phase (_t);
+    }
+};
+
+#endif // HAVE_THREADS
+
+static double
+run (Phase p)
+{
+    OSMisc::TimeVal t1 = OSMisc::gettime();
+#ifdef HAVE_THREADS
+    vector<Worker *> workers;
+    for (CORBA::ULong t = 0; t < nthreads; ++t)
+	workers.push_back (new Worker (p, t));
+    for (CORBA::ULong t = 0; t < nthreads; ++t)
+	workers[t]->start();
+    for (CORBA::ULong t = 0; t < nthreads; ++t) {
+	workers[t]->wait();
+	delete workers[t];
+    }
+#else // HAVE_THREADS
+    for (CORBA::ULong t = 0; t < nthreads; ++t)
+	p (t);
+#endif // HAVE_THREADS
+    OSMisc::TimeVal t2 = OSMisc::gettime();
+    double usecs = (t2.tv_sec - t1.tv_sec) * 1000000.0 +
+	(t2.tv_usec - t1.tv_usec);
+    return usecs * 1000.0 / (nthreads * num);
+}
+
+int
+main (int argc, char *argv[])
+{
+    nthreads = argc > 1 ? atoi (argv[1]) : 100;
+    num = argc > 2 ? atoi (argv[2]) : 10000;
+    if (nthreads < 1 || num < 1) {
+	cerr << "usage: " << argv[0]
+	     << " [threads [invocations per thread]]" << endl;
+	return 1;
+    }
+    table = new MICO::InvokeTable;
+
+    double add_ns = run (fill);
+    if (table->size() != nthreads * num)
+	error ("wrong table size after adding", table->size());
+    double get_ns = run (lookup);
+    double del_ns = run (drain);
+    if (table->size() != 0)
+	error ("wrong table size after removing", table->size());
+    double churn_ns = run (churn);
+    if (table->size() != 0)
+	error ("wrong table size after churn", table->size());
+
+    cout << nthreads << " threads, " << num << " invocations each: "
+	 << add_ns << " ns per add, "
+	 << get_ns << " ns per cross-thread lookup, "
+	 << del_ns << " ns per cross-thread removal, "
+	 << churn_ns << " ns per add/lookup/remove" << endl;
+
+    delete table;
+    cout << (errors ? "FAILED" : "invoke table ok") << endl;
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+//
+// Throughput benchmark for the request thread pools.
+//
+// usage: pool [max threads [messages [producers]]]
+//
+// A number of producer threads feed short jobs into a thread pool the
+// same way GIOPConn::input_ready() feeds incoming requests into the
+// DeCode pool. The time until all jobs are done is measured for the
+// classic pool and for the work stealing pool, with 1, 2, 4, ... pool
+// threads up to the given maximum.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+#ifdef HAVE_THREADS
+
+static MICOMT::Mutex done_lock;
+static MICOMT::CondVar done_cond (&done_lock);
+static CORBA::ULong done = 0;
+
+// a job roughly as expensive as decoding and dispatching a small request
+class Job : public MICO::PassiveOperation {
+public:
+    Job ()
+    {
+	this->info().set_op_id (MICO::Operation::DeCode);
+    }
+    void process (MICO::msg_type *msg)
+    {
+	volatile CORBA::ULong x = 0;
+	for (CORBA::ULong i = 0; i < 2000; ++i)
+	    x += i * i;
+	delete msg;
+	MICOMT::AutoLock l(done_lock);
+	if (++done % 1000 == 0)
+	    done_cond.signal ();
+    }
+    MICO::Operation *copy () const
+    {
+	return new Job (*this);
+    }
+};
+
+class Producer : public virtual MICOMT::Thread {
+    MICO::ThreadPool *_tp;
+    CORBA::ULong _num;
+public:
+    Producer (MICO::ThreadPool *tp, CORBA::ULong num)
+	: _tp (tp), _num (num)
+    {}
+    void _run (void *)
+    {
+	for (CORBA::ULong i = 0; i < _num; ++i)
+	    _tp->put_msg (0, new MICO::msg_type (0));
+    }
+};
+
+static double
+run (MICO::ThreadPool *tp, CORBA::ULong num, CORBA::ULong producers)
+{
+    tp->set_operation (new Job);
+    tp->start_threads ();
+    done = 0;
+
+    OSMisc::TimeVal t1 = OSMisc::gettime();
+    vector<Producer *> prods;
+    for (CORBA::ULong i = 0; i < producers; ++i)
+	prods.push_back (new Producer (tp, num / producers));
+    for (CORBA::ULong i = 0; i < producers; ++i)
+	prods[i]->start ();
+    for (CORBA::ULong i = 0; i < producers; ++i) {
+	prods[i]->wait ();
+	delete prods[i];
+    }
+    {
+	MICOMT::AutoLock l(done_lock);
+	while (done < num / producers * producers)
+	    done_cond.timedwait (10);
+    }
+    OSMisc::TimeVal t2 = OSMisc::gettime();
+
+    tp->shutdown ();
+    delete tp;
+    return (t2.tv_sec - t1.tv_sec) + (t2.tv_usec - t1.tv_usec) / 1000000.0;
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ULong max = argc > 1 ? atoi (argv[1]) : 64;
+    CORBA::ULong num = argc > 2 ? atoi (argv[2]) : 200000;
+    CORBA::ULong producers = argc > 3 ? atoi (argv[3]) : 4;
+    if (max < 1 || num < 1 || producers < 1) {
+	cerr << "usage: " << argv[0]
+	     << " [max threads [messages [producers]]]" << endl;
+	return 1;
+    }
+    vector<unsigned int> no_affinity;
+
+    cout << "threads   classic msgs/s   stealing msgs/s" << endl;
+    for (CORBA::ULong n = 1; n <= max; n *= 2) {
+	MICO::ThreadPool *classic = new MICO::ThreadPool (n, 0, 0);
+	classic->register_input_mc (new MICO::ActiveMsgQueue ());
+	double t_classic = run (classic, num, producers);
+
+	MICO::ThreadPool *stealing = new MICO::StealingThreadPool
+	    (n, 1024, MICO::StealingThreadPool::Block, no_affinity);
+	double t_stealing = run (stealing, num, producers);
+
+	cout.width (7);
+	cout << n;
+	cout.width (17);
+	cout << (CORBA::ULong)(num / t_classic);
+	cout.width (18);
+	cout << (CORBA::ULong)(num / t_stealing) << endl;
+    }
+    return 0;
+}
+
+#else // HAVE_THREADS
+
+int
+main (int argc, char *argv[])
+{
+    cout << "thread pools need a MICO built with thread support" << endl;
+    return 0;
+}
+
+#endif // HAVE_THREADS
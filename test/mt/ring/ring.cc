@@ -0,0 +1,210 @@
+//
+// Stress test for the lock free message channels.
+//
+// usage: ring [threads [messages per thread]]
+//
+// Producer threads push numbered messages into a MsgRing while the
+// same number of consumer threads pop them, partly one by one and
+// partly in batches. Every message must come out exactly once. Then
+// a single producer sends messages through a PassiveRingMsgQueue and
+// a PassiveMsgQueue, which must keep them in order, and the time per
+// message is compared.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+#ifdef HAVE_THREADS
+
+static CORBA::ULong nthreads;
+static CORBA::ULong num;
+
+static MICOMT::Mutex errors_lock;
+static CORBA::ULong errors = 0;
+
+static void
+error (const char *what, CORBA::ULong n)
+{
+    MICOMT::AutoLock l(errors_lock);
+    if (errors++ < 10)
+	cerr << what << " " << n << endl;
+}
+
+static double
+elapsed (OSMisc::TimeVal &t1)
+{
+    OSMisc::TimeVal t2 = OSMisc::gettime();
+    return (t2.tv_sec - t1.tv_sec) * 1000000000.0 +
+	(t2.tv_usec - t1.tv_usec) * 1000.0;
+}
+
+static MICO::MsgRing *ring;
+static vector<CORBA::Octet> seen;
+
+class Producer : public virtual MICOMT::Thread {
+    CORBA::ULong _t;
+public:
+    Producer (CORBA::ULong t)
+	: _t (t)
+    {}
+    void _run (void *)
+    {
+	for (CORBA::ULong i = 0; i < num; ++i) {
+	    // 0 is NULL, so start at 1
+	    CORBA::ULong n = _t * num + i + 1;
+	    while (!ring->push ((void *)(unsigned long)n))
+		yield ();
+	}
+    }
+};
+
+class Consumer : public virtual MICOMT::Thread {
+    CORBA::ULong _t;
+public:
+    Consumer (CORBA::ULong t)
+	: _t (t)
+    {}
+    void _run (void *)
+    {
+	void *batch[8];
+	CORBA::ULong got = 0;
+	while (got < num) {
+	    CORBA::ULong n;
+	    if (_t % 2) {
+		n = ring->pop (batch, 8);
+	    } else {
+		batch[0] = ring->pop ();
+		n = batch[0] ? 1 : 0;
+	    }
+	    if (n == 0) {
+		yield ();
+		continue;
+	    }
+	    for (CORBA::ULong i = 0; i < n; ++i) {
+		CORBA::ULong id = (unsigned long)batch[i];
+		if (id == 0 || id > nthreads * num)
+		    error ("bad message", id);
+		else if (seen[id - 1]++)
+		    error ("duplicate message", id);
+	    }
+	    got += n;
+	}
+    }
+};
+
+static double
+mpmc ()
+{
+    ring = new MICO::MsgRing (1024);
+    seen.assign (nthreads * num, 0);
+
+    OSMisc::TimeVal t1 = OSMisc::gettime();
+    vector<MICOMT::Thread *> threads;
+    for (CORBA::ULong t = 0; t < nthreads; ++t) {
+	threads.push_back (new Producer (t));
+	threads.push_back (new Consumer (t));
+    }
+    for (CORBA::ULong t = 0; t < threads.size(); ++t)
+	threads[t]->start ();
+    for (CORBA::ULong t = 0; t < threads.size(); ++t) {
+	threads[t]->wait ();
+	delete threads[t];
+    }
+    double ns = elapsed (t1) / (nthreads * num);
+
+    for (CORBA::ULong i = 0; i < seen.size(); ++i) {
+	if (seen[i] != 1)
+	    error ("lost message", i + 1);
+    }
+    if (!ring->empty ())
+	error ("ring not empty, capacity", ring->capacity ());
+    delete ring;
+    return ns;
+}
+
+class Sender : public virtual MICOMT::Thread {
+    MICO::MsgChannel *_mc;
+public:
+    Sender (MICO::MsgChannel *mc)
+	: _mc (mc)
+    {}
+    void _run (void *)
+    {
+	for (CORBA::ULong i = 0; i < num; ++i)
+	    _mc->put_msg (0, new MICO::msg_type ((void *)(unsigned long)i));
+	_mc->put_msg (0, new MICO::msg_type (0, MICO::msg_type::Terminate));
+    }
+};
+
+static double
+hop (MICO::MsgChannel *mc)
+{
+    OSMisc::TimeVal t1 = OSMisc::gettime();
+    Sender sender (mc);
+    sender.start ();
+
+    MICO::msg_type *msgs[16];
+    CORBA::ULong next = 0;
+    CORBA::Boolean done = FALSE;
+    while (!done) {
+	CORBA::ULong n = mc->get_msgs (0, msgs, 16);
+	for (CORBA::ULong i = 0; i < n; ++i) {
+	    if (msgs[i]->get_type () == MICO::msg_type::Terminate) {
+		done = TRUE;
+	    } else if ((unsigned long)msgs[i]->data () != next++) {
+		error ("message out of order", next - 1);
+	    }
+	    delete msgs[i];
+	}
+    }
+    sender.wait ();
+    if (next != num)
+	error ("wrong number of messages", next);
+    double ns = elapsed (t1) / num;
+    delete mc;
+    return ns;
+}
+
+int
+main (int argc, char *argv[])
+{
+    nthreads = argc > 1 ? atoi (argv[1]) : 8;
+    num = argc > 2 ? atoi (argv[2]) : 100000;
+    if (nthreads < 1 || num < 1) {
+	cerr << "usage: " << argv[0]
+	     << " [threads [messages per thread]]" << endl;
+	return 1;
+    }
+
+    double mpmc_ns = mpmc ();
+    double queue_ns = hop (new MICO::PassiveMsgQueue ());
+    double ring_ns = hop (new MICO::PassiveRingMsgQueue (1024));
+
+    cout << nthreads << " producers and consumers, " << num
+	 << " messages each: " << mpmc_ns << " ns per message, "
+	 << "passive queue hop " << queue_ns << " ns, "
+	 << "passive ring hop " << ring_ns << " ns" << endl;
+
+    cout << (errors ? "FAILED" : "ring ok") << endl;
+    return errors ? 1 : 0;
+}
+
+#else // HAVE_THREADS
+
+int
+main (int argc, char *argv[])
+{
+    cout << "message channels need a MICO built with thread support" << endl;
+    return 0;
+}
+
+#endif // HAVE_THREADS
@@ -1,6 +1,7 @@
 
 #include "bench.h"
 #include <CORBA.h>
+#include <mico/os-misc.h>
 #include <iostream>
 #include <string>
 
@@ -163,12 +164,18 @@ try {
 	for (int i=0; i<thread_number; i++) {
 	    thr_array[i] = new Invoker;
 	}
+	OSMisc::TimeVal t1 = OSMisc::gettime();
 	for (int i=0; i<thread_number; i++) {
 	    thr_array[i]->start();
 	}
 	for (int i=0; i<thread_number; i++) {
 	    thr_array[i]->wait();
 	}
+	OSMisc::TimeVal t2 = OSMisc::gettime();
+	double secs = (t2.tv_sec - t1.tv_sec)
+	    + (t2.tv_usec - t1.tv_usec) / 1000000.0;
+	cout << "calls per second: "
+	     << (long)(num * (double)thread_number / secs) << endl;
 	//bench->shutdown();
 	orb->destroy();
 	return 0;
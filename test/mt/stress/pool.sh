@@ -0,0 +1,21 @@
+#!/bin/sh
+#
+# compares a single connection with a pool of connections between
+# a multi-threaded client and the server
+#
+# usage: pool.sh [connections [client threads [calls per thread]]]
+#
+CONNS=${1:-4}
+THREADS=${2:-16}
+CALLS=${3:-5000}
+ADDR=inet:localhost:7788
+
+./server -ORBIIOPAddr $ADDR -ORBThreadPerConnection > ref &
+SERVER=$!
+trap "kill $SERVER > /dev/null 2>&1" 0
+sleep 1
+for n in 1 $CONNS
+do
+	echo -n "$n connection(s), "
+	cat ref|./client -ORBConnectionsPerEndpoint $n ior perform $CALLS 0 $THREADS | grep "calls per second"
+done
@@ -0,0 +1,119 @@
+
+#include "val_impl.h"
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else
+#include <iostream.h>
+#endif
+
+using namespace std;
+
+class Test_impl
+    : virtual public POA_Test
+{
+    CORBA::Long
+    sum (const Pair &p)
+    {
+	return p.a->num() + p.b->num();
+    }
+
+    CORBA::Boolean
+    same (const Pair &p, Val *v)
+    {
+	// must be a copy of the callers value
+	v->num (v->num() + 100);
+	return p.a.in() == v && p.b.in() == v;
+    }
+
+    Pair *
+    swap (const Pair &p)
+    {
+	Pair *res = new Pair;
+	res->a = p.b;
+	res->b = p.a;
+	return res;
+    }
+
+    void
+    fill (CORBA::Long n, ValSeq_out s)
+    {
+	Val_var v = new Val_impl (n);
+	s = new ValSeq;
+	s->length (n);
+	for (CORBA::Long i = 0; i < n; ++i)
+	    (*s)[i] = v;
+    }
+
+    void
+    bump (Pair &p)
+    {
+	p.a->num (p.a->num() + 1);
+	p.b->num (p.b->num() + 1);
+    }
+
+    void
+    fail (const Pair &p)
+    {
+	Oops ex;
+	ex.p = p;
+	ex.p.a->num (-1);
+	throw ex;
+    }
+};
+
+int
+main (int argc, char *argv[])
+{
+  CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+  ValFactory_impl* fact = new ValFactory_impl;
+  orb->register_value_factory("IDL:Val:1.0", fact);
+
+  CORBA::Object_var poaobj = orb->resolve_initial_references ("RootPOA");
+  PortableServer::POA_var poa = PortableServer::POA::_narrow (poaobj);
+  PortableServer::POAManager_var mgr = poa->the_POAManager();
+
+  Test_impl* impl = new Test_impl;
+  PortableServer::ObjectId_var oid = poa->activate_object (impl);
+  mgr->activate ();
+
+  CORBA::Object_var obj = poa->id_to_reference (oid.in());
+  Test_var tt = Test::_narrow (obj);
+
+  Val_var v = new Val_impl (3);
+  Pair p;
+  p.a = v;
+  p.b = v;
+
+  cout << "sum: " << tt->sum (p) << endl;
+
+  cout << "same: " << (tt->same (p, v) ? "yes" : "no") << endl;
+  cout << "unchanged: " << v->num() << endl;
+
+  Pair q;
+  q.a = new Val_impl (1);
+  q.b = new Val_impl (2);
+  Pair_var r = tt->swap (q);
+  cout << "swap: " << r->a->num() << " " << r->b->num()
+       << (r->a.in() == q.b.in() ? " not copied" : "") << endl;
+
+  ValSeq_var s;
+  tt->fill (3, s);
+  cout << "fill: " << s->length() << " " << s[2]->num()
+       << ((s[0].in() == s[1].in() && s[1].in() == s[2].in())
+	   ? " shared" : " not shared") << endl;
+
+  tt->bump (p);
+  cout << "bump: " << p.a->num()
+       << (p.a.in() == p.b.in() ? " shared" : " not shared") << endl;
+
+  try {
+    tt->fail (p);
+    cout << "fail: no exception" << endl;
+  } catch (Oops &ex) {
+    cout << "fail: " << ex.p.a->num() << " " << ex.p.b->num() << endl;
+  }
+
+  poa->destroy (TRUE, TRUE);
+  return 0;
+}
@@ -0,0 +1,142 @@
+//
+// Test and micro-benchmark for marshalling sequences of primitive
+// types in both byte orders.
+//
+// Without arguments arrays of all sizes are encoded in big and little
+// endian byte order, decoded with the bulk and the single value
+// functions and compared. With -bench <n> the time to encode and
+// decode n doubles and longs in both byte orders is measured.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static const CORBA::ULong lengths[] = { 0, 1, 3, 7, 17, 33, 1001 };
+static const int nlengths = sizeof (lengths) / sizeof (lengths[0]);
+
+template<class T>
+static void
+fill (vector<T> &v, CORBA::ULong n)
+{
+    v.resize (n);
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	// different bytes everywhere, so a wrong swap shows
+	CORBA::Octet *b = (CORBA::Octet *)&v[i];
+	for (CORBA::ULong k = 0; k < sizeof (T); ++k)
+	    b[k] = (CORBA::Octet)(i*7 + k*31 + 1);
+    }
+}
+
+/*
+ * encode the values with the bulk function after an octet, so the
+ * data needs alignment, and check that both the bulk function and the
+ * single value function decode them again.
+ */
+#define CHECK(T, put_n, get_n, get_1) \
+    { \
+	vector<CORBA::T> v, w; \
+	fill (v, n); \
+	MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo); \
+	ec.put_octet (1); \
+	ec.put_n (n ? &v[0] : 0, n); \
+	MICO::CDRDecoder dc (ec.buffer(), FALSE, bo); \
+	CORBA::Octet o; \
+	dc.get_octet (o); \
+	w.resize (n); \
+	if (!dc.get_n (n ? &w[0] : 0, n) || \
+	    (n && memcmp (&w[0], &v[0], n * sizeof (CORBA::T))) || \
+	    dc.buffer()->length() != 0) \
+	    ok = FALSE; \
+	ec.buffer()->rseek_beg (0); \
+	dc.get_octet (o); \
+	for (CORBA::ULong i = 0; i < n; ++i) { \
+	    CORBA::T x; \
+	    if (!dc.get_1 (x) || memcmp (&x, &v[i], sizeof (x))) \
+		ok = FALSE; \
+	} \
+    }
+
+static void
+test (CORBA::ByteOrder bo, const char *name)
+{
+    CORBA::Boolean ok = TRUE;
+    for (int k = 0; k < nlengths; ++k) {
+	CORBA::ULong n = lengths[k];
+	CHECK (Short, put_shorts, get_shorts, get_short);
+	CHECK (UShort, put_ushorts, get_ushorts, get_ushort);
+	CHECK (Long, put_longs, get_longs, get_long);
+	CHECK (ULong, put_ulongs, get_ulongs, get_ulong);
+	CHECK (LongLong, put_longlongs, get_longlongs, get_longlong);
+	CHECK (ULongLong, put_ulonglongs, get_ulonglongs, get_ulonglong);
+	CHECK (Float, put_floats, get_floats, get_float);
+	CHECK (Double, put_doubles, get_doubles, get_double);
+    }
+    cout << name << ": " << (ok ? "ok" : "FAILED") << endl;
+}
+
+template<class T>
+static void
+bench_one (const char *name, CORBA::ByteOrder bo, CORBA::ULong n,
+	   void (MICO::CDREncoder::*put) (const T *, CORBA::ULong),
+	   CORBA::Boolean (MICO::CDRDecoder::*get) (T *, CORBA::ULong))
+{
+    vector<T> v, w (n);
+    fill (v, n);
+    MICO::CDREncoder ec (new CORBA::Buffer, TRUE, bo);
+    MICO::CDRDecoder dc (ec.buffer(), FALSE, bo);
+    const int rounds = 10;
+
+    CORBA::ULongLong tput = 0, tget = 0;
+    for (int r = 0; r < rounds; ++r) {
+	ec.buffer()->rseek_beg (0);
+	ec.buffer()->wseek_beg (0);
+	CORBA::ULongLong t0 = OSMisc::nanotime ();
+	(ec.*put) (&v[0], n);
+	CORBA::ULongLong t1 = OSMisc::nanotime ();
+	(dc.*get) (&w[0], n);
+	CORBA::ULongLong t2 = OSMisc::nanotime ();
+	tput += t1 - t0;
+	tget += t2 - t1;
+    }
+    cout << name << (bo == CORBA::BigEndian ? " big:    " : " little: ")
+	 << "put " << (double)tput / rounds / n << " ns, get "
+	 << (double)tget / rounds / n << " ns per value" << endl;
+}
+
+static void
+bench (CORBA::ULong n)
+{
+    CORBA::ByteOrder bos[] = { CORBA::LittleEndian, CORBA::BigEndian };
+    for (int i = 0; i < 2; ++i) {
+	bench_one<CORBA::Double> ("doubles", bos[i], n,
+				  &MICO::CDREncoder::put_doubles,
+				  &MICO::CDRDecoder::get_doubles);
+	bench_one<CORBA::Long> ("longs  ", bos[i], n,
+				&MICO::CDREncoder::put_longs,
+				&MICO::CDRDecoder::get_longs);
+	bench_one<CORBA::Short> ("shorts ", bos[i], n,
+				 &MICO::CDREncoder::put_shorts,
+				 &MICO::CDRDecoder::get_shorts);
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+    if (argc == 3 && !strcmp (argv[1], "-bench")) {
+	bench (atoi (argv[2]));
+	return 0;
+    }
+    test (CORBA::LittleEndian, "little endian");
+    test (CORBA::BigEndian, "big endian");
+    return 0;
+}
@@ -0,0 +1,153 @@
+//
+// Test and micro-benchmark for sequences of octets that borrow their
+// elements from the buffer they were demarshalled from.
+//
+// Without arguments it is checked that long sequences are lent and
+// short ones copied, that lent sequences survive their buffer and the
+// reuse of it and that changes only affect the changed copy. With
+// -bench <n> demarshalling a sequence of n octets with and without a
+// loan is timed.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static void
+fill (CORBA::OctetSeq &s, CORBA::ULong n, CORBA::Octet seed)
+{
+    s.length (n);
+    for (CORBA::ULong i = 0; i < n; ++i)
+	s[i] = (CORBA::Octet)(i * 7 + seed);
+}
+
+static CORBA::Buffer *
+encode (const CORBA::OctetSeq &s)
+{
+    MICO::CDREncoder ec (new CORBA::Buffer, FALSE);
+    ec.put_octet (1);
+    CORBA::_stcseq_octet->marshal (ec, (void *)&s);
+    return ec.buffer();
+}
+
+// TRUE if the elements of s are within the memory of b
+static CORBA::Boolean
+lent (const CORBA::OctetSeq &s, CORBA::Buffer *b)
+{
+    const CORBA::Octet *p = s.get_buffer ();
+    return p >= b->buffer() && p < b->buffer() + b->wpos();
+}
+
+static CORBA::Boolean
+decode (CORBA::Buffer *b, CORBA::OctetSeq &s)
+{
+    MICO::CDRDecoder dc (b, FALSE);
+    CORBA::Octet o;
+    b->rseek_beg (0);
+    return dc.get_octet (o) &&
+	CORBA::_stcseq_octet->demarshal (dc, &s) &&
+	b->length() == 0;
+}
+
+static void
+test ()
+{
+    CORBA::OctetSeq big, small, s, t;
+    fill (big, 100000, 3);
+    fill (small, 100, 5);
+
+    CORBA::Buffer *b = encode (small);
+    cout << "short decoded: " << !!decode (b, s) << endl;
+    cout << "short lent: " << !!lent (s, b) << endl;
+    cout << "short equal: " << !!(s == small) << endl;
+    delete b;
+
+    b = encode (big);
+    cout << "long decoded: " << !!decode (b, s) << endl;
+    cout << "long lent: " << !!lent (s, b) << endl;
+    cout << "long equal: " << !!(s == big) << endl;
+
+    // copies share the loan, changes copy the elements
+    t = s;
+    cout << "copy lent: "
+	 << !!(((const CORBA::OctetSeq &)t).get_buffer() ==
+	       ((const CORBA::OctetSeq &)s).get_buffer())
+	 << endl;
+    t[0] = 0xff;
+    cout << "copy changed: " << !!(t[0] == 0xff) << endl;
+    cout << "copy not lent: " << !lent (t, b) << endl;
+    cout << "original unchanged: " << !!(s == big) << endl;
+
+    // reusing the buffer must not change the sequence
+    b->reset ();
+    for (CORBA::ULong i = 0; i < 200000; ++i)
+	b->put ((CORBA::Octet)0);
+    cout << "after reuse: " << !!(s == big) << endl;
+
+    // neither must deleting it
+    delete b;
+    cout << "after delete: " << !!(s == big) << endl;
+
+    // a lent sequence is marshalled without copying it first
+    b = encode (s);
+    CORBA::OctetSeq u;
+    cout << "marshal lent: " << !!(decode (b, u) && u == big) << endl;
+    delete b;
+
+    CORBA::OctetSeq_var v = new CORBA::OctetSeq (s);
+    s.length (10);
+    cout << "truncated: " << !!(s.length() == 10 && v->length() == 100000)
+	 << endl;
+}
+
+static void
+bench (CORBA::ULong n)
+{
+    CORBA::OctetSeq big;
+    fill (big, n, 1);
+    CORBA::Buffer *b = encode (big);
+    const int rounds = 100;
+
+    CORBA::ULongLong t0 = OSMisc::nanotime ();
+    for (int r = 0; r < rounds; ++r) {
+	CORBA::OctetSeq s;
+	decode (b, s);
+    }
+    CORBA::ULongLong t1 = OSMisc::nanotime ();
+    for (int r = 0; r < rounds; ++r) {
+	// what demarshalling did before: zero fill and copy
+	MICO::CDRDecoder dc (b, FALSE);
+	CORBA::Octet o;
+	CORBA::ULong len;
+	b->rseek_beg (0);
+	dc.get_octet (o);
+	dc.seq_begin (len);
+	CORBA::OctetSeq s;
+	s.length (len);
+	dc.get_octets (s.get_buffer(), len);
+    }
+    CORBA::ULongLong t2 = OSMisc::nanotime ();
+    delete b;
+
+    cout << "lent:   " << (double)(t1 - t0) / rounds / 1000 << " us" << endl;
+    cout << "copied: " << (double)(t2 - t1) / rounds / 1000 << " us" << endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+    if (argc == 3 && !strcmp (argv[1], "-bench")) {
+	bench (atoi (argv[2]));
+	return 0;
+    }
+    test ();
+    return 0;
+}
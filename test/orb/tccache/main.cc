@@ -0,0 +1,166 @@
+//
+// Test and micro-benchmark for the cache of decoded typecodes.
+//
+// Without arguments Anys are decoded over and over again and the
+// sharing, eviction and keep policies of the cache are checked. With
+// -bench the time to decode an Any holding a struct is compared with
+// and without the cache.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+// struct <name> { long x; sequence<string> names; };
+static CORBA::TypeCode_ptr
+make_struct (const char *name)
+{
+    string id = string ("IDL:") + name + ":1.0";
+    CORBA::StructMemberSeq members;
+    members.length (2);
+    members[0].name = CORBA::string_dup ("x");
+    members[0].type = CORBA::TypeCode::_duplicate (CORBA::_tc_long);
+    members[1].name = CORBA::string_dup ("names");
+    members[1].type = CORBA::TypeCode::create_sequence_tc (0,
+							   CORBA::_tc_string);
+    return CORBA::TypeCode::create_struct_tc (id.c_str(), name, members);
+}
+
+static void
+put (MICO::CDREncoder &ec, CORBA::TypeCode_ptr tc, CORBA::Long x)
+{
+    CORBA::Any a;
+    a.set_type (tc);
+    a.struct_put_begin ();
+    a <<= x;
+    a.seq_put_begin (2);
+    a <<= "a";
+    a <<= "b";
+    a.seq_put_end ();
+    a.struct_put_end ();
+    ec.put_any (a);
+}
+
+// decode the Any in ec, return its typecode
+static CORBA::TypeCode_ptr
+get (MICO::CDREncoder &ec, CORBA::Long &x)
+{
+    MICO::CDRDecoder dc (ec.buffer(), FALSE, ec.byteorder(),
+			 ec.converter(), FALSE);
+    ec.buffer()->rseek_beg (0);
+    CORBA::Any a;
+    CORBA::Boolean r = dc.get_any (a);
+    assert (r);
+    r = a.struct_get_begin ();
+    assert (r);
+    r = (a >>= x);
+    assert (r);
+    return a.type();
+}
+
+static CORBA::ULong
+misses ()
+{
+    CORBA::TypeCode::CacheStats st;
+    CORBA::TypeCode::cache_stats (st);
+    return st.misses;
+}
+
+static void
+test ()
+{
+    CORBA::TypeCode_var s1 = make_struct ("S1");
+    CORBA::TypeCode_var s2 = make_struct ("S2");
+    CORBA::TypeCode_var s3 = make_struct ("S3");
+    MICO::CDREncoder ec1, ec2, ec3;
+    put (ec1, s1, 1);
+    put (ec2, s2, 2);
+    put (ec3, s3, 3);
+
+    CORBA::Long x;
+    CORBA::TypeCode_var t1 = get (ec1, x);
+    CORBA::TypeCode_var t2 = get (ec1, x);
+    cout << "decoded " << x << ", shared: " << (t1.in() == t2.in())
+	 << ", equal: " << !!s1->equal (t1) << endl;
+
+    // lru: S2 is evicted, S1 was used more recently
+    CORBA::TypeCode::cache_limits (2, 1024*1024, TRUE);
+    t2 = get (ec2, x);
+    t2 = get (ec1, x);
+    CORBA::TypeCode_var t3 = get (ec3, x);
+    CORBA::ULong m = misses();
+    t2 = get (ec1, x);
+    cout << "lru: S1 cached: " << (misses() == m);
+    t2 = get (ec2, x);
+    cout << ", S2 cached: " << (misses() == m) << endl;
+
+    // keep: S1 and S2 stay, S3 is not added
+    CORBA::TypeCode::cache_limits (0, 1024*1024, FALSE);
+    CORBA::TypeCode::cache_limits (2, 1024*1024, FALSE);
+    t1 = get (ec1, x);
+    t2 = get (ec2, x);
+    t3 = get (ec3, x);
+    m = misses();
+    t1 = get (ec1, x);
+    t2 = get (ec2, x);
+    cout << "keep: S1, S2 cached: " << (misses() == m);
+    t3 = get (ec3, x);
+    cout << ", S3 cached: " << (misses() == m) << endl;
+
+    // byte limit
+    CORBA::TypeCode::cache_limits (512, 16, TRUE);
+    t1 = get (ec1, x);
+    t2 = get (ec1, x);
+    cout << "too large: shared: " << (t1.in() == t2.in()) << endl;
+
+    // disabled
+    CORBA::TypeCode::cache_limits (0, 1024*1024, TRUE);
+    t1 = get (ec1, x);
+    t2 = get (ec1, x);
+    cout << "disabled: shared: " << (t1.in() == t2.in())
+	 << ", equal: " << !!t1->equal (t2) << endl;
+
+    CORBA::TypeCode::CacheStats st;
+    CORBA::TypeCode::cache_stats (st);
+    cout << "entries: " << st.entries << ", bytes: " << st.bytes << endl;
+}
+
+static void
+bench (CORBA::ULong n)
+{
+    CORBA::TypeCode_var s1 = make_struct ("S1");
+    MICO::CDREncoder ec;
+    put (ec, s1, 1);
+    CORBA::Long x;
+
+    for (int cached = 0; cached < 2; ++cached) {
+	CORBA::TypeCode::cache_limits (cached ? 512 : 0, 1024*1024, TRUE);
+	CORBA::ULongLong start = OSMisc::nanotime ();
+	for (CORBA::ULong i = 0; i < n; ++i)
+	    CORBA::TypeCode_var t = get (ec, x);
+	CORBA::ULongLong t = OSMisc::nanotime () - start;
+	cout << (cached ? "cached:   " : "uncached: ")
+	     << (double)t / n << " ns per Any" << endl;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+    if (argc == 3 && !strcmp (argv[1], "-bench")) {
+	bench (atoi (argv[2]));
+	return 0;
+    }
+    test ();
+    return 0;
+}
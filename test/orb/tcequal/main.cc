@@ -0,0 +1,163 @@
+//
+// Test and micro-benchmark for TypeCode::equal() and equivalent().
+//
+// Without arguments typecodes that are equal, equivalent or different
+// are compared twice, so the second comparison is answered from the
+// memo of the thread. With -bench the time to compare two copies of a
+// deeply nested type of structs and unions is measured.
+//
+
+#include <CORBA.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+static CORBA::TypeCode_ptr
+leaf (CORBA::TypeCode_ptr t)
+{
+    // struct L { <t> a; string s; double d; };
+    CORBA::StructMemberSeq m;
+    m.length (3);
+    m[0].name = CORBA::string_dup ("a");
+    m[0].type = CORBA::TypeCode::_duplicate (t);
+    m[1].name = CORBA::string_dup ("s");
+    m[1].type = CORBA::TypeCode::_duplicate (CORBA::_tc_string);
+    m[2].name = CORBA::string_dup ("d");
+    m[2].type = CORBA::TypeCode::_duplicate (CORBA::_tc_double);
+    return CORBA::TypeCode::create_struct_tc ("IDL:L:1.0", "L", m);
+}
+
+/*
+ * union U<depth> switch (long) {
+ * case 0: T a;
+ * case 1: struct S<depth> { T x; sequence<T> y; long z; } b;
+ * };
+ * where T is the type of depth-1 and the innermost T is a struct
+ * containing leaf_type.
+ */
+static CORBA::TypeCode_ptr
+nested (int depth, CORBA::TypeCode_ptr leaf_type)
+{
+    if (depth == 0)
+	return leaf (leaf_type);
+
+    CORBA::TypeCode_var t = nested (depth-1, leaf_type);
+    char sid[32], uid[32];
+    sprintf (sid, "IDL:S%d:1.0", depth);
+    sprintf (uid, "IDL:U%d:1.0", depth);
+
+    CORBA::StructMemberSeq sm;
+    sm.length (3);
+    sm[0].name = CORBA::string_dup ("x");
+    sm[0].type = CORBA::TypeCode::_duplicate (t);
+    sm[1].name = CORBA::string_dup ("y");
+    sm[1].type = CORBA::TypeCode::create_sequence_tc (0, t);
+    sm[2].name = CORBA::string_dup ("z");
+    sm[2].type = CORBA::TypeCode::_duplicate (CORBA::_tc_long);
+    CORBA::TypeCode_var s = CORBA::TypeCode::create_struct_tc (sid, "S", sm);
+
+    CORBA::UnionMemberSeq um;
+    um.length (2);
+    um[0].name = CORBA::string_dup ("a");
+    um[0].label <<= (CORBA::Long)0;
+    um[0].type = CORBA::TypeCode::_duplicate (t);
+    um[1].name = CORBA::string_dup ("b");
+    um[1].label <<= (CORBA::Long)1;
+    um[1].type = CORBA::TypeCode::_duplicate (s);
+    return CORBA::TypeCode::create_union_tc (uid, "U", CORBA::_tc_long, um);
+}
+
+// struct B { string<bound> s; };
+static CORBA::TypeCode_ptr
+bounded (CORBA::ULong bound)
+{
+    CORBA::StructMemberSeq m;
+    m.length (1);
+    m[0].name = CORBA::string_dup ("s");
+    m[0].type = CORBA::TypeCode::create_string_tc (bound);
+    return CORBA::TypeCode::create_struct_tc ("IDL:B:1.0", "B", m);
+}
+
+// struct R { sequence<R> next; };
+static CORBA::TypeCode_ptr
+recursive ()
+{
+    CORBA::TypeCode_var r = CORBA::TypeCode::create_recursive_tc ("IDL:R:1.0");
+    CORBA::StructMemberSeq m;
+    m.length (1);
+    m[0].name = CORBA::string_dup ("next");
+    m[0].type = CORBA::TypeCode::create_sequence_tc (0, r);
+    return CORBA::TypeCode::create_struct_tc ("IDL:R:1.0", "R", m);
+}
+
+static void
+compare (const char *what, CORBA::TypeCode_ptr a, CORBA::TypeCode_ptr b)
+{
+    for (int i = 0; i < 2; ++i) {
+	cout << what << ": equal " << !!a->equal (b)
+	     << ", without aliases " << !!a->equal (b, TRUE)
+	     << ", ignoring bounds " << !!a->equal (b, FALSE, TRUE)
+	     << ", equivalent " << !!a->equivalent (b) << endl;
+    }
+}
+
+static void
+test ()
+{
+    CORBA::TypeCode_var a = nested (4, CORBA::_tc_long);
+    CORBA::TypeCode_var b = nested (4, CORBA::_tc_long);
+    CORBA::TypeCode_var c = nested (4, CORBA::_tc_short);
+    CORBA::TypeCode_var alias =
+	CORBA::TypeCode::create_alias_tc ("IDL:A:1.0", "A", a);
+    CORBA::TypeCode_var b5 = bounded (5);
+    CORBA::TypeCode_var b6 = bounded (6);
+    CORBA::TypeCode_var r1 = recursive ();
+    CORBA::TypeCode_var r2 = recursive ();
+
+    compare ("same", a, b);
+    compare ("different", a, c);
+    compare ("alias", alias, b);
+    compare ("bounds", b5, b6);
+    compare ("recursive", r1, r2);
+}
+
+static void
+bench (CORBA::ULong n)
+{
+    CORBA::TypeCode_var a = nested (8, CORBA::_tc_long);
+    CORBA::TypeCode_var b = nested (8, CORBA::_tc_long);
+    CORBA::TypeCode_var c = nested (8, CORBA::_tc_short);
+
+    const char *names[] = { "equal:      ", "equivalent: ", "different:  " };
+    for (int k = 0; k < 3; ++k) {
+	CORBA::ULongLong start = OSMisc::nanotime ();
+	for (CORBA::ULong i = 0; i < n; ++i) {
+	    switch (k) {
+	    case 0: a->equal (b); break;
+	    case 1: a->equivalent (b); break;
+	    case 2: a->equal (c); break;
+	    }
+	}
+	CORBA::ULongLong t = OSMisc::nanotime () - start;
+	cout << names[k] << (double)t / n << " ns" << endl;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+    if (argc == 3 && !strcmp (argv[1], "-bench")) {
+	bench (atoi (argv[2]));
+	return 0;
+    }
+    test ();
+    return 0;
+}
@@ -0,0 +1,260 @@
+//
+// Test and micro-benchmark for the dispatcher timer wheel.
+//
+// Without arguments the wheel is cross-checked against the sorted
+// delta list the dispatchers used before. With -bench the cost of
+// add/remove/expire is compared for both at a given number of
+// outstanding timers.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <algorithm>
+
+
+using namespace std;
+
+// the timer list formerly used by SelectDispatcher and PollDispatcher
+class DeltaList {
+    struct TimerEvent {
+	CORBA::Long delta;
+	CORBA::DispatcherCallback *cb;
+    };
+    list<TimerEvent> tevents;
+    CORBA::Long last_update;
+    CORBA::Boolean init;
+
+    void update (CORBA::Long curr)
+    {
+	// unsigned difference, the clock wraps around in the test
+	CORBA::Long elapsed = (CORBA::Long)((CORBA::ULong)curr -
+					    (CORBA::ULong)last_update);
+	if (init || tevents.size() == 0 || elapsed < 0) {
+	    last_update = curr;
+	    init = FALSE;
+	} else {
+	    tevents.front().delta -= elapsed;
+	    last_update = curr;
+	}
+    }
+public:
+    DeltaList ()
+	: last_update (0), init (TRUE)
+    {}
+    void add (CORBA::DispatcherCallback *cb, CORBA::ULong tmout,
+	      CORBA::Long now)
+    {
+	TimerEvent t;
+	t.delta = tmout;
+	t.cb = cb;
+	update (now);
+	list<TimerEvent>::iterator i;
+	for (i = tevents.begin(); i != tevents.end(); ++i) {
+	    if ((*i).delta <= t.delta) {
+		t.delta -= (*i).delta;
+	    } else {
+		(*i).delta -= t.delta;
+		break;
+	    }
+	}
+	tevents.insert (i, t);
+    }
+    void remove (CORBA::DispatcherCallback *cb)
+    {
+	list<TimerEvent>::iterator i = tevents.begin();
+	while (i != tevents.end()) {
+	    list<TimerEvent>::iterator next = i;
+	    ++next;
+	    if ((*i).cb == cb) {
+		if (next != tevents.end())
+		    (*next).delta += (*i).delta;
+		tevents.erase (i);
+	    }
+	    i = next;
+	}
+    }
+    CORBA::Boolean expired (CORBA::Long now, CORBA::DispatcherCallback *&cb)
+    {
+	if (tevents.size() == 0)
+	    return FALSE;
+	update (now);
+	if (tevents.front().delta > 0)
+	    return FALSE;
+	TimerEvent t = tevents.front();
+	tevents.pop_front();
+	if (tevents.size() > 0)
+	    tevents.front().delta += t.delta;
+	cb = t.cb;
+	return TRUE;
+    }
+    CORBA::Long next_timeout (CORBA::Long now)
+    {
+	if (tevents.size() == 0)
+	    return -1;
+	update (now);
+	return tevents.front().delta > 0 ? tevents.front().delta : 0;
+    }
+};
+
+class Callback : public CORBA::DispatcherCallback {
+public:
+    CORBA::ULong id;
+    void callback (CORBA::Dispatcher *, Event)
+    {}
+};
+
+// deterministic pseudo random numbers
+static CORBA::ULong seed = 4711;
+
+static CORBA::ULong
+rnd (CORBA::ULong max)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % max;
+}
+
+typedef pair<CORBA::ULong, CORBA::ULong> Firing;
+
+static bool
+check (CORBA::ULong ncbs, CORBA::ULong nops, CORBA::ULong maxtmout,
+       CORBA::Long start)
+{
+    vector<Callback> cbs (ncbs);
+    for (CORBA::ULong i = 0; i < ncbs; ++i)
+	cbs[i].id = i;
+
+    DeltaList dl;
+    MICO::TimerWheel tw;
+    vector<Firing> fired_dl, fired_tw;
+    CORBA::ULong now = start;
+
+    for (CORBA::ULong op = 0; op < nops; ++op) {
+	CORBA::ULong what = rnd (10);
+	Callback *cb = &cbs[rnd (ncbs)];
+	if (what < 5) {
+	    // mostly short timeouts, some long ones
+	    CORBA::ULong tmout = rnd (4) ? rnd (300) : rnd (maxtmout);
+	    dl.add (cb, tmout, now);
+	    tw.add (cb, CORBA::Dispatcher::Timer, tmout, now);
+	} else if (what < 6) {
+	    dl.remove (cb);
+	    tw.remove (cb);
+	} else {
+	    // next_timeout() of the wheel may wake up early, but never late
+	    CORBA::Long t1 = dl.next_timeout (now);
+	    CORBA::Long t2 = tw.next_timeout (now);
+	    if ((t1 < 0) != (t2 < 0) || t2 > t1) {
+		cout << "next_timeout mismatch: " << t1 << " " << t2 << endl;
+		return false;
+	    }
+	    now += (what < 9) ? rnd (50) : rnd (maxtmout / 4 + 1);
+	}
+	CORBA::DispatcherCallback *dcb;
+	while (dl.expired (now, dcb))
+	    fired_dl.push_back (Firing (now, ((Callback *)dcb)->id));
+	MICO::TimerWheel::TimerEvent te;
+	while (tw.expired (now, te))
+	    fired_tw.push_back (Firing (now, ((Callback *)te.cb)->id));
+    }
+
+    // timers expiring in the same millisecond may fire in any order
+    sort (fired_dl.begin(), fired_dl.end());
+    sort (fired_tw.begin(), fired_tw.end());
+    if (fired_dl != fired_tw) {
+	cout << "firing sequences differ: " << fired_dl.size()
+	     << " vs. " << fired_tw.size() << endl;
+	return false;
+    }
+
+    vector<MICO::TimerWheel::TimerEvent> tv;
+    tw.drain (now, tv);
+    if (!tw.empty() || tw.next_timeout (now) != -1) {
+	cout << "drain left timers behind" << endl;
+	return false;
+    }
+    return true;
+}
+
+static void
+bench (CORBA::ULong ntimers, CORBA::ULong nops)
+{
+    vector<Callback> cbs (ntimers);
+    OSMisc::TimeVal t1, t2;
+    CORBA::Long now;
+
+    for (int impl = 0; impl < 2; ++impl) {
+	DeltaList dl;
+	MICO::TimerWheel tw;
+	CORBA::DispatcherCallback *dcb;
+	MICO::TimerWheel::TimerEvent te;
+
+	seed = 4711;
+	now = 0;
+	for (CORBA::ULong i = 0; i < ntimers; ++i) {
+	    if (impl == 0)
+		dl.add (&cbs[i], 1000 + rnd (60000), now);
+	    else
+		tw.add (&cbs[i], CORBA::Dispatcher::Timer, 1000 + rnd (60000),
+			now);
+	}
+
+	// like GIOPConn::check_busy/check_idle: cancel and rearm timers
+	// while the clock advances
+	t1 = OSMisc::gettime();
+	for (CORBA::ULong op = 0; op < nops; ++op) {
+	    Callback *cb = &cbs[rnd (ntimers)];
+	    CORBA::ULong tmout = 1000 + rnd (60000);
+	    now += rnd (3);
+	    if (impl == 0) {
+		dl.remove (cb);
+		dl.add (cb, tmout, now);
+		while (dl.expired (now, dcb))
+		    dl.add (dcb, 1000 + rnd (60000), now);
+		dl.next_timeout (now);
+	    } else {
+		tw.remove (cb);
+		tw.add (cb, CORBA::Dispatcher::Timer, tmout, now);
+		while (tw.expired (now, te))
+		    tw.add (te.cb, CORBA::Dispatcher::Timer,
+			    1000 + rnd (60000), now);
+		tw.next_timeout (now);
+	    }
+	}
+	t2 = OSMisc::gettime();
+
+	double usecs = (t2.tv_sec - t1.tv_sec) * 1000000.0 +
+	    (t2.tv_usec - t1.tv_usec);
+	cout << (impl == 0 ? "delta list:  " : "timer wheel: ")
+	     << ntimers << " timers, " << usecs * 1000.0 / nops
+	     << " ns per cancel/rearm" << endl;
+    }
+}
+
+int
+main (int argc, char *argv[])
+{
+    if (argc > 1 && !strcmp (argv[1], "-bench")) {
+	CORBA::ULong ntimers = argc > 2 ? atoi (argv[2]) : 10000;
+	for (CORBA::ULong n = 10; n <= ntimers; n *= 10)
+	    bench (n, 100000);
+	return 0;
+    }
+
+    bool ok = true;
+    ok = check (10, 100000, 1000, 0) && ok;
+    ok = check (1000, 100000, 100000, 0) && ok;
+    // long timeouts that cascade through all levels
+    ok = check (100, 20000, 2000000000, 0) && ok;
+    // millisecond clock wrapping around
+    ok = check (100, 100000, 100000, -50000) && ok;
+    ok = check (100, 100000, 100000, 0x7fff0000) && ok;
+
+    cout << (ok ? "timer wheel matches delta list" : "FAILED") << endl;
+    return ok ? 0 : 1;
+}
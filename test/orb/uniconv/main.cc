@@ -0,0 +1,330 @@
+//
+// Test and micro-benchmark for the conversion between Unicode code sets.
+//
+// Without arguments texts are converted between ISO 8859-1, UTF-8,
+// UCS-2, UTF-16 and UCS-4 in both directions and compared with an
+// independent encoding of their characters. Texts with line breaks,
+// which the converters treat specially, must survive the round trip.
+// With -bench <n> a text of n characters is encoded and decoded.
+//
+
+#include <CORBA.h>
+#include <mico/impl.h>
+#include <mico/os-misc.h>
+#include <vector>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+
+
+using namespace std;
+
+typedef vector<CORBA::ULong> Text;
+
+enum {
+    Latin1 = 0x00010001,
+    UCS2 = 0x00010100,
+    UCS4 = 0x00010106,
+    UTF16 = 0x00010109,
+    UTF8 = 0x05010001
+};
+
+static const struct {
+    CORBA::ULong id;
+    const char *name;
+    CORBA::ULong max;	// largest character
+} sets[] = {
+    { Latin1, "ISO 8859-1", 0xff },
+    { UTF8, "UTF-8", 0x10ffff },
+    { UCS2, "UCS-2", 0xffff },
+    { UTF16, "UTF-16", 0x10ffff },
+    { UCS4, "UCS-4", 0x10ffff },
+};
+static const int nsets = sizeof (sets) / sizeof (sets[0]);
+
+// the units of text in code set id, one per element
+static vector<CORBA::ULong>
+units (const Text &text, CORBA::ULong id)
+{
+    vector<CORBA::ULong> u;
+    for (CORBA::ULong i = 0; i < text.size(); ++i) {
+	CORBA::ULong c = text[i];
+	if (id == UTF8 && c >= 0x80) {
+	    if (c < 0x800) {
+		u.push_back (0xc0 | (c >> 6));
+	    } else if (c < 0x10000) {
+		u.push_back (0xe0 | (c >> 12));
+		u.push_back (0x80 | ((c >> 6) & 0x3f));
+	    } else {
+		u.push_back (0xf0 | (c >> 18));
+		u.push_back (0x80 | ((c >> 12) & 0x3f));
+		u.push_back (0x80 | ((c >> 6) & 0x3f));
+	    }
+	    u.push_back (0x80 | (c & 0x3f));
+	} else if (id == UTF16 && c >= 0x10000) {
+	    u.push_back (0xd800 + ((c - 0x10000) >> 10));
+	    u.push_back (0xdc00 + ((c - 0x10000) & 0x3ff));
+	} else {
+	    u.push_back (c);
+	}
+    }
+    return u;
+}
+
+static CORBA::ULong
+unit_size (CORBA::ULong id)
+{
+    return id == UCS4 ? 4 : id == UCS2 || id == UTF16 ? 2 : 1;
+}
+
+// the units as they appear in a buffer
+static CORBA::Buffer *
+wire (const vector<CORBA::ULong> &u, CORBA::ULong id)
+{
+    CORBA::Buffer *b = new CORBA::Buffer;
+    for (CORBA::ULong i = 0; i < u.size(); ++i) {
+	CORBA::UShort us = (CORBA::UShort)u[i];
+	CORBA::Octet o = (CORBA::Octet)u[i];
+	switch (unit_size (id)) {
+	case 1: b->put (&o, 1); break;
+	case 2: b->put (&us, 2); break;
+	default: b->put (&u[i], 4); break;
+	}
+    }
+    return b;
+}
+
+static MICO::CodesetConv *
+conv (CORBA::ULong from, CORBA::ULong to)
+{
+    return MICO::CodesetConv::create (CORBA::Codeset::create (from),
+				      CORBA::Codeset::create (to));
+}
+
+/*
+ * convert text from native code set n to transmission code set t and
+ * back. byte oriented native code sets use Chars, the others WChars.
+ */
+static CORBA::Boolean
+check (const Text &text, CORBA::ULong n, CORBA::ULong t)
+{
+    vector<CORBA::ULong> nu = units (text, n), tu = units (text, t);
+    CORBA::Buffer *expect = wire (tu, t);
+    MICO::CodesetConv *n2t = conv (n, t), *t2n = conv (t, n);
+    CORBA::Boolean ok = TRUE;
+
+    // encode
+    CORBA::Buffer b;
+    CORBA::Long r;
+    if (unit_size (n) == 1) {
+	vector<CORBA::Char> s (nu.begin(), nu.end());
+	s.push_back (0);
+	r = n2t->encode (&s[0], nu.size(), b, FALSE);
+    } else {
+	vector<CORBA::WChar> s (nu.begin(), nu.end());
+	s.push_back (0);
+	r = n2t->encode (&s[0], nu.size(), b, FALSE);
+    }
+    if (r != (CORBA::Long)tu.size() || b.length() != expect->length() ||
+	memcmp (b.data(), expect->data(), b.length()))
+	ok = FALSE;
+
+    // decode, the destination must not be written past the terminator
+    CORBA::ULong len = tu.size(), max = len * 6 + 2;
+    if (unit_size (n) == 1) {
+	vector<CORBA::Char> d (max, 'x');
+	r = t2n->decode (*expect, len, &d[0], TRUE);
+	if (r != (CORBA::Long)nu.size() + 1 || d[nu.size()] != 0 ||
+	    d[nu.size()+1] != 'x')
+	    ok = FALSE;
+	for (CORBA::ULong i = 0; ok && i < nu.size(); ++i) {
+	    if ((CORBA::Octet)d[i] != nu[i])
+		ok = FALSE;
+	}
+    } else {
+	vector<CORBA::WChar> d (max, 'x');
+	r = t2n->decode (*expect, len, &d[0], TRUE);
+	if (r != (CORBA::Long)nu.size() + 1 || d[nu.size()] != 0 ||
+	    d[nu.size()+1] != 'x')
+	    ok = FALSE;
+	for (CORBA::ULong i = 0; ok && i < nu.size(); ++i) {
+	    if ((CORBA::ULong)d[i] != nu[i])
+		ok = FALSE;
+	}
+    }
+    if (expect->length() != 0)
+	ok = FALSE;
+
+    delete expect;
+    delete n2t;
+    delete t2n;
+    return ok;
+}
+
+static Text
+text (const char *ascii, CORBA::ULong extra)
+{
+    Text t;
+    for (const char *p = ascii; *p; ++p)
+	t.push_back ((CORBA::Octet)*p);
+    if (extra)
+	t.insert (t.begin() + t.size() / 2, extra);
+    return t;
+}
+
+static CORBA::ULong
+max_char (const Text &t)
+{
+    CORBA::ULong m = 0;
+    for (CORBA::ULong i = 0; i < t.size(); ++i) {
+	if (t[i] > m)
+	    m = t[i];
+    }
+    return m;
+}
+
+// a line break in native code set n must come back unchanged
+static CORBA::Boolean
+check_lines (CORBA::ULong n, CORBA::ULong t)
+{
+    Text txt = text ("first line\nsecond line with some more characters", 0);
+    vector<CORBA::ULong> nu = units (txt, n);
+    MICO::CodesetConv *n2t = conv (n, t), *t2n = conv (t, n);
+    CORBA::Boolean ok = TRUE;
+
+    CORBA::Buffer b;
+    CORBA::Long r;
+    if (unit_size (n) == 1) {
+	vector<CORBA::Char> s (nu.begin(), nu.end());
+	s.push_back (0);
+	r = n2t->encode (&s[0], nu.size(), b, FALSE);
+    } else {
+	vector<CORBA::WChar> s (nu.begin(), nu.end());
+	s.push_back (0);
+	r = n2t->encode (&s[0], nu.size(), b, FALSE);
+    }
+    if (r < 0)
+	ok = FALSE;
+
+    if (unit_size (n) == 1) {
+	vector<CORBA::Char> d (6 * r + 2);
+	if (t2n->decode (b, r, &d[0], TRUE) < 0)
+	    ok = FALSE;
+	for (CORBA::ULong i = 0; ok && i <= nu.size(); ++i) {
+	    if ((CORBA::Octet)d[i] != (i < nu.size() ? nu[i] : 0))
+		ok = FALSE;
+	}
+    } else {
+	vector<CORBA::WChar> d (6 * r + 2);
+	if (t2n->decode (b, r, &d[0], TRUE) < 0)
+	    ok = FALSE;
+	for (CORBA::ULong i = 0; ok && i <= nu.size(); ++i) {
+	    if ((CORBA::ULong)d[i] != (i < nu.size() ? nu[i] : 0))
+		ok = FALSE;
+	}
+    }
+    delete n2t;
+    delete t2n;
+    return ok;
+}
+
+static void
+bench (CORBA::ULong n, CORBA::ULong from, CORBA::ULong to, CORBA::ULong extra)
+{
+    // mostly ASCII, with one other character every 64
+    Text txt;
+    for (CORBA::ULong i = 0; i < n; ++i)
+	txt.push_back (extra && i % 64 == 63 ? extra : 'a' + i % 26);
+    vector<CORBA::ULong> fu = units (txt, from);
+    MICO::CodesetConv *enc = conv (from, to), *dec = conv (to, from);
+
+    CORBA::Buffer b;
+    CORBA::ULongLong t0 = OSMisc::nanotime ();
+    if (unit_size (from) == 1) {
+	vector<CORBA::Char> s (fu.begin(), fu.end());
+	t0 = OSMisc::nanotime ();
+	enc->encode (&s[0], fu.size(), b, FALSE);
+    } else {
+	vector<CORBA::WChar> s (fu.begin(), fu.end());
+	t0 = OSMisc::nanotime ();
+	enc->encode (&s[0], fu.size(), b, FALSE);
+    }
+    CORBA::ULongLong t1 = OSMisc::nanotime ();
+    CORBA::ULong len = b.length() / unit_size (to);
+    CORBA::ULongLong t2;
+    if (unit_size (from) == 1) {
+	vector<CORBA::Char> d (len * 6 + 1);
+	t1 = OSMisc::nanotime ();
+	dec->decode (b, len, &d[0], TRUE);
+	t2 = OSMisc::nanotime ();
+    } else {
+	vector<CORBA::WChar> d (len * 6 + 1);
+	t1 = OSMisc::nanotime ();
+	dec->decode (b, len, &d[0], TRUE);
+	t2 = OSMisc::nanotime ();
+    }
+
+    CORBA::Codeset *f = CORBA::Codeset::create (from);
+    CORBA::Codeset *t = CORBA::Codeset::create (to);
+    cout << f->name() << " <-> " << t->name()
+	 << (extra ? " (mixed)" : " (ASCII)") << ": encode "
+	 << (double)(t1 - t0) / n << " ns, decode "
+	 << (double)(t2 - t1) / n << " ns per character" << endl;
+    delete f;
+    delete t;
+    delete enc;
+    delete dec;
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv, "mico-local-orb");
+
+    if (argc == 3 && !strcmp (argv[1], "-bench")) {
+	CORBA::ULong n = atoi (argv[2]);
+	bench (n, Latin1, UTF8, 0);
+	bench (n, Latin1, UTF8, 0xe9);
+	bench (n, UTF16, UTF8, 0);
+	bench (n, UTF16, UTF8, 0x20ac);
+	bench (n, UCS4, UTF16, 0);
+	bench (n, UCS4, UTF16, 0x20ac);
+	return 0;
+    }
+
+    // short and long enough for the vector code, with characters of
+    // the different UTF-8 and UTF-16 lengths
+    const char *ascii[] = {
+	"",
+	"a",
+	"abcdefghijklmnopqrstuvwxyz0123456789 ~!",
+	"The quick brown fox jumps over the lazy dog, again and again."
+    };
+    CORBA::ULong extra[] = { 0, 0xe9, 0x20ac, 0x1f600 };
+
+    for (int i = 0; i < nsets; ++i) {
+	for (int j = 0; j < nsets; ++j) {
+	    if (i == j)
+		continue;
+	    CORBA::Boolean ok = TRUE;
+	    for (int a = 0; a < 4; ++a) {
+		for (int e = 0; e < 4; ++e) {
+		    Text t = text (ascii[a], extra[e]);
+		    if (max_char (t) > sets[i].max || max_char (t) > sets[j].max)
+			continue;
+		    if (!check (t, sets[i].id, sets[j].id)) {
+			cout << "  text " << a << " with " << hex << extra[e]
+			     << dec << " failed" << endl;
+			ok = FALSE;
+		    }
+		}
+	    }
+	    cout << sets[i].name << " -> " << sets[j].name << ": " << !!ok
+		 << ", lines: " << !!check_lines (sets[i].id, sets[j].id)
+		 << endl;
+	}
+    }
+    return 0;
+}
@@ -0,0 +1,199 @@
+//
+// Test and benchmark for the POA's Active Object Map.
+//
+// Without arguments objects are activated, looked up and deactivated
+// in a few POAs and the results are checked. With -bench the time
+// needed to activate, look up and deactivate a given number of objects
+// is measured.
+//
+
+#include <CORBA.h>
+#include <mico/os-misc.h>
+#ifdef HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream>
+#else // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <iostream.h>
+#endif // HAVE_ANSI_CPLUSPLUS_HEADERS
+#include <stdio.h>
+
+
+using namespace std;
+
+class Impl : public virtual PortableServer::DynamicImplementation {
+public:
+    void invoke (CORBA::ServerRequest_ptr)
+    {
+	assert (0);
+    }
+    char *_primary_interface (const PortableServer::ObjectId &,
+			      PortableServer::POA_ptr)
+    {
+	return CORBA::string_dup ("IDL:Test:1.0");
+    }
+};
+
+static PortableServer::ObjectId *
+make_id (CORBA::ULong i)
+{
+    char buf[20];
+    sprintf (buf, "obj%lu", (unsigned long)i);
+    return PortableServer::string_to_ObjectId (buf);
+}
+
+static PortableServer::POA_ptr
+make_poa (PortableServer::POA_ptr root, const char *name,
+	  PortableServer::IdUniquenessPolicyValue uniq)
+{
+    CORBA::PolicyList pl;
+    pl.length (3);
+    pl[0] = root->create_id_assignment_policy (PortableServer::USER_ID);
+    pl[1] = root->create_servant_retention_policy (PortableServer::RETAIN);
+    pl[2] = root->create_id_uniqueness_policy (uniq);
+    PortableServer::POAManager_var mgr = root->the_POAManager ();
+    return root->create_POA (name, mgr, pl);
+}
+
+static double
+usecs (const OSMisc::TimeVal &t1, const OSMisc::TimeVal &t2)
+{
+    return (t2.tv_sec - t1.tv_sec) * 1000000.0 + (t2.tv_usec - t1.tv_usec);
+}
+
+// one servant per object
+static bool
+check_unique (PortableServer::POA_ptr root, CORBA::ULong n)
+{
+    PortableServer::POA_var poa =
+	make_poa (root, "unique", PortableServer::UNIQUE_ID);
+    vector<Impl *> servs (n);
+    bool ok = true;
+
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	servs[i] = new Impl;
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->activate_object_with_id (id.in(), servs[i]);
+    }
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	PortableServer::Servant s = poa->id_to_servant (id.in());
+	PortableServer::ObjectId_var id2 = poa->servant_to_id (servs[i]);
+	ok = ok && s == servs[i] && id2.in() == id.in();
+	s->_remove_ref ();
+    }
+    // remove every other object, the rest must still be there
+    for (CORBA::ULong i = 0; i < n; i += 2) {
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->deactivate_object (id.in());
+    }
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	try {
+	    PortableServer::Servant s = poa->id_to_servant (id.in());
+	    ok = ok && i % 2 == 1 && s == servs[i];
+	    s->_remove_ref ();
+	} catch (PortableServer::POA::ObjectNotActive &) {
+	    ok = ok && i % 2 == 0;
+	}
+    }
+    poa->destroy (TRUE, TRUE);
+    for (CORBA::ULong i = 0; i < n; ++i)
+	servs[i]->_remove_ref ();
+    return ok;
+}
+
+// one servant for all objects
+static bool
+check_multiple (PortableServer::POA_ptr root, CORBA::ULong n)
+{
+    PortableServer::POA_var poa =
+	make_poa (root, "multiple", PortableServer::MULTIPLE_ID);
+    Impl *serv = new Impl;
+    bool ok = true;
+
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->activate_object_with_id (id.in(), serv);
+    }
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	try {
+	    poa->activate_object_with_id (id.in(), serv);
+	    ok = false;
+	} catch (PortableServer::POA::ObjectAlreadyActive &) {
+	}
+    }
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->deactivate_object (id.in());
+    }
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	try {
+	    PortableServer::Servant s = poa->id_to_servant (id.in());
+	    s->_remove_ref ();
+	    ok = false;
+	} catch (PortableServer::POA::ObjectNotActive &) {
+	}
+    }
+    poa->destroy (TRUE, TRUE);
+    serv->_remove_ref ();
+    return ok;
+}
+
+static void
+bench (PortableServer::POA_ptr root, CORBA::ULong n)
+{
+    PortableServer::POA_var poa =
+	make_poa (root, "bench", PortableServer::MULTIPLE_ID);
+    Impl *serv = new Impl;
+    OSMisc::TimeVal t1, t2, t3, t4;
+
+    t1 = OSMisc::gettime();
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->activate_object_with_id (id.in(), serv);
+    }
+    t2 = OSMisc::gettime();
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id ((i * 7919) % n);
+	PortableServer::Servant s = poa->id_to_servant (id.in());
+	s->_remove_ref ();
+    }
+    t3 = OSMisc::gettime();
+    for (CORBA::ULong i = 0; i < n; ++i) {
+	PortableServer::ObjectId_var id = make_id (i);
+	poa->deactivate_object (id.in());
+    }
+    t4 = OSMisc::gettime();
+
+    cout << n << " objects: "
+	 << usecs (t1, t2) * 1000.0 / n << " ns per activation, "
+	 << usecs (t2, t3) * 1000.0 / n << " ns per lookup, "
+	 << usecs (t3, t4) * 1000.0 / n << " ns per deactivation" << endl;
+
+    poa->destroy (TRUE, TRUE);
+    serv->_remove_ref ();
+}
+
+int
+main (int argc, char *argv[])
+{
+    CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+    CORBA::Object_var obj = orb->resolve_initial_references ("RootPOA");
+    PortableServer::POA_var root = PortableServer::POA::_narrow (obj);
+
+    if (argc > 1 && !strcmp (argv[1], "-bench")) {
+	CORBA::ULong n = argc > 2 ? atoi (argv[2]) : 1000000;
+	for (CORBA::ULong i = 1000; i <= n; i *= 10)
+	    bench (root, i);
+	return 0;
+    }
+
+    bool ok = true;
+    ok = check_unique (root, 1000) && ok;
+    ok = check_multiple (root, 10000) && ok;
+
+    cout << (ok ? "active object map ok" : "FAILED") << endl;
+    root->destroy (TRUE, TRUE);
+    return ok ? 0 : 1;
+}